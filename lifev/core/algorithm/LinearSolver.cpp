@@ -282,7 +282,8 @@ LinearSolver::buildPreconditioner()
 
     if ( M_preconditioner )
     {
-        if ( M_matrix.get() == 0 )
+        // A matrix free operator needs a base matrix for the preconditioner
+        if ( M_matrix.get() == 0 && M_baseMatrixForPreconditioner.get() == 0 )
         {
             M_displayer->leaderPrint ( "SLV-  ERROR: LinearSolver requires a matrix to build the preconditioner!\n" );
             exit ( 1 );
@@ -245,6 +245,8 @@ public:
 
     //! Method to set a matrix on which the preconditioner should be created
     /*!
+      The base matrix is required to build a LifeV preconditioner when the
+      operator has been set as an Epetra_Operator (e.g. a matrix free operator).
       @param baseMatrixPtr  matrix on which the preconditioner should be created
      */
     void setBaseMatrixForPreconditioner ( matrixPtr_Type baseMatrixPtr );
@@ -70,7 +70,11 @@ Preconditioner::~Preconditioner()
 // ===================================================
 // Methods
 // ===================================================
-
+Int
+Preconditioner::recomputePreconditioner ( operator_type& matrix )
+{
+    return buildPreconditioner ( matrix );
+}
 
 // ===================================================
 // Epetra Operator Interface Methods
@@ -128,6 +128,15 @@ public:
     //! Reset the preconditioner
     virtual void resetPreconditioner() = 0;
 
+    //! Recompute the preconditioner for a matrix with new values
+    /*!
+      Update the preconditioner when the values of the matrix have changed but
+      not its pattern, reusing as much as possible of the previous setup.
+      By default the preconditioner is built again from scratch.
+      @param matrix Matrix upon which construct the preconditioner
+     */
+    virtual Int recomputePreconditioner ( operator_type& matrix );
+
     //! Return An estimation of the condition number of the preconditioner
     virtual Real condest() = 0;
 
@@ -37,11 +37,64 @@
 
 #include <lifev/core/algorithm/PreconditionerML.hpp>
 
+#include <algorithm>
+
 #include <lifev/core/LifeV.hpp>
 
 namespace LifeV
 {
 
+namespace
+{
+//! Copy the values of a matrix into a matrix with the same pattern
+/*!
+  @return false if the two matrices do not have the same pattern on all the processes
+ */
+bool copyMatrixValues ( const Epetra_CrsMatrix& source, Epetra_CrsMatrix& destination )
+{
+    Int samePattern ( source.RowMap().SameAs ( destination.RowMap() )
+                      && source.ColMap().SameAs ( destination.ColMap() )
+                      && source.NumMyNonzeros() == destination.NumMyNonzeros() );
+
+    for ( Int row ( 0 ); samePattern && row < source.NumMyRows(); ++row )
+    {
+        Int sourceNumEntries, destinationNumEntries;
+        Real* sourceValues;
+        Real* destinationValues;
+        Int* sourceIndices;
+        Int* destinationIndices;
+        source.ExtractMyRowView ( row, sourceNumEntries, sourceValues, sourceIndices );
+        destination.ExtractMyRowView ( row, destinationNumEntries, destinationValues, destinationIndices );
+
+        if ( sourceNumEntries != destinationNumEntries
+                || !std::equal ( sourceIndices, sourceIndices + sourceNumEntries, destinationIndices ) )
+        {
+            samePattern = false;
+        }
+    }
+
+    Int globalSamePattern ( 0 );
+    source.Comm().MinAll ( &samePattern, &globalSamePattern, 1 );
+    if ( !globalSamePattern )
+    {
+        return false;
+    }
+
+    for ( Int row ( 0 ); row < source.NumMyRows(); ++row )
+    {
+        Int numEntries;
+        Real* sourceValues;
+        Real* destinationValues;
+        Int* indices;
+        source.ExtractMyRowView ( row, numEntries, sourceValues, indices );
+        destination.ExtractMyRowView ( row, numEntries, destinationValues, indices );
+        std::copy ( sourceValues, sourceValues + numEntries, destinationValues );
+    }
+
+    return true;
+}
+} // anonymous namespace
+
 // ===================================================
 // Constructors & Destructor
 // ===================================================
@@ -73,7 +126,17 @@ PreconditionerML::buildPreconditioner ( operator_type& matrix )
     //the Trilinos::MultiLevelPreconditioner unsafely access to the area of memory co-owned by M_operator.
     //to avoid the risk of dandling pointers always deallocate M_preconditioner first and then M_operator
     M_preconditioner.reset();
-    M_operator = matrix;
+
+    // To recompute the hierarchy, ML needs the matrix it was built with:
+    // keep a private copy that can be updated with the new values
+    if ( M_list.get ( "reuse: enable", false ) )
+    {
+        M_operator.reset ( new operator_raw_type ( *matrix ) );
+    }
+    else
+    {
+        M_operator = matrix;
+    }
 
     M_precType = M_list.get ( "prec type", "undefined??" );
     M_precType += "_ML";
@@ -110,6 +173,27 @@ PreconditionerML::resetPreconditioner()
     this->M_preconditionerCreated = false;
 }
 
+Int
+PreconditionerML::recomputePreconditioner ( operator_type& matrix )
+{
+    if ( !M_preconditioner || !M_list.get ( "reuse: enable", false ) )
+    {
+        return buildPreconditioner ( matrix );
+    }
+
+    if ( matrix.get() != M_operator.get() )
+    {
+        if ( !copyMatrixValues ( *matrix->matrixPtr(), *M_operator->matrixPtr() ) )
+        {
+            return buildPreconditioner ( matrix );
+        }
+    }
+
+    M_preconditioner->ReComputePreconditioner();
+
+    return ( EXIT_SUCCESS );
+}
+
 void
 PreconditionerML::createMLList ( list_Type& list,
                                  const GetPot&       dataFile,
@@ -452,6 +536,13 @@ PreconditionerML::createMLList ( list_Type& list,
     }
 
 
+    // Reuse of the hierarchy when the matrix values change
+    bool ReuseEnable = dataFile ( (section + "/" + subSection + "/reuse").data(), false, found );
+    if ( found )
+    {
+        list.set ( "reuse: enable", ReuseEnable );
+    }
+
     // Load-balancing Options
     Int RepartitionEnable              = dataFile ( (section + "/" + subSection + "/repartition/enable").data(), 0, found );
     if ( found )
@@ -107,6 +107,16 @@ public:
     //! Reset the preconditioner
     void resetPreconditioner();
 
+    //! Recompute the preconditioner for a matrix with new values
+    /*!
+      If the reuse of the hierarchy is enabled (ML/reuse in the data file) and
+      the matrix has the same pattern of the one used to build the preconditioner,
+      the aggregates and the prolongators are kept and only the coarse operators
+      and the smoothers are recomputed. Otherwise the preconditioner is built again.
+      @param matrix Matrix upon which construct the preconditioner
+     */
+    Int recomputePreconditioner ( operator_type& matrix );
+
     //! Create the list of parameters of the preconditioner
     /*!
       @param list A Parameter list to be filled
@@ -53,7 +53,17 @@ SolverAztecOO::SolverAztecOO() :
     M_tolerance            ( 0. ),
     M_maxIter              ( 0 ),
     M_maxIterForReuse      ( 0 ),
-    M_reusePreconditioner  (false)
+    M_reusePreconditioner  (false),
+    M_reusePolicy          ( ReuseDegradation ),
+    M_degradationFactor    ( 0. ),
+    M_reuseCadence         ( 1 ),
+    M_solvesSinceBuild     ( 0 ),
+    M_iterationsAfterBuild ( -1 ),
+    M_preconditionerSetupTime ( 0. ),
+    M_solveTime            ( 0. ),
+    M_numPreconditionerBuilds ( 0 ),
+    M_numPreconditionerRecomputes ( 0 ),
+    M_numSolves            ( 0 )
 {
     if ( M_displayer->isLeader() )
     {
@@ -70,7 +80,17 @@ SolverAztecOO::SolverAztecOO ( const boost::shared_ptr<Epetra_Comm>& comm ) :
     M_tolerance            ( 0. ),
     M_maxIter              ( 0 ),
     M_maxIterForReuse      ( 0 ),
-    M_reusePreconditioner  (false)
+    M_reusePreconditioner  (false),
+    M_reusePolicy          ( ReuseDegradation ),
+    M_degradationFactor    ( 0. ),
+    M_reuseCadence         ( 1 ),
+    M_solvesSinceBuild     ( 0 ),
+    M_iterationsAfterBuild ( -1 ),
+    M_preconditionerSetupTime ( 0. ),
+    M_solveTime            ( 0. ),
+    M_numPreconditionerBuilds ( 0 ),
+    M_numPreconditionerRecomputes ( 0 ),
+    M_numSolves            ( 0 )
 {
     if ( M_displayer->isLeader() )
     {
@@ -206,11 +226,17 @@ Int SolverAztecOO::solveSystem ( const vector_type& rhsFull,
         M_displayer->leaderPrint ( "SLV-  Warning: baseMatrixForPreconditioner is empty     \n" );
     }
 
+    bool built ( false );
     if ( !isPreconditionerSet() || !M_reusePreconditioner  )
     {
         buildPreconditioner ( baseMatrixForPreconditioner );
         // do not retry if I am recomputing the preconditioner
         retry = false;
+        built = true;
+    }
+    else if ( M_reusePolicy == ReuseRecompute )
+    {
+        recomputePreconditioner ( baseMatrixForPreconditioner );
     }
     else
     {
@@ -230,6 +256,7 @@ Int SolverAztecOO::solveSystem ( const vector_type& rhsFull,
         M_displayer->leaderPrint ( "SLV-  retrying:          " );
 
         buildPreconditioner ( baseMatrixForPreconditioner );
+        built = true;
 
         chrono.stop();
         M_displayer->leaderPrintMax ( "done in " , chrono.diff() );
@@ -242,7 +269,30 @@ Int SolverAztecOO::solveSystem ( const vector_type& rhsFull,
         }
     }
 
-    if ( std::abs (numIter) > M_maxIterForReuse )
+    ++M_solvesSinceBuild;
+    if ( built )
+    {
+        // Reference number of iterations for the degradation trigger
+        M_iterationsAfterBuild = std::abs ( numIter );
+    }
+
+    bool rebuild ( std::abs ( numIter ) > M_maxIterForReuse );
+    switch ( M_reusePolicy )
+    {
+        case ReuseDegradation:
+            if ( M_degradationFactor > 0. && M_iterationsAfterBuild > 0 )
+            {
+                rebuild = rebuild || std::abs ( numIter ) > M_degradationFactor * M_iterationsAfterBuild;
+            }
+            break;
+        case ReuseCadence:
+            rebuild = rebuild || M_solvesSinceBuild >= M_reuseCadence;
+            break;
+        default:
+            break;
+    }
+
+    if ( rebuild )
     {
         resetPreconditioner();
     }
@@ -274,10 +324,31 @@ void SolverAztecOO::buildPreconditioner ( matrix_ptrtype& preconditioner )
     condest = M_preconditioner->condest();
     chrono.stop();
 
+    M_preconditionerSetupTime += chrono.diff();
+    ++M_numPreconditionerBuilds;
+    M_solvesSinceBuild = 0;
+
     M_displayer->leaderPrintMax ( "done in " , chrono.diff() );
     M_displayer->leaderPrint ( "SLV-  Estimated condition number               " , condest, "\n" );
 }
 
+void SolverAztecOO::recomputePreconditioner ( matrix_ptrtype& preconditioner )
+{
+    LifeChrono chrono;
+    chrono.start();
+
+    M_displayer->leaderPrint ( "SLV-  Recomputing the precond ...              " );
+
+    M_preconditioner->recomputePreconditioner ( preconditioner );
+
+    chrono.stop();
+
+    M_preconditionerSetupTime += chrono.diff();
+    ++M_numPreconditionerRecomputes;
+
+    M_displayer->leaderPrintMax ( "done in " , chrono.diff() );
+}
+
 void SolverAztecOO::resetPreconditioner()
 {
     M_preconditioner->resetPreconditioner();
@@ -292,7 +363,17 @@ SolverAztecOO::isPreconditionerSet() const
 void
 SolverAztecOO::showMe ( std::ostream& output ) const
 {
-    output << "showMe must be implemented for the SolverAztecOO class" << std::endl;
+    output << "SolverAztecOO:" << std::endl;
+    output << "    tolerance                  = " << M_tolerance << std::endl;
+    output << "    maximum iterations         = " << M_maxIter << std::endl;
+    output << "    reuse preconditioner       = " << M_reusePreconditioner << std::endl;
+    output << "    reuse policy               = " << ( M_reusePolicy == ReuseRecompute ? "recompute" :
+                                                        ( M_reusePolicy == ReuseCadence ? "cadence" : "degradation" ) ) << std::endl;
+    output << "    preconditioner builds      = " << M_numPreconditionerBuilds << std::endl;
+    output << "    preconditioner recomputes  = " << M_numPreconditionerRecomputes << std::endl;
+    output << "    preconditioner setup time  = " << M_preconditionerSetupTime << std::endl;
+    output << "    solves                     = " << M_numSolves << std::endl;
+    output << "    solve time                 = " << M_solveTime << std::endl;
 }
 
 // ===================================================
@@ -354,6 +435,27 @@ SolverAztecOO::setDataFromGetPot ( const GetPot& dataFile, const std::string& se
     M_maxIterForReuse = dataFile ( ( section + "/max_iter_reuse").data(), static_cast<Int> ( M_maxIter * 8. / 10.) );
     M_reusePreconditioner = dataFile ( (section + "/reuse").data(), M_reusePreconditioner );
 
+    // Reuse policy
+    const std::string reusePolicy = dataFile ( ( section + "/reuse_policy" ).data(), "degradation" );
+    if ( reusePolicy == "recompute" )
+    {
+        M_reusePolicy = ReuseRecompute;
+    }
+    else if ( reusePolicy == "cadence" )
+    {
+        M_reusePolicy = ReuseCadence;
+    }
+    else if ( reusePolicy == "degradation" )
+    {
+        M_reusePolicy = ReuseDegradation;
+    }
+    else
+    {
+        ERROR_MSG ( "SolverAztecOO: unknown reuse_policy " + reusePolicy );
+    }
+    M_degradationFactor = dataFile ( ( section + "/reuse_degradation_factor" ).data(), 0. );
+    M_reuseCadence      = dataFile ( ( section + "/reuse_cadence" ).data(), 1 );
+
     M_TrilinosParameterList.set ( "max_iter", M_maxIter );
 
     // GMRES PARAMETERS
@@ -404,6 +506,14 @@ SolverAztecOO::setReusePreconditioner ( const bool reusePreconditioner )
     M_reusePreconditioner = reusePreconditioner;
 }
 
+void
+SolverAztecOO::setReusePolicy ( const ReusePolicy reusePolicy, const Real degradationFactor, const UInt cadence )
+{
+    M_reusePolicy       = reusePolicy;
+    M_degradationFactor = degradationFactor;
+    M_reuseCadence      = cadence;
+}
+
 boost::shared_ptr<Displayer>
 SolverAztecOO::displayer()
 {
@@ -72,6 +72,20 @@ namespace LifeV
 /*!
   By default the solver is gmres and the preconditioner is ilu.
 
+  When the preconditioner is reused (data file key "reuse"), the policy
+  "reuse_policy" decides what happens between two solves:
+  <ul>
+  <li> "degradation" (default): the preconditioner is kept as it is and is built again
+       when the number of iterations exceeds "max_iter_reuse" or, if
+       "reuse_degradation_factor" is positive, when it exceeds that factor times the
+       number of iterations measured right after the last build;</li>
+  <li> "recompute": the preconditioner is recomputed with the new matrix values
+       before each solve, keeping what does not depend on them (e.g. the ML aggregates);</li>
+  <li> "cadence": the preconditioner is built again every "reuse_cadence" solves.</li>
+  </ul>
+  The time spent in the setup of the preconditioner and in the iterative solver is
+  accumulated and printed by showMe().
+
   @author Simone Deparis   <simone.deparis@epfl.ch>
   @author Gilles Fourestey <gilles.fourestey@epfl.ch>
 */
@@ -95,6 +109,8 @@ public:
     typedef boost::shared_ptr<matrix_type>     matrix_ptrtype;
     typedef boost::shared_ptr<VectorEpetra>    vector_ptrtype;
 
+    enum ReusePolicy         { ReuseDegradation, ReuseRecompute, ReuseCadence };
+
     //@}
 
     //! @name Constructors & Destructor
@@ -179,6 +195,13 @@ public:
     */
     void buildPreconditioner ( matrix_ptrtype& baseMatrixForPreconditioner );
 
+    //! Recomputes the preconditioner for the new values of "baseMatrixForPreconditioner"
+    /*!
+      The pattern of the matrix must be the same used to build the preconditioner.
+      @param  baseMatrixForPreconditioner Base matrix for the preconditioner construction
+    */
+    void recomputePreconditioner ( matrix_ptrtype& baseMatrixForPreconditioner );
+
     //! Delete the stored preconditioner
     void resetPreconditioner();
 
@@ -254,6 +277,14 @@ public:
      */
     void setReusePreconditioner ( const bool reusePreconditioner );
 
+    //! Set the policy used when the preconditioner is reused
+    /*!
+      @param reusePolicy Reuse policy
+      @param degradationFactor Rebuild if the iterations exceed this factor times the iterations after the last build (ReuseDegradation, disabled if not positive)
+      @param cadence Number of solves between two builds (ReuseCadence)
+     */
+    void setReusePolicy ( const ReusePolicy reusePolicy, const Real degradationFactor = 0., const UInt cadence = 1 );
+
     //! Return the displayer
     boost::shared_ptr<Displayer> displayer();
 
@@ -283,6 +314,24 @@ public:
     //! Return a reference on the AztecOO solver
     AztecOO& solver();
 
+    //! Return the policy used when the preconditioner is reused
+    ReusePolicy reusePolicy() const
+    {
+        return M_reusePolicy;
+    }
+
+    //! Return the total time spent in the setup of the preconditioner
+    Real preconditionerSetupTime() const
+    {
+        return M_preconditionerSetupTime;
+    }
+
+    //! Return the total time spent in the iterative solver
+    Real solveTime() const
+    {
+        return M_solveTime;
+    }
+
     //@}
 
 private:
@@ -299,6 +348,18 @@ private:
     Int                          M_maxIter;
     Int                          M_maxIterForReuse;
     bool                         M_reusePreconditioner;
+
+    ReusePolicy                  M_reusePolicy;
+    Real                         M_degradationFactor;
+    UInt                         M_reuseCadence;
+    UInt                         M_solvesSinceBuild;
+    Int                          M_iterationsAfterBuild;
+
+    Real                         M_preconditionerSetupTime;
+    Real                         M_solveTime;
+    UInt                         M_numPreconditionerBuilds;
+    UInt                         M_numPreconditionerRecomputes;
+    UInt                         M_numSolves;
 };
 
 template <typename PrecPtrOperator>
@@ -316,6 +377,9 @@ Int SolverAztecOO::solveSystem ( const vector_type&  rhsFull,
     chrono.stop();
     M_displayer->leaderPrintMax ( "done in " , chrono.diff() );
 
+    M_solveTime += chrono.diff();
+    ++M_numSolves;
+
     // If we use the "none" as output setting, we display just a summary
     if ( M_TrilinosParameterList.get ( "output", "all" ) == "none" )
     {
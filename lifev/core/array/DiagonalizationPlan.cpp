@@ -0,0 +1,146 @@
+//@HEADER
+/*
+*******************************************************************************
+
+    Copyright (C) 2004, 2005, 2007 EPFL, Politecnico di Milano, INRIA
+    Copyright (C) 2010 EPFL, Politecnico di Milano, Emory University
+
+    This file is part of LifeV.
+
+    LifeV is free software; you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    LifeV is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with LifeV.  If not, see <http://www.gnu.org/licenses/>.
+
+*******************************************************************************
+*/
+//@HEADER
+
+/*!
+    @file
+    @brief Routing of constrained rows to the processes owning them
+
+    @date 19-10-2026
+ */
+
+#include <algorithm>
+
+#include <Epetra_Comm.h>
+
+#include <lifev/core/array/DiagonalizationPlan.hpp>
+
+namespace LifeV
+{
+
+// ===================================================
+// Constructors & Destructor
+// ===================================================
+
+DiagonalizationPlan::DiagonalizationPlan ( const Epetra_Map& rowMap, const std::vector<ID>& rows, const UInt offset ) :
+    M_rowMap          ( rowMap ),
+    M_rows            ( rows ),
+    M_offset          ( offset ),
+    M_exportPositions (),
+    M_distributor     ( rowMap.Comm().CreateDistributor() ),
+    M_importedRows    (),
+    M_localRows       ()
+{
+    const Int numRows ( rows.size() );
+
+    std::vector<Int> gids ( numRows );
+    for ( Int i = 0; i < numRows; ++i )
+    {
+        gids[ i ] = static_cast<Int> ( rows[ i ] + offset );
+    }
+
+    // Owners of the rows; rows not in the map get a negative owner and are ignored
+    std::vector<Int> pids ( numRows );
+    std::vector<Int> lids ( numRows );
+    rowMap.RemoteIDList ( numRows,
+                          numRows > 0 ? &gids[ 0 ] : 0,
+                          numRows > 0 ? &pids[ 0 ] : 0,
+                          numRows > 0 ? &lids[ 0 ] : 0 );
+
+    std::vector<Int> exportPIDs;
+    std::vector<Int> exportGIDs;
+    exportPIDs.reserve ( numRows );
+    exportGIDs.reserve ( numRows );
+    M_exportPositions.reserve ( numRows );
+    for ( Int i = 0; i < numRows; ++i )
+    {
+        if ( pids[ i ] >= 0 )
+        {
+            M_exportPositions.push_back ( i );
+            exportPIDs.push_back ( pids[ i ] );
+            exportGIDs.push_back ( gids[ i ] );
+        }
+    }
+
+    // Only the processes sharing rows exchange messages
+    Int numImports ( 0 );
+    M_distributor->CreateFromSends ( exportPIDs.size(), exportPIDs.empty() ? 0 : &exportPIDs[ 0 ], true, numImports );
+
+    Int importLength ( 0 );
+    char* importBuffer ( 0 );
+    M_distributor->Do ( reinterpret_cast<char*> ( exportGIDs.empty() ? 0 : &exportGIDs[ 0 ] ),
+                        sizeof ( Int ), importLength, importBuffer );
+    const Int* importGIDs ( reinterpret_cast<const Int*> ( importBuffer ) );
+
+    std::vector<bool> isConstrained ( rowMap.NumMyElements(), false );
+    M_importedRows.resize ( numImports );
+    for ( Int i = 0; i < numImports; ++i )
+    {
+        const Int lid ( rowMap.LID ( importGIDs[ i ] ) );
+        M_importedRows[ i ] = lid;
+        if ( !isConstrained[ lid ] )
+        {
+            isConstrained[ lid ] = true;
+            M_localRows.push_back ( lid );
+        }
+    }
+    delete[] importBuffer;
+
+    std::sort ( M_localRows.begin(), M_localRows.end() );
+}
+
+// ===================================================
+// Methods
+// ===================================================
+
+bool
+DiagonalizationPlan::isValid ( const Epetra_Map& rowMap, const std::vector<ID>& rows, const UInt offset ) const
+{
+    // Maps sharing the data are identical; a new map never shares the data of the old one
+    return M_rowMap.DataPtr() == rowMap.DataPtr() && M_offset == offset && M_rows == rows;
+}
+
+void
+DiagonalizationPlan::exchange ( const std::vector<Real>& values, std::vector<Real>& importedValues ) const
+{
+    ASSERT ( values.size() == M_rows.size(), "DiagonalizationPlan: one value per row is needed" );
+
+    std::vector<Real> exportValues ( M_exportPositions.size() );
+    for ( UInt i = 0; i < M_exportPositions.size(); ++i )
+    {
+        exportValues[ i ] = values[ M_exportPositions[ i ] ];
+    }
+
+    Int importLength ( 0 );
+    char* importBuffer ( 0 );
+    M_distributor->Do ( reinterpret_cast<char*> ( exportValues.empty() ? 0 : &exportValues[ 0 ] ),
+                        sizeof ( Real ), importLength, importBuffer );
+
+    const Real* importValues ( reinterpret_cast<const Real*> ( importBuffer ) );
+    importedValues.assign ( importValues, importValues + M_importedRows.size() );
+    delete[] importBuffer;
+}
+
+} // namespace LifeV
@@ -0,0 +1,146 @@
+//@HEADER
+/*
+*******************************************************************************
+
+    Copyright (C) 2004, 2005, 2007 EPFL, Politecnico di Milano, INRIA
+    Copyright (C) 2010 EPFL, Politecnico di Milano, Emory University
+
+    This file is part of LifeV.
+
+    LifeV is free software; you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    LifeV is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with LifeV.  If not, see <http://www.gnu.org/licenses/>.
+
+*******************************************************************************
+*/
+//@HEADER
+
+/*!
+    @file
+    @brief Routing of constrained rows to the processes owning them
+
+    @date 19-10-2026
+
+    The rows constrained by an essential boundary condition are known by the
+    processes whose mesh contains the boundary, which are not necessarily the
+    owners of the rows. The plan finds the owners once and records, on each
+    process, the local indices of the constrained rows it owns. The values
+    associated with the rows (e.g. the Dirichlet data) are then shipped with a
+    single exchange among the processes which actually share rows, so that
+    MatrixEpetra::diagonalize() reduces to a purely local pass.
+ */
+
+#ifndef DIAGONALIZATION_PLAN_H
+#define DIAGONALIZATION_PLAN_H 1
+
+#include <vector>
+
+#include <boost/shared_ptr.hpp>
+
+#include <Epetra_Map.h>
+#include <Epetra_Distributor.h>
+
+#include <lifev/core/LifeV.hpp>
+
+namespace LifeV
+{
+
+//! DiagonalizationPlan - Owners of a list of constrained global rows
+/*!
+    The plan is built collectively and it can be reused as long as the row
+    map and the list of rows do not change (see isValid()).
+ */
+class DiagonalizationPlan
+{
+public:
+
+    //! @name Constructors & Destructor
+    //@{
+
+    //! Constructor
+    /*!
+      Collective: all the processes of the communicator of the map must call it.
+      @param rowMap row map of the matrix
+      @param rows global rows known by this process (duplicates are allowed)
+      @param offset offset to be added to the rows
+     */
+    DiagonalizationPlan ( const Epetra_Map& rowMap, const std::vector<ID>& rows, const UInt offset = 0 );
+
+    //! Destructor
+    virtual ~DiagonalizationPlan() {}
+
+    //@}
+
+
+    //! @name Methods
+    //@{
+
+    //! True if the plan has been built for this row map and this list of rows
+    /*!
+      The check is local, it does not involve any communication.
+      @param rowMap row map of the matrix
+      @param rows global rows known by this process
+      @param offset offset to be added to the rows
+     */
+    bool isValid ( const Epetra_Map& rowMap, const std::vector<ID>& rows, const UInt offset = 0 ) const;
+
+    //! Ship one value per row to the process owning the row
+    /*!
+      Collective.
+      @param values values associated with the rows given to the constructor
+      @param importedValues values associated with importedRows() (output)
+     */
+    void exchange ( const std::vector<Real>& values, std::vector<Real>& importedValues ) const;
+
+    //@}
+
+
+    //! @name Get Methods
+    //@{
+
+    //! Local indices of the constrained rows owned by this process, without duplicates
+    const std::vector<Int>& localRows() const
+    {
+        return M_localRows;
+    }
+
+    //! Local index of the row of each entry received by exchange()
+    const std::vector<Int>& importedRows() const
+    {
+        return M_importedRows;
+    }
+
+    //@}
+
+private:
+
+    //! @name Private Methods
+    //@{
+    DiagonalizationPlan ( const DiagonalizationPlan& );
+    DiagonalizationPlan& operator= ( const DiagonalizationPlan& );
+    //@}
+
+    Epetra_Map                               M_rowMap;
+    std::vector<ID>                          M_rows;
+    UInt                                     M_offset;
+
+    //! Position in M_rows of the rows sent to their owner
+    std::vector<UInt>                        M_exportPositions;
+    boost::shared_ptr<Epetra_Distributor>    M_distributor;
+
+    std::vector<Int>                         M_importedRows;
+    std::vector<Int>                         M_localRows;
+};
+
+} // namespace LifeV
+
+#endif // DIAGONALIZATION_PLAN_H
@@ -45,6 +45,8 @@
 #include <Epetra_MpiComm.h>
 #include <Epetra_FECrsMatrix.h>
 #include <Epetra_FECrsGraph.h>
+#include <Epetra_Vector.h>
+#include <Epetra_Import.h>
 #include <EpetraExt_MatrixMatrix.h>
 #include <EpetraExt_Transpose_RowMatrix.h>
 #include <EpetraExt_RowMatrixOut.h>
@@ -56,6 +58,7 @@
 
 
 #include <lifev/core/array/VectorEpetra.hpp>
+#include <lifev/core/array/DiagonalizationPlan.hpp>
 
 //@@
 //#define OFFSET 0
@@ -267,6 +270,14 @@ public:
      */
     void diagonalize ( std::vector<UInt> rVec, DataType const coefficient, UInt offset = 0 );
 
+    //! Set the diagonal entries of the rows of a plan to coefficient and the rest of the rows to zero
+    /*!
+      Only the rows owned by this process are modified, without any communication.
+      @param plan Plan of the rows, built on the row map of this matrix
+      @param coefficient Value to be set on the diagonal
+     */
+    void diagonalize ( const DiagonalizationPlan& plan, DataType const coefficient );
+
     //! Set entry (entryIndex,entryIndex) to coefficient and the rest of the row to zero
     /*!
       @param entryIndex Index of the row where we set the "coefficient"
@@ -289,6 +300,20 @@ public:
                        std::vector<DataType> datumVector,
                        UInt offset = 0 );
 
+    //! apply constraint on all the rows of a plan
+    /*!
+      The data are sent to the owners of the rows through the plan, then
+      matrix and right hand side are modified locally.
+      @param plan Plan of the rows, built on the row map of this matrix
+      @param coefficient Value to set entry (r,r) at
+      @param rhs Right hand side Vector of the system to be adapted accordingly
+      @param datumVector values to constrain the rows at, in the order the rows were given to the plan
+     */
+    void diagonalize ( const DiagonalizationPlan& plan,
+                       DataType const coefficient,
+                       vector_type& rhs,
+                       const std::vector<DataType>& datumVector );
+
     //! apply constraint on row "row"
     /*!
       @param row row number
@@ -953,52 +978,40 @@ boost::shared_ptr<MatrixEpetra<DataType> > MatrixEpetra<DataType>::transpose( )
 template <typename DataType>
 void MatrixEpetra<DataType>::diagonalize ( std::vector<UInt> rVec, DataType const coefficient, UInt offset )
 {
+    const DiagonalizationPlan plan ( M_epetraCrs->RowMap(), rVec, offset );
+    diagonalize ( plan, coefficient );
+}
 
-    const Epetra_Comm&  Comm ( M_epetraCrs->Comm() );
-    Int numProcs ( Comm.NumProc() );
-    Int MyPID   ( Comm.MyPID() );
-    Int i;
-
-
-    // Note: Epetra_Comm::broadcast does not support passing of uint, hence
-    //       I define an int pointer to make the broadcast but then come back to an
-    //       UInt pointer to insert the data
-    Int*  r;
-    UInt* Ur;
-
-
-    // loop on all proc
-    for ( Int p (0); p < numProcs; p++ )
+template <typename DataType>
+void MatrixEpetra<DataType>::diagonalize ( const DiagonalizationPlan& plan, DataType const coefficient )
+{
+    if ( !M_epetraCrs->Filled() )
     {
-        Int sizeVec ( rVec.size() );
-
-        Comm.Broadcast ( &sizeVec, 1, p );
-
-        if ( p == MyPID )
-        {
-            Ur = &rVec.front();
-        }
-        else
-        {
-            Ur = new UInt[sizeVec];
-        }
+        // if not filled, I do not know how to diagonalize.
+        ERROR_MSG ( "if not filled, I do not know how to diagonalize\n" );
+    }
 
-        r = (Int*) Ur;
+    const Epetra_Map& rowMap ( M_epetraCrs->RowMap() );
+    const Epetra_Map& colMap ( M_epetraCrs->ColMap() );
 
-        Comm.Broadcast ( r, sizeVec, p );
+    const std::vector<Int>& localRows ( plan.localRows() );
+    for ( UInt i (0); i < localRows.size(); ++i )
+    {
+        Int    NumEntries;
+        Real* Values;
+        Int* Indices;
 
-        for ( i = 0; i < sizeVec; i++ )
-        {
-            diagonalize ( Ur[i], coefficient, offset );
-        }
+        M_epetraCrs->ExtractMyRowView ( localRows[i], NumEntries, Values, Indices );
 
-        if ( p != MyPID )
+        for ( Int j (0); j < NumEntries; j++ )
         {
-            delete[] Ur;
+            Values[j] = 0;
         }
 
+        Int myCol = colMap.LID ( rowMap.GID ( localRows[i] ) );
+        DataType coeff ( coefficient );
+        M_epetraCrs->ReplaceMyValues ( localRows[i], 1, &coeff, &myCol ); // A(r,r) = coefficient
     }
-
 }
 
 template <typename DataType>
@@ -1048,194 +1061,73 @@ void MatrixEpetra<DataType>::diagonalize ( std::vector<UInt> rVec,
                                            std::vector<DataType> datumVec,
                                            UInt offset )
 {
+    if ( rVec.size() != datumVec.size() )
+    {
+        // vectors must be of the same size
+        ERROR_MSG ( "diagonalize: vectors must be of the same size\n" );
+    }
 
+    const DiagonalizationPlan plan ( M_epetraCrs->RowMap(), rVec, offset );
+    diagonalize ( plan, coefficient, rhs, datumVec );
+}
 
-    const Epetra_Comm&  Comm ( M_epetraCrs->Comm() );
-    Int numProcs ( Comm.NumProc() );
-    Int MyPID   ( Comm.MyPID() );
-    Int i;
-
-    // Note: Epetra_Comm::broadcast does not support passing of uint, hence
-    //       I define an int pointer to make the broadcast but then come back to an
-    //       UInt pointer to insert the data
-    Int*     r;
-    UInt*    Ur;
-    DataType* datum;
-
-#if 1
-    // 2 arrays to store le local and remote IDs
-
-    Int me = Comm.MyPID();
-
-    std::vector<Int> localIDs;
-    std::vector<Int> remoteIDs;
-
-    std::vector<Real> localData;
-    std::vector<Real> remoteData;
+template <typename DataType>
+void MatrixEpetra<DataType>::diagonalize ( const DiagonalizationPlan& plan,
+                                           DataType const coefficient,
+                                           vector_type& rhs,
+                                           const std::vector<DataType>& datumVec )
+{
+    // The data reach the owners of the rows, the rest is local
+    std::vector<DataType> importedData;
+    plan.exchange ( datumVec, importedData );
 
-    std::map<Int, Real>           localBC;
-    std::map<Int, Real>::iterator im;
+    diagonalize ( plan, coefficient );
 
     const Epetra_Map& rowMap ( M_epetraCrs->RowMap() );
-
-
-    //Comm.Barrier();
-    // we want to know which IDs are our or not
-
-    for ( Int ii = 0; ii < (Int) rVec.size(); ++ii )
+    const std::vector<Int>& importedRows ( plan.importedRows() );
+    for ( UInt i (0); i < importedRows.size(); ++i )
     {
-        Int lID = rowMap.LID ( static_cast<EpetraInt_Type> (rVec[ii]) );
-        if ( ! ( lID < 0 ) )
-        {
-
-            localIDs.push_back ( rVec[ii] );
-            localData.push_back ( datumVec[ii] );
-            localBC.insert ( std::pair<Int, Real> ( rVec[ii], datumVec[ii] ) );
-        }
-        else
-        {
-            remoteIDs.push_back ( rVec[ii] );
-            remoteData.push_back ( datumVec[ii] );
-        }
+        rhs[ rowMap.GID ( importedRows[i] ) ] = coefficient * importedData[i]; // correct right hand side for row r
     }
 
-    // now, we have to fill our localIDs with IDs from other processors
-    // first, we have to build the map of all the remoteIDs and their processor owner
-
-
-    Int numIDs = remoteIDs.size();
-
-    Int* PIDList = new Int[numIDs];
-    Int* LIDList = new Int[numIDs];
-
-    rowMap.RemoteIDList ( numIDs,
-                          &remoteIDs[0],
-                          PIDList,
-                          LIDList );
-
-    std::vector< std::vector<Int> > procToID  ( Comm.NumProc() );
-    std::vector< std::vector<Real> > procToData ( Comm.NumProc() );
+#ifdef EPETRAMATRIX_SYMMETRIC_DIAGONALIZE
+    // Zero the constrained columns: the flags of the constrained rows are
+    // imported only by the processes whose column map contains them
+    const Epetra_Map& colMap ( M_epetraCrs->ColMap() );
 
-    for ( Int ii = 0; ii < numIDs; ++ii )
+    Epetra_Vector rowFlags ( rowMap );
+    const std::vector<Int>& localRows ( plan.localRows() );
+    for ( UInt i (0); i < localRows.size(); ++i )
     {
-        Int pi = PIDList[ii];
-        procToID[pi].push_back ( remoteIDs[ii] );
-        procToData[pi].push_back ( remoteData[ii] );
+        rowFlags[ localRows[i] ] = 1.;
     }
 
-    // then, we send all the nodes where they belong
+    Epetra_Vector columnFlags ( colMap );
+    Epetra_Import importer ( colMap, rowMap );
+    columnFlags.Import ( rowFlags, importer, Insert );
 
-    const Epetra_MpiComm* comm = dynamic_cast<Epetra_MpiComm const*> ( &Comm );
-
-    assert ( comm != 0 );
-
-    for ( Int ii = 0; ii < (Int) procToID.size(); ++ii )
+    for ( Int row (0); row < rowMap.NumMyElements(); ++row )
     {
-        if ( ii != me )
+        if ( rowFlags[ row ] != 0. )
         {
-            Int length;
-            length = procToID[ii].size();
-            MPI_Send ( &length, 1, MPI_INT, ii, 666, comm->Comm() );
-            if ( length > 0 )
-            {
-                MPI_Send ( &procToID[ii][0], length, MPI_INT, ii, 667, comm->Comm() );
-                MPI_Send ( &procToData[ii][0], length, MPI_DOUBLE, ii, 668, comm->Comm() );
-            }
+            continue;
         }
 
-    }
-
-    for ( Int ii = 0; ii < (Int) procToID.size(); ++ii )
-    {
-        if ( ii != me )
-        {
-            Int length;
-            MPI_Status status;
-            MPI_Recv ( &length, 1, MPI_INT, ii, 666, comm->Comm(), &status );
+        Int    NumEntries;
+        Real* Values;
+        Int* Indices;
 
+        M_epetraCrs->ExtractMyRowView ( row, NumEntries, Values, Indices );
 
-            if ( length > 0 )
+        for ( Int j (0); j < NumEntries; j++ )
+        {
+            if ( columnFlags[ Indices[j] ] != 0. )
             {
-                Int* bufferID = new Int[length];
-                Int* ptrID (0); //    = new Int[length];
-
-                MPI_Recv ( bufferID, length, MPI_INT, ii, 667, comm->Comm(), &status );
-
-                ptrID = bufferID;
-
-                Real* bufferData = new Real[length];
-                Real* ptrData (0);
-
-                MPI_Recv ( bufferData, length, MPI_DOUBLE, ii, 668, comm->Comm(), &status );
-                ptrData = bufferData;
-
-                for ( Int ii = 0; ii < length; ++ii, ++ptrID, ++ptrData )
-                {
-                    localBC.insert ( std::pair<Int, Real>
-                                     ( *ptrID, *ptrData ) );
-                }
-
-                delete[] bufferID;
-                delete[] bufferData;
-
+                Values[j] = 0;
             }
-
         }
     }
-
-    delete[] PIDList;
-    delete[] LIDList;
-
-    for ( im = localBC.begin(); im != localBC.end(); ++im )
-    {
-        diagonalize ( im->first, coefficient, rhs, im->second, offset );
-    }
-
-    return;
 #endif
-
-
-    // loop on all proc
-    for ( Int p (0); p < numProcs; p++ )
-    {
-        Int sizeVec (rVec.size() );
-        if ( sizeVec != Int (datumVec.size() ) )
-        {
-            // vectors must be of the same size
-            ERROR_MSG ( "diagonalize: vectors must be of the same size\n" );
-        }
-
-        Comm.Broadcast ( &sizeVec, 1, p );
-
-        if ( p == MyPID )
-        {
-            Ur    =  &rVec.front();
-            datum = &datumVec.front();
-        }
-        else
-        {
-            Ur    = new UInt    [sizeVec];
-            datum = new DataType[sizeVec];
-        }
-
-        r = (Int*) Ur;
-
-        Comm.Broadcast ( r,    sizeVec, p );
-        Comm.Broadcast ( datum, sizeVec, p );
-
-        for ( i = 0; i < sizeVec; i++ )
-        {
-            diagonalize ( Ur[i], coefficient, rhs, datum[i], offset );
-        }
-
-        if ( p != MyPID )
-        {
-            delete[] Ur;
-            delete[] datum;
-        }
-
-    }
-
 }
 
 template <typename DataType>
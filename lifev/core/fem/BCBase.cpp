@@ -428,7 +428,8 @@ BCBase::BCBase ( const BCBase& bcBase ) :
     M_idSet                                 ( ),
     M_idVector                              ( ),
     M_offset                                ( bcBase.M_offset ),
-    M_finalized                             ( bcBase.M_finalized )
+    M_finalized                             ( bcBase.M_finalized ),
+    M_diagonalizationPlan                   ( )
 {
     // If the shared_ptr is not empty we make a true copy
     if ( bcBase.M_bcFunction.get() != 0 )
@@ -620,6 +621,7 @@ BCBase& BCBase::operator= ( const BCBase& BCb )
     M_offset  = BCb.M_offset;
     M_finalized = BCb.M_finalized;
     M_components = BCb.M_components;
+    M_diagonalizationPlan.reset();
 
     // Important!!: The set member M_idSet is always empty at this
     // point, it is just an auxiliary container used at the moment of
@@ -648,6 +650,19 @@ Real BCBase::operator() ( const Real& t, const Real& x, const Real& y,
     return M_bcFunction->operator() ( t, x, y, z, iComponent );
 }
 
+void BCBase::evaluate ( const Real& t, const ID& iComponent, std::vector<Real>& values ) const
+{
+    ASSERT_PRE ( M_identifierCoordinates[ 0 ].size() == M_identifierIds.size(), "BC coordinates are not available" );
+
+    const UInt numIdentifiers ( M_identifierIds.size() );
+    values.resize ( numIdentifiers );
+    if ( numIdentifiers > 0 )
+    {
+        M_bcFunction->evaluate ( t, &M_identifierCoordinates[ 0 ][ 0 ], &M_identifierCoordinates[ 1 ][ 0 ],
+                                 &M_identifierCoordinates[ 2 ][ 0 ], numIdentifiers, iComponent, &values[ 0 ] );
+    }
+}
+
 Real BCBase::operator() ( const Real& t, const Real& x, const Real& y,
                           const Real& z, const ID& iComponent, const Real& u ) const
 {
@@ -802,6 +817,38 @@ BCBase::copyIdSetIntoIdVector()
         M_idSet.clear();
     }
     M_finalized = true;
+
+    // Contiguous table of the IDs and of the coordinates of the identifiers
+    const UInt numIdentifiers ( M_idVector.size() );
+    bool isEssential ( true );
+    M_identifierIds.resize ( numIdentifiers );
+    for ( UInt i = 0; i < numIdentifiers; ++i )
+    {
+        M_identifierIds[ i ] = M_idVector[ i ]->id();
+        isEssential = isEssential && dynamic_cast< const BCIdentifierEssential* > ( M_idVector[ i ].get() ) != 0;
+    }
+
+    for ( UInt coordinate = 0; coordinate < 3; ++coordinate )
+    {
+        M_identifierCoordinates[ coordinate ].clear();
+        if ( isEssential )
+        {
+            M_identifierCoordinates[ coordinate ].resize ( numIdentifiers );
+        }
+    }
+    if ( isEssential )
+    {
+        for ( UInt i = 0; i < numIdentifiers; ++i )
+        {
+            const BCIdentifierEssential* identifier ( static_cast< const BCIdentifierEssential* > ( M_idVector[ i ].get() ) );
+            M_identifierCoordinates[ 0 ][ i ] = identifier->x();
+            M_identifierCoordinates[ 1 ][ i ] = identifier->y();
+            M_identifierCoordinates[ 2 ][ i ] = identifier->z();
+        }
+    }
+
+    // The constrained rows may have changed
+    M_diagonalizationPlan.reset();
 }
 
 
@@ -69,6 +69,7 @@
 #include <lifev/core/util/LifeDebug.hpp>
 
 #include <lifev/core/array/VectorEpetra.hpp>
+#include <lifev/core/array/DiagonalizationPlan.hpp>
 
 #include <lifev/core/mesh/MarkerDefinitions.hpp>
 
@@ -403,6 +404,29 @@ public:
      */
     UInt list_size() const;
 
+    //! Returns the IDs of the identifiers, in the order of the list
+    /*!
+       The table is built when the list is finalized (see BCHandler::bcUpdate)
+       @return contiguous array of the IDs
+     */
+    const std::vector<ID>& identifierIds() const
+    {
+        return M_identifierIds;
+    }
+
+    //! Returns one coordinate of the identifiers, in the order of the list
+    /*!
+       The coordinates are stored only if all the identifiers are BCIdentifierEssential,
+       otherwise the arrays are empty.
+       @param coordinate index of the coordinate (0, 1 or 2)
+       @return contiguous array of the coordinates
+     */
+    const std::vector<Real>& identifierCoordinates ( const UInt& coordinate ) const
+    {
+        ASSERT_BD ( coordinate < 3 );
+        return M_identifierCoordinates[ coordinate ];
+    }
+
     //! Method that writes info in output
     /*!
        @param verbose to specify the level of verbosity (false by default)
@@ -442,6 +466,15 @@ public:
     Real operator() ( const Real& t, const Real& x, const Real& y,
                       const Real& z, const ID& iComponent ) const;
 
+    //! Evaluate the BCFunctionBase user specified function on all the identifiers at once
+    /*!
+       The coordinates of the identifiers must be available (see identifierCoordinates())
+       @param t time
+       @param iComponent component of the vector function
+       @param values values of the function at the identifiers, in the order of the list (output)
+     */
+    void evaluate ( const Real& t, const ID& iComponent, std::vector<Real>& values ) const;
+
     //! Overloading function operator by calling the BCFunctionUDepBase user specified function
     /*!
        @param t time
@@ -617,6 +650,17 @@ public:
      */
     bool isUDep() const;
 
+    //! Returns the cache of the owners of the rows constrained by this boundary condition
+    /*!
+       The plan is built at the first diagonalization (see BCManage) and it is
+       cleared whenever the list of identifiers is updated.
+       @return reference to the pointer to the cached plan
+     */
+    boost::shared_ptr<DiagonalizationPlan>& diagonalizationPlan() const
+    {
+        return M_diagonalizationPlan;
+    }
+
     //!< Copy content of M_idSet into M_idVector, clear M_idSet
     void copyIdSetIntoIdVector();
     //@}
@@ -650,6 +694,12 @@ private:
 
     bool M_finalized; //!< True, when M_idVector is finalized
 
+    std::vector<ID> M_identifierIds; //!< IDs of the identifiers, built when the list is finalized
+
+    std::vector<Real> M_identifierCoordinates[ 3 ]; //!< coordinates of the essential identifiers, built when the list is finalized
+
+    mutable boost::shared_ptr<DiagonalizationPlan> M_diagonalizationPlan; //!< Cached owners of the constrained rows
+
 };
 
 
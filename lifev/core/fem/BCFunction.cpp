@@ -61,7 +61,8 @@ BCFunctionBase::BCFunctionBase ( function_Type userDefinedFunction )
 
 BCFunctionBase::BCFunctionBase ( const BCFunctionBase& bcFunctionBase )
     :
-    M_userDefinedFunction ( bcFunctionBase.M_userDefinedFunction )
+    M_userDefinedFunction ( bcFunctionBase.M_userDefinedFunction ),
+    M_batchFunction ( bcFunctionBase.M_batchFunction )
 {
 }
 
@@ -77,11 +78,33 @@ BCFunctionBase::operator= ( const BCFunctionBase& bcFunctionBase )
     if (this != &bcFunctionBase)
     {
         M_userDefinedFunction = bcFunctionBase.M_userDefinedFunction;
+        M_batchFunction = bcFunctionBase.M_batchFunction;
     }
     return *this;
 }
 
 
+//==================================================
+// Methods
+//==================================================
+
+void
+BCFunctionBase::evaluate ( const Real& t, const Real* x, const Real* y, const Real* z,
+                           const UInt& numPoints, const ID& component, Real* values ) const
+{
+    if ( M_batchFunction )
+    {
+        M_batchFunction ( t, x, y, z, numPoints, component, values );
+        return;
+    }
+
+    for ( UInt i = 0; i < numPoints; ++i )
+    {
+        values[ i ] = M_userDefinedFunction ( t, x[ i ], y[ i ], z[ i ], component );
+    }
+}
+
+
 BCFunctionBase*
 createBCFunctionBase ( BCFunctionBase const* bcFunctionBase )
 {
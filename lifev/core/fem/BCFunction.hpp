@@ -82,6 +82,7 @@ public:
     //@{
 
     typedef boost::function<Real ( const Real&, const Real&, const Real&, const Real&, const ID& ) > function_Type;
+    typedef boost::function<void ( const Real&, const Real*, const Real*, const Real*, const UInt&, const ID&, Real* ) > batchFunction_Type;
     typedef boost::shared_ptr<BCFunctionBase> BCFunctionBasePtr_Type;
 
     //@}
@@ -154,6 +155,21 @@ public:
         M_userDefinedFunction = userDefinedFunction;
     }
 
+    //! Set a function evaluating the user defined function on a batch of points
+    /*!
+      The batch function must be consistent with the user defined function, which is still used
+      for single points. Its signature is
+      @verbatim
+      void f ( const Real& t, const Real* x, const Real* y, const Real* z,
+               const UInt& numPoints, const ID& component, Real* values )
+      @endverbatim
+      @param batchFunction the batch function
+    */
+    inline void setBatchFunction ( batchFunction_Type batchFunction )
+    {
+        M_batchFunction = batchFunction;
+    }
+
     //@}
 
     //! @name Get Methods
@@ -173,13 +189,28 @@ public:
     //! @name Methods
     //@{
 
+    //! Evaluate the user defined function on a batch of points
+    /*!
+      The batch function is used if it has been set, otherwise the user
+      defined function is called point by point.
+      @param t Time
+      @param x Coordinates x of the points
+      @param y Coordinates y of the points
+      @param z Coordinates z of the points
+      @param numPoints Number of points
+      @param component The Component of the vector function
+      @param values The values of the function at the points (output)
+    */
+    void evaluate ( const Real& t, const Real* x, const Real* y, const Real* z,
+                    const UInt& numPoints, const ID& component, Real* values ) const;
+
     //! Clone the current object
     /*!
       @return Pointer to the cloned object
     */
     virtual BCFunctionBasePtr_Type clone() const
     {
-        BCFunctionBasePtr_Type copy ( new BCFunctionBase ( M_userDefinedFunction ) );
+        BCFunctionBasePtr_Type copy ( new BCFunctionBase ( *this ) );
         return copy;
     }
 
@@ -190,6 +221,9 @@ public:
 protected:
     //! user defined function
     function_Type M_userDefinedFunction;
+
+    //! optional evaluation of the user defined function on a batch of points
+    batchFunction_Type M_batchFunction;
 };
 
 
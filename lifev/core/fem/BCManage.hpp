@@ -1162,79 +1162,111 @@ bcManageRhs ( VectorType&                     rightHandSide,
 // Essential BC
 // ===================================================
 
-template <typename MatrixType, typename VectorType, typename MeshType, typename DataType>
-void
-bcEssentialManage ( MatrixType& matrix,
-                    VectorType& rightHandSide,
-                    const MeshType& /*mesh*/,
-                    const DOF& dof,
-                    const BCBase& boundaryCond,
-                    const CurrentFEManifold& /*currentBdFE*/,
-                    const DataType& diagonalizeCoef,
-                    const DataType& time,
-                    UInt offset )
+//! Plan of the rows constrained by a boundary condition
+/*!
+  The plan is cached in the BCBase and rebuilt only when the row map of the
+  matrix or the list of rows change. Rebuilding is collective, hence all the
+  processes agree on it with a single reduction.
+  @param matrix The system matrix
+  @param boundaryCond The boundary condition
+  @param idDofVec The rows constrained by the boundary condition on this process
+  @param offset The offset of the rows
+  @return the plan of the rows
+*/
+template <typename MatrixType>
+const DiagonalizationPlan&
+bcDiagonalizationPlan ( MatrixType& matrix,
+                        const BCBase& boundaryCond,
+                        const std::vector<ID>& idDofVec,
+                        UInt offset = 0 )
 {
+    boost::shared_ptr<DiagonalizationPlan>& plan ( boundaryCond.diagonalizationPlan() );
+    const Epetra_Map& rowMap ( matrix.matrixPtr()->RowMap() );
 
-    ID idDof;
+    Int localValid ( plan && plan->isValid ( rowMap, idDofVec, offset ) ? 1 : 0 );
+    Int valid ( 0 );
+    rowMap.Comm().MinAll ( &localValid, &valid, 1 );
+    if ( !valid )
+    {
+        plan.reset ( new DiagonalizationPlan ( rowMap, idDofVec, offset ) );
+    }
+    return *plan;
+}
 
+//! Global DOFs and data of an essential boundary condition
+/*!
+  The DOFs and the data are listed by identifier and then by component. The
+  functional data are evaluated one component at a time on the whole table
+  of the identifiers (see BCBase::evaluate()).
+  @param boundaryCond The boundary condition
+  @param totalDof The number of total scalar DOF
+  @param offset The offset of the DOFs
+  @param time The time
+  @param idDofVec The global DOFs (output)
+  @param datumVec The data (output)
+*/
+template <typename DataType>
+void
+bcEssentialDofsAndData ( const BCBase& boundaryCond,
+                         const UInt totalDof,
+                         const UInt offset,
+                         const DataType& time,
+                         std::vector<ID>& idDofVec,
+                         std::vector<Real>& datumVec )
+{
     // Number of components involved in this boundary condition
-    UInt nComp = boundaryCond.numberOfComponents();
-
-    // Number of total scalar Dof
-    UInt totalDof = dof.numTotalDof();
+    const UInt nComp = boundaryCond.numberOfComponents();
 
+    const std::vector<ID>& ids ( boundaryCond.identifierIds() );
+    const UInt nIds ( ids.size() );
 
-    std::vector<ID>   idDofVec (0);
-    std::vector<Real> datumVec (0);
-
-    idDofVec.reserve (boundaryCond.list_size() *nComp);
-    datumVec.reserve (boundaryCond.list_size() *nComp);
+    idDofVec.resize ( nIds * nComp );
+    datumVec.resize ( nIds * nComp );
 
-    if ( boundaryCond.isDataAVector() )
+    std::vector<Real> values;
+    for ( ID j = 0; j < nComp; ++j )
     {
-        //! If BC is given under a vectorial form
-
-        assert ( static_cast< const BCVectorInterface* > (boundaryCond.pointerToBCVector() ) != 0 );
+        const ID component ( boundaryCond.component ( j ) );
+        const UInt shift ( component * totalDof + offset );
 
-        // Loop on BC identifiers
-        for ( ID i = 0; i < boundaryCond.list_size(); ++i )
+        if ( boundaryCond.isDataAVector() )
         {
-
-            // Loop on components involved in this boundary condition
-            for ( ID j = 0; j < nComp; ++j )
+            //! If BC is given under a vectorial form
+            for ( UInt i = 0; i < nIds; ++i )
             {
-                // Global Dof
-                idDof = boundaryCond[ i ]->id() + boundaryCond.component ( j ) * totalDof + offset;
-                datumVec.push_back (boundaryCond ( boundaryCond[ i ] ->id(), boundaryCond.component ( j ) ) );
-                idDofVec.push_back (idDof);
+                idDofVec[ i * nComp + j ] = ids[ i ] + shift;
+                datumVec[ i * nComp + j ] = boundaryCond ( ids[ i ], component );
             }
         }
-    }
-    else
-    {
-        //! If BC is given under a functional form
-
-        DataType x, y, z;
-        // Loop on BC identifiers
-        for ( ID i = 0; i < boundaryCond.list_size(); ++i )
+        else
         {
-            // Coordinates of the node where we impose the value
-            x = static_cast< const BCIdentifierEssential* > ( boundaryCond[ i ] ) ->x();
-            y = static_cast< const BCIdentifierEssential* > ( boundaryCond[ i ] ) ->y();
-            z = static_cast< const BCIdentifierEssential* > ( boundaryCond[ i ] ) ->z();
-
-            // Loop on components involved in this boundary condition
-            for ( ID j = 0; j < nComp; ++j )
+            //! If BC is given under a functional form
+            boundaryCond.evaluate ( time, component, values );
+            for ( UInt i = 0; i < nIds; ++i )
             {
-                // Global Dof
-                idDof = boundaryCond[ i ] ->id() + boundaryCond.component ( j ) * totalDof + offset;
-
-                datumVec.push_back (boundaryCond ( time, x, y, z, boundaryCond.component ( j ) ) );
-                idDofVec.push_back (idDof);
-
+                idDofVec[ i * nComp + j ] = ids[ i ] + shift;
+                datumVec[ i * nComp + j ] = values[ i ];
             }
         }
     }
+}
+
+
+template <typename MatrixType, typename VectorType, typename MeshType, typename DataType>
+void
+bcEssentialManage ( MatrixType& matrix,
+                    VectorType& rightHandSide,
+                    const MeshType& /*mesh*/,
+                    const DOF& dof,
+                    const BCBase& boundaryCond,
+                    const CurrentFEManifold& /*currentBdFE*/,
+                    const DataType& diagonalizeCoef,
+                    const DataType& time,
+                    UInt offset )
+{
+    std::vector<ID>   idDofVec;
+    std::vector<Real> datumVec;
+    bcEssentialDofsAndData ( boundaryCond, dof.numTotalDof(), offset, time, idDofVec, datumVec );
 
     // If there is an offset than there is a Lagrange multiplier (flux BC)
     if (boundaryCond.offset() > 0)
@@ -1245,7 +1277,7 @@ bcEssentialManage ( MatrixType& matrix,
     }
 
     // Modifying matrix and right hand side
-    matrix.diagonalize ( idDofVec, diagonalizeCoef, rightHandSide, datumVec);
+    matrix.diagonalize ( bcDiagonalizationPlan ( matrix, boundaryCond, idDofVec ), diagonalizeCoef, rightHandSide, datumVec);
 
 }
 
@@ -1289,22 +1321,21 @@ bcEssentialManageUDep ( MatrixType& matrix,
         idDofVec.reserve (boundaryCond.list_size() *nComp);
         datumVec.reserve (boundaryCond.list_size() *nComp);
 
-        DataType x, y, z;
+        const std::vector<ID>& ids ( boundaryCond.identifierIds() );
+        const std::vector<Real>& x ( boundaryCond.identifierCoordinates ( 0 ) );
+        const std::vector<Real>& y ( boundaryCond.identifierCoordinates ( 1 ) );
+        const std::vector<Real>& z ( boundaryCond.identifierCoordinates ( 2 ) );
+
         // Loop on BC identifiers
-        for ( ID i = 0; i < boundaryCond.list_size(); ++i )
+        for ( ID i = 0; i < ids.size(); ++i )
         {
-            // Coordinates of the node where we impose the value
-            x = static_cast< const BCIdentifierEssential* > ( boundaryCond[ i ] ) ->x();
-            y = static_cast< const BCIdentifierEssential* > ( boundaryCond[ i ] ) ->y();
-            z = static_cast< const BCIdentifierEssential* > ( boundaryCond[ i ] ) ->z();
-
             // Loop on components involved in this boundary condition
             for ( ID j = 0; j < nComp; ++j )
             {
                 // Global Dof
-                idDof = boundaryCond[ i ] ->id() + boundaryCond.component ( j ) * totalDof + offset;
+                idDof = ids[ i ] + boundaryCond.component ( j ) * totalDof + offset;
 
-                Real datum = boundaryCond ( time, x, y, z, boundaryCond.component ( j ) , feVec[idDof]);
+                Real datum = boundaryCond ( time, x[ i ], y[ i ], z[ i ], boundaryCond.component ( j ) , feVec[idDof]);
 
                 datumVec.push_back (datum);
                 idDofVec.push_back (idDof);
@@ -1317,10 +1348,11 @@ bcEssentialManageUDep ( MatrixType& matrix,
         {
             // bcType has been changed Flux -> Essential, need to diagonalize also the Lagrange multiplier
             idDofVec.push_back (offset + boundaryCond.offset() );
+            datumVec.push_back ( 0. );
         }
 
         // Modifying matrix and right hand side
-        matrix.diagonalize ( idDofVec, diagonalizeCoef, rightHandSide, datumVec);
+        matrix.diagonalize ( bcDiagonalizationPlan ( matrix, boundaryCond, idDofVec ), diagonalizeCoef, rightHandSide, datumVec);
     }
 }
 
@@ -1365,7 +1397,7 @@ bcEssentialManageMatrix ( MatrixType& matrix,
     }
 
     // Modifying ONLY matrix
-    matrix.diagonalize ( idDofVec, diagonalizeCoef, offset);
+    matrix.diagonalize ( bcDiagonalizationPlan ( matrix, boundaryCond, idDofVec, offset ), diagonalizeCoef );
 }
 
 
@@ -1432,63 +1464,14 @@ bcEssentialManageRhs ( VectorType&     rightHandSide,
                        const DataType& time,
                        UInt            offset )
 {
-    ID idDof;
-    UInt totalDof;
-
-    // Number of total scalar Dof
-    totalDof = dof.numTotalDof();
-
-    // Number of components involved in this boundary condition
-    UInt nComp = boundaryCond.numberOfComponents();
+    std::vector<ID>   idDofs;
+    std::vector<Real> datumVec;
+    bcEssentialDofsAndData ( boundaryCond, dof.numTotalDof(), offset, time, idDofs, datumVec );
 
-    std::vector<int>   idDofVec (0);
-    idDofVec.reserve (boundaryCond.list_size() *nComp);
-    std::vector<Real> datumVec (0);
-    datumVec.reserve (boundaryCond.list_size() *nComp);
-
-    if ( boundaryCond.isDataAVector() )
+    std::vector<int> idDofVec ( idDofs.begin(), idDofs.end() );
+    for ( UInt i = 0; i < datumVec.size(); ++i )
     {
-        //! If BC is given under a vectorial form
-
-        // Loop on BC identifiers
-        for ( ID i = 0; i < boundaryCond.list_size(); ++i )
-        {
-            // Loop on components involved in this boundary condition
-            for ( ID j = 0; j < nComp; ++j )
-            {
-
-                // Global Dof
-                idDof = boundaryCond[ i ] ->id() + boundaryCond.component ( j ) * totalDof + offset;
-
-                idDofVec.push_back ( idDof );
-                datumVec.push_back ( diagonalizeCoef * boundaryCond ( boundaryCond[ i ] ->id(), boundaryCond.component ( j ) ) );
-            }
-        }
-    }
-    else
-    {
-        //! If BC is given under a functional form
-
-        DataType x, y, z;
-        // Loop on BC identifiers
-        for ( ID i = 0; i < boundaryCond.list_size(); ++i )
-        {
-            // Coordinates of the node where we impose the value
-            x = static_cast< const BCIdentifierEssential* > ( boundaryCond[ i ] ) ->x();
-            y = static_cast< const BCIdentifierEssential* > ( boundaryCond[ i ] ) ->y();
-            z = static_cast< const BCIdentifierEssential* > ( boundaryCond[ i ] ) ->z();
-
-            // Loop on components involved in this boundary condition
-            for ( ID j = 0; j < nComp; ++j )
-            {
-                // Global Dof
-
-                idDof = boundaryCond[ i ] ->id() + boundaryCond.component ( j ) * totalDof + offset;
-                // Modifying right hand side
-                idDofVec.push_back (idDof);
-                datumVec.push_back ( diagonalizeCoef * boundaryCond ( time, x, y, z, boundaryCond.component ( j ) ) );
-            }
-        }
+        datumVec[ i ] *= diagonalizeCoef;
     }
 
     rightHandSide.setCoefficients ( idDofVec, datumVec);
@@ -1522,63 +1505,16 @@ bcEssentialManageResidual (VectorType&     res,
         return;
     }
 
-    ID idDof;
-    UInt totalDof;
-
-    // Number of total scalar Dof
-    totalDof = dof.numTotalDof();
-
-    // Number of components involved in this boundary condition
-    UInt nComp = boundaryCond.numberOfComponents();
-
-    std::vector<int>   idDofVec (0);
-    idDofVec.reserve (boundaryCond.list_size() *nComp);
-    std::vector<Real> datumVec (0);
-    datumVec.reserve (boundaryCond.list_size() *nComp);
-    std::vector<Real> rhsVec (0);
-    rhsVec.reserve (boundaryCond.list_size() *nComp);
+    std::vector<ID>   idDofs;
+    std::vector<Real> rhsVec;
+    bcEssentialDofsAndData ( boundaryCond, dof.numTotalDof(), offset, time, idDofs, rhsVec );
 
-    if ( boundaryCond.isDataAVector() )
-    {
-        //! If BC is given under a vectorial form
-        // Loop on BC identifiers
-        for ( ID i = 0; i < boundaryCond.list_size(); ++i )
-        {
-            // Loop on components involved in this boundary condition
-            for ( ID j = 0; j < nComp; ++j )
-            {
-                // Global Dof
-                idDof = boundaryCond[ i ] ->id() + boundaryCond.component ( j ) * totalDof + offset;
-                idDofVec.push_back ( idDof );
-                datumVec.push_back ( diagonalizeCoef * sol (idDof) );
-                rhsVec.push_back (diagonalizeCoef * boundaryCond ( boundaryCond[ i ] ->id(), boundaryCond.component ( j ) ) );
-            }
-        }
-    }
-    else
+    std::vector<int>  idDofVec ( idDofs.begin(), idDofs.end() );
+    std::vector<Real> datumVec ( idDofs.size() );
+    for ( UInt i = 0; i < idDofs.size(); ++i )
     {
-        //! If BC is given under a functional form
-        DataType x, y, z;
-        // Loop on BC identifiers
-        for ( ID i = 0; i < boundaryCond.list_size(); ++i )
-        {
-            // Coordinates of the node where we impose the value
-            x = static_cast< const BCIdentifierEssential* > ( boundaryCond[ i ] ) ->x();
-            y = static_cast< const BCIdentifierEssential* > ( boundaryCond[ i ] ) ->y();
-            z = static_cast< const BCIdentifierEssential* > ( boundaryCond[ i ] ) ->z();
-
-            // Loop on components involved in this boundary condition
-            for ( ID j = 0; j < nComp; ++j )
-            {
-                // Global Dof
-
-                idDof = boundaryCond[ i ] ->id() + boundaryCond.component ( j ) * totalDof + offset;
-                // Modifying right hand side
-                idDofVec.push_back (idDof);
-                datumVec.push_back ( diagonalizeCoef * sol (idDof) );
-                rhsVec.push_back (diagonalizeCoef * boundaryCond ( time, x, y, z, boundaryCond.component ( j ) ) );
-            }
-        }
+        datumVec[ i ] = diagonalizeCoef * sol ( idDofs[ i ] );
+        rhsVec[ i ] *= diagonalizeCoef;
     }
 
     res.setCoefficients ( idDofVec, datumVec);
@@ -44,35 +44,28 @@
 
 #include <boost/shared_ptr.hpp>
 
+#include <vector>
+
 namespace LifeV
 {
 
 namespace GradientRecovery
 {
 
-/*! Gradient recovery procedure from Zienkiewicz and Zhu.
+/*! Quadrature rule having the nodes of the reference element as quadrature points.
 
-  @param fespace The finite element space describing the data
-  @param inputData The vector of data (pass it as repeated if possible)
-  @param dxi The component to be recovered
-  @return recovered gradient (unique map!)
+  It is used by the ZZ recovery procedures, so that values in the QR correspond to
+  the values in the nodes.
 
+  @param refFE The reference finite element
+  @return the quadrature rule
  */
-template<typename FESpaceType, typename VectorType>
-VectorType ZZGradient (boost::shared_ptr<FESpaceType> fespace,
-                       const VectorType& inputData,
-                       const UInt& dxi)
+inline QuadratureRule ZZInterpolationQuadRule (const ReferenceFE& refFE)
 {
-    // Repeated vector is needed
-    if (inputData.mapType() != Repeated)
-    {
-        return ZZGradient (fespace, VectorType (inputData, Repeated), dxi);
-    };
-
     // Get the area of the reference element
     Real refElemArea (0);
 
-    switch ( fespace->refFE().shape() )
+    switch ( refFE.shape() )
     {
         case TETRA:
             refElemArea = 1.0 / 6.0;
@@ -100,23 +93,47 @@ VectorType ZZGradient (boost::shared_ptr<FESpaceType> fespace,
             std::abort();
     }
 
-    // Define the specific QR to be used
-    // so that values in the QR correspond to
-    // the values in the nodes
-
     QuadratureRule interpQuad;
-    interpQuad.setDimensionShape ( shapeDimension (fespace->refFE().shape() ) , fespace->refFE().shape() );
+    interpQuad.setDimensionShape ( shapeDimension (refFE.shape() ) , refFE.shape() );
 
-    Real wQuad (refElemArea / fespace->refFE().nbDof() );
+    Real wQuad (refElemArea / refFE.nbDof() );
 
-    for (UInt iQuadPt (0); iQuadPt < fespace->refFE().nbDof(); ++ iQuadPt)
+    for (UInt iQuadPt (0); iQuadPt < refFE.nbDof(); ++ iQuadPt)
     {
-        interpQuad.addPoint (QuadraturePoint ( fespace->refFE().xi (iQuadPt),
-                                               fespace->refFE().eta (iQuadPt),
-                                               fespace->refFE().zeta (iQuadPt),
+        interpQuad.addPoint (QuadraturePoint ( refFE.xi (iQuadPt),
+                                               refFE.eta (iQuadPt),
+                                               refFE.zeta (iQuadPt),
                                                wQuad) );
     }
 
+    return interpQuad;
+}
+
+/*! Gradient recovery procedure from Zienkiewicz and Zhu.
+
+  @param fespace The finite element space describing the data
+  @param inputData The vector of data (pass it as repeated if possible)
+  @param dxi The component to be recovered
+  @return recovered gradient (unique map!)
+
+ */
+template<typename FESpaceType, typename VectorType>
+VectorType ZZGradient (boost::shared_ptr<FESpaceType> fespace,
+                       const VectorType& inputData,
+                       const UInt& dxi)
+{
+    // Repeated vector is needed
+    if (inputData.mapType() != Repeated)
+    {
+        return ZZGradient (fespace, VectorType (inputData, Repeated), dxi);
+    };
+
+    // Define the specific QR to be used
+    // so that values in the QR correspond to
+    // the values in the nodes
+
+    QuadratureRule interpQuad ( ZZInterpolationQuadRule ( fespace->refFE() ) );
+
     // Initialization of the two vectors
 
     VectorType patchArea ( inputData, Repeated );
@@ -166,6 +183,123 @@ VectorType ZZGradient (boost::shared_ptr<FESpaceType> fespace,
 }
 
 
+/*! Gradient recovery procedure from Zienkiewicz and Zhu, all the components at once.
+
+  The derivatives with respect to all the coordinates are recovered with a single
+  loop over the elements, instead of calling ZZGradient once per coordinate.
+  The measure of the patches depends only on the mesh: if patchMeasure is empty
+  it is computed during the loop and stored, so that the following calls on the
+  same mesh can skip it. Reset patchMeasure whenever the mesh moves.
+
+  @param fespace The finite element space describing the data
+  @param inputData The vector of data (pass it as repeated if possible)
+  @param gradient The recovered gradient, gradient[dxi] is the derivative with respect to dxi (unique map!)
+  @param patchMeasure Cache for the measure of the patches (unique map)
+ */
+template<typename FESpaceType, typename VectorType>
+void ZZFullGradient (boost::shared_ptr<FESpaceType> fespace,
+                     const VectorType& inputData,
+                     std::vector< boost::shared_ptr<VectorType> >& gradient,
+                     boost::shared_ptr<VectorType>& patchMeasure)
+{
+    // Repeated vector is needed
+    if (inputData.mapType() != Repeated)
+    {
+        ZZFullGradient (fespace, VectorType (inputData, Repeated), gradient, patchMeasure);
+        return;
+    }
+
+    QuadratureRule interpQuad ( ZZInterpolationQuadRule ( fespace->refFE() ) );
+
+    CurrentFE interpCFE ( fespace->refFE(), getGeometricMap (*fespace->mesh() ), interpQuad );
+
+    const UInt nbElement (fespace->mesh()->numElements() );
+    const UInt nbLocalDof (fespace->dof().numLocalDof() );
+    const UInt nbCoor (interpCFE.nbLocalCoor() );
+    const UInt fieldDim (fespace->fieldDim() );
+    const bool computePatchMeasure (!patchMeasure);
+
+    // Initialization of the vectors
+
+    VectorType patchArea ( inputData, Repeated );
+    patchArea *= 0.0;
+
+    std::vector<VectorType> gradientSum (nbCoor, patchArea);
+
+    std::vector<UInt> globalDofID (nbLocalDof);
+    std::vector<Real> localData (nbLocalDof);
+
+    // Now loop over the elements
+
+    for (UInt iElement (0); iElement < nbElement; ++iElement)
+    {
+        interpCFE.update ( fespace->mesh()->element (iElement), UPDATE_DPHI | UPDATE_WDET);
+
+        const Real measure (interpCFE.measure() );
+
+        for (UInt iDim (0); iDim < fieldDim; ++iDim)
+        {
+            // Gather the local values of this component
+            for (UInt iDof (0); iDof < nbLocalDof; ++iDof)
+            {
+                globalDofID[iDof] = fespace->dof().localToGlobalMap (iElement, iDof)
+                                    + iDim * fespace->dof().numTotalDof();
+                localData[iDof] = inputData[globalDofID[iDof]];
+            }
+
+            for (UInt iDof (0); iDof < nbLocalDof; ++iDof)
+            {
+                if (computePatchMeasure)
+                {
+                    patchArea[globalDofID[iDof]] += measure;
+                }
+
+                for (UInt iCoor (0); iCoor < nbCoor; ++iCoor)
+                {
+                    Real localGradient (0);
+                    for (UInt jDof (0); jDof < nbLocalDof; ++jDof)
+                    {
+                        localGradient += localData[jDof] * interpCFE.dphi (jDof, iCoor, iDof);
+                    }
+                    gradientSum[iCoor][globalDofID[iDof]] += measure * localGradient;
+                }
+            }
+        }
+    }
+
+    // Assembly
+
+    if (computePatchMeasure)
+    {
+        patchMeasure.reset (new VectorType (patchArea, Unique, Add) );
+    }
+
+    gradient.resize (nbCoor);
+    for (UInt iCoor (0); iCoor < nbCoor; ++iCoor)
+    {
+        gradient[iCoor].reset (new VectorType (VectorType (gradientSum[iCoor], Unique, Add) / *patchMeasure) );
+    }
+}
+
+
+/*! Gradient recovery procedure from Zienkiewicz and Zhu, all the components at once.
+
+  Same as above, without caching the measure of the patches.
+
+  @param fespace The finite element space describing the data
+  @param inputData The vector of data (pass it as repeated if possible)
+  @param gradient The recovered gradient, gradient[dxi] is the derivative with respect to dxi (unique map!)
+ */
+template<typename FESpaceType, typename VectorType>
+void ZZFullGradient (boost::shared_ptr<FESpaceType> fespace,
+                     const VectorType& inputData,
+                     std::vector< boost::shared_ptr<VectorType> >& gradient)
+{
+    boost::shared_ptr<VectorType> patchMeasure;
+    ZZFullGradient (fespace, inputData, gradient, patchMeasure);
+}
+
+
 /*! Laplacian recovery following Zienkiewicz and Zhu.
 
   @param fespace The finite element space describing the data
@@ -50,6 +50,7 @@
 #include <lifev/core/LifeV.hpp>
 
 #include <lifev/core/util/StringUtility.hpp>
+#include <lifev/core/filter/MeshFileTokenizer.hpp>
 
 #include <lifev/core/mesh/MeshElementBare.hpp>
 
@@ -1022,7 +1023,7 @@ readGmshFile ( RegionMesh<GeoShape, MC>& mesh,
 
     const int idOffset = 1; //IDs in GMESH files start from 1
 
-    std::ifstream inputFile ( fileName.c_str() );
+    MeshFileTokenizer inputFile ( fileName );
 
 #ifdef HAVE_LIFEV_DEBUG
     debugStream ( 8000 ) << "Gmsh reading: " << fileName << "\n";
@@ -1033,12 +1034,11 @@ readGmshFile ( RegionMesh<GeoShape, MC>& mesh,
 
     for (Int ii = 0; ii < 6; ++ii)
     {
-        inputFile >> buffer;
+        buffer = inputFile.nextWord();
         std::cout << "buffer = " << buffer << "\n";
     }
 
-    UInt numberNodes;
-    inputFile >> numberNodes;
+    UInt numberNodes = inputFile.nextUInt();
 
 #ifdef HAVE_LIFEV_DEBUG
     debugStream ( 8000 ) << "Number of nodes = " << numberNodes;
@@ -1056,32 +1056,35 @@ readGmshFile ( RegionMesh<GeoShape, MC>& mesh,
     debugStream ( 8000 ) << "Reading " << numberNodes << " nodes\n";
 #endif
 
-    std::map<Int, Int> itoii;
+    // Node numbers go from 1 to numberNodes: a vector is enough
+    std::vector<Int> itoii ( numberNodes, -1 );
 
     for ( UInt i = 0; i < numberNodes; ++i )
     {
-        UInt ni;
-        inputFile >> ni
-                  >> x[ 3 * i ]
-                  >> x[ 3 * i + 1 ]
-                  >> x[ 3 * i + 2 ];
+        const Int ni = inputFile.nextInt() - idOffset;
+        x[ 3 * i ]     = inputFile.nextReal();
+        x[ 3 * i + 1 ] = inputFile.nextReal();
+        x[ 3 * i + 2 ] = inputFile.nextReal();
 
-        itoii[ ni - idOffset] = i;
+        if ( ni < 0 || ni >= static_cast<Int> ( numberNodes ) )
+        {
+            ERROR_MSG ( "Gmsh reading: node number " + number2string ( ni + idOffset ) + " out of range in " + fileName );
+        }
+        itoii[ ni ] = i;
     }
-    inputFile >> buffer;
+    buffer = inputFile.nextWord();
 
 #ifdef HAVE_LIFEV_DEBUG
     debugStream ( 8000 ) << "buffer = " << buffer << "\n";
 #endif
 
-    inputFile >> buffer;
+    buffer = inputFile.nextWord();
 
 #ifdef HAVE_LIFEV_DEBUG
     debugStream ( 8000 ) << "buffer = " << buffer << "\n";
 #endif
 
-    UInt numberElements;
-    inputFile >> numberElements;
+    UInt numberElements = inputFile.nextUInt();
 
     typename mesh_Type::edge_Type*    pointerEdge   = 0;
     typename mesh_Type::face_Type*    pointerFace   = 0;
@@ -1091,7 +1094,10 @@ readGmshFile ( RegionMesh<GeoShape, MC>& mesh,
     debugStream ( 8000 ) << "number of elements: " << numberElements << "\n";
 #endif
 
-    std::vector<std::vector<int> > e ( numberElements );
+    // Element connectivities, stored contiguously
+    std::vector<int>               e;
+    std::vector<UInt>              eOffset ( numberElements + 1, 0 );
+    e.reserve ( 4 * numberElements );
     std::vector<int>               et ( numberElements );
     std::vector<int>               etype ( numberElements );
     std::vector<int>               gt ( 32 );
@@ -1101,8 +1107,8 @@ readGmshFile ( RegionMesh<GeoShape, MC>& mesh,
     {
         Int ne, t, np;
 
-        inputFile >> buffer;
-        inputFile >> ne;
+        inputFile.nextInt();
+        ne = inputFile.nextInt();
 
         switch ( ne )
         {
@@ -1128,7 +1134,7 @@ readGmshFile ( RegionMesh<GeoShape, MC>& mesh,
                 ASSERT ( true, "Elements type unsupported.\n" )
         }
 
-        inputFile >> t;
+        t = inputFile.nextInt();
 
         //std::debug() << t << " ";
 
@@ -1138,7 +1144,7 @@ readGmshFile ( RegionMesh<GeoShape, MC>& mesh,
 
         for ( Int iflag = 0; iflag < t; ++iflag )
         {
-            inputFile >> flag;
+            flag = inputFile.nextInt();
 
             if ( !ibcSet )
             {
@@ -1152,17 +1158,18 @@ readGmshFile ( RegionMesh<GeoShape, MC>& mesh,
         etype[ i ] = ne;
 
         et[ i ] = tag;
-        e[ i ].resize ( np );
-
-        Int p = 0;
 
-        while ( p != np )
+        for ( Int p = 0; p < np; ++p )
         {
-            Int node;
-            inputFile >> node;
-            e[ i ][ p ] = itoii[ node - idOffset ];
-            ++p;
+            const Int node = inputFile.nextInt() - idOffset;
+            if ( node < 0 || node >= static_cast<Int> ( numberNodes ) || itoii[ node ] < 0 )
+            {
+                ERROR_MSG ( "Gmsh reading: element " + number2string ( i + idOffset ) + " refers to the undefined node "
+                            + number2string ( node + idOffset ) + " in " + fileName );
+            }
+            e.push_back ( itoii[ node ] );
         }
+        eOffset[ i + 1 ] = e.size();
     }
 
 
@@ -1211,13 +1218,13 @@ readGmshFile ( RegionMesh<GeoShape, MC>& mesh,
                 // triangular faces (linear)
             case 2:
             {
-                isonboundary[ e[ i ][ 0 ] ] = true;
-                isonboundary[ e[ i ][ 1 ] ] = true;
-                isonboundary[ e[ i ][ 2 ] ] = true;
+                isonboundary[ e[ eOffset[ i ] + 0 ] ] = true;
+                isonboundary[ e[ eOffset[ i ] + 1 ] ] = true;
+                isonboundary[ e[ eOffset[ i ] + 2 ] ] = true;
 
-                whichboundary[ e[ i ][ 0 ] ] = et[ i ];
-                whichboundary[ e[ i ][ 1 ] ] = et[ i ];
-                whichboundary[ e[ i ][ 2 ] ] = et[ i ];
+                whichboundary[ e[ eOffset[ i ] + 0 ] ] = et[ i ];
+                whichboundary[ e[ eOffset[ i ] + 1 ] ] = et[ i ];
+                whichboundary[ e[ eOffset[ i ] + 2 ] ] = et[ i ];
             }
         }
     }
@@ -1257,8 +1264,8 @@ readGmshFile ( RegionMesh<GeoShape, MC>& mesh,
                 pointerEdge = & ( mesh.addEdge ( true ) );
                 pointerEdge->setMarkerID ( markerID_Type ( et[ i ] ) );
                 pointerEdge->setId ( i );
-                pointerEdge->setPoint ( 0, mesh.point ( e[ i ][ 0 ] ) );
-                pointerEdge->setPoint ( 1, mesh.point ( e[ i ][ 1 ] ) );
+                pointerEdge->setPoint ( 0, mesh.point ( e[ eOffset[ i ] + 0 ] ) );
+                pointerEdge->setPoint ( 1, mesh.point ( e[ eOffset[ i ] + 1 ] ) );
 
 
 
@@ -1271,9 +1278,9 @@ readGmshFile ( RegionMesh<GeoShape, MC>& mesh,
                 pointerFace = & ( mesh.addFace ( true ) );
                 pointerFace->setMarkerID ( markerID_Type ( et[ i ] ) );
                 pointerFace->setId ( i );
-                pointerFace->setPoint ( 0, mesh.point ( e[ i ][ 0 ] ) );
-                pointerFace->setPoint ( 1, mesh.point ( e[ i ][ 1 ] ) );
-                pointerFace->setPoint ( 2, mesh.point ( e[ i ][ 2 ] ) );
+                pointerFace->setPoint ( 0, mesh.point ( e[ eOffset[ i ] + 0 ] ) );
+                pointerFace->setPoint ( 1, mesh.point ( e[ eOffset[ i ] + 1 ] ) );
+                pointerFace->setPoint ( 2, mesh.point ( e[ eOffset[ i ] + 2 ] ) );
 
             }
             break;
@@ -1284,10 +1291,10 @@ readGmshFile ( RegionMesh<GeoShape, MC>& mesh,
                 pointerFace = & ( mesh.addFace ( true ) );
                 pointerFace->setMarkerID ( markerID_Type ( et[ i ] ) );
                 pointerFace->setId ( i );
-                pointerFace->setPoint ( 0, mesh.point ( e[ i ][ 0 ] ) );
-                pointerFace->setPoint ( 1, mesh.point ( e[ i ][ 1 ] ) );
-                pointerFace->setPoint ( 2, mesh.point ( e[ i ][ 2 ] ) );
-                pointerFace->setPoint ( 3, mesh.point ( e[ i ][ 3 ] ) );
+                pointerFace->setPoint ( 0, mesh.point ( e[ eOffset[ i ] + 0 ] ) );
+                pointerFace->setPoint ( 1, mesh.point ( e[ eOffset[ i ] + 1 ] ) );
+                pointerFace->setPoint ( 2, mesh.point ( e[ eOffset[ i ] + 2 ] ) );
+                pointerFace->setPoint ( 3, mesh.point ( e[ eOffset[ i ] + 3 ] ) );
             }
             break;
 
@@ -1297,10 +1304,10 @@ readGmshFile ( RegionMesh<GeoShape, MC>& mesh,
                 pointerVolume = & ( mesh.addVolume() );
                 pointerVolume->setId ( i );
                 pointerVolume->setMarkerID ( markerID_Type ( et[ i ] ) );
-                pointerVolume->setPoint ( 0, mesh.point ( e[ i ][ 0 ] ) );
-                pointerVolume->setPoint ( 1, mesh.point ( e[ i ][ 1 ] ) );
-                pointerVolume->setPoint ( 2, mesh.point ( e[ i ][ 2 ] ) );
-                pointerVolume->setPoint ( 3, mesh.point ( e[ i ][ 3 ] ) );
+                pointerVolume->setPoint ( 0, mesh.point ( e[ eOffset[ i ] + 0 ] ) );
+                pointerVolume->setPoint ( 1, mesh.point ( e[ eOffset[ i ] + 1 ] ) );
+                pointerVolume->setPoint ( 2, mesh.point ( e[ eOffset[ i ] + 2 ] ) );
+                pointerVolume->setPoint ( 3, mesh.point ( e[ eOffset[ i ] + 3 ] ) );
             }
             break;
 
@@ -1311,14 +1318,14 @@ readGmshFile ( RegionMesh<GeoShape, MC>& mesh,
 
                 pointerVolume->setId ( i );
                 pointerVolume->setMarkerID ( markerID_Type ( et[ i ] ) );
-                pointerVolume->setPoint ( 0, mesh.point ( e[ i ][ 0 ] ) );
-                pointerVolume->setPoint ( 1, mesh.point ( e[ i ][ 1 ] ) );
-                pointerVolume->setPoint ( 2, mesh.point ( e[ i ][ 2 ] ) );
-                pointerVolume->setPoint ( 3, mesh.point ( e[ i ][ 3 ] ) );
-                pointerVolume->setPoint ( 4, mesh.point ( e[ i ][ 4 ] ) );
-                pointerVolume->setPoint ( 5, mesh.point ( e[ i ][ 5 ] ) );
-                pointerVolume->setPoint ( 6, mesh.point ( e[ i ][ 6 ] ) );
-                pointerVolume->setPoint ( 7, mesh.point ( e[ i ][ 7 ] ) );
+                pointerVolume->setPoint ( 0, mesh.point ( e[ eOffset[ i ] + 0 ] ) );
+                pointerVolume->setPoint ( 1, mesh.point ( e[ eOffset[ i ] + 1 ] ) );
+                pointerVolume->setPoint ( 2, mesh.point ( e[ eOffset[ i ] + 2 ] ) );
+                pointerVolume->setPoint ( 3, mesh.point ( e[ eOffset[ i ] + 3 ] ) );
+                pointerVolume->setPoint ( 4, mesh.point ( e[ eOffset[ i ] + 4 ] ) );
+                pointerVolume->setPoint ( 5, mesh.point ( e[ eOffset[ i ] + 5 ] ) );
+                pointerVolume->setPoint ( 6, mesh.point ( e[ eOffset[ i ] + 6 ] ) );
+                pointerVolume->setPoint ( 7, mesh.point ( e[ eOffset[ i ] + 7 ] ) );
             }
             break;
         }
@@ -0,0 +1,332 @@
+//@HEADER
+/*
+*******************************************************************************
+
+Copyright (C) 2004, 2005, 2007 EPFL, Politecnico di Milano, INRIA
+Copyright (C) 2010, 2011, 2012 EPFL, Politecnico di Milano, Emory University
+
+This file is part of LifeV.
+
+LifeV is free software; you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+LifeV is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with LifeV.  If not, see <http://www.gnu.org/licenses/>.
+
+*******************************************************************************
+*/
+//@HEADER
+
+/*!
+  @file
+  @brief Memory mapped tokenizer for ASCII mesh files
+
+  @date 19-10-2026
+*/
+
+#include <lifev/core/filter/MeshFileTokenizer.hpp>
+
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+
+// Memory mapping is only used on POSIX systems, elsewhere the file is read with std::ifstream
+#if defined(__unix__) || defined(__APPLE__)
+#define LIFEV_MESH_FILE_TOKENIZER_MMAP
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+namespace LifeV
+{
+
+namespace
+{
+// Powers of ten exactly representable as double
+const Real S_exactPowersOfTen[] =
+{
+    1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10,
+    1e11, 1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+};
+
+inline bool isSpace ( const char c )
+{
+    return c == ' ' || c == '\n' || c == '\t' || c == '\r' || c == '\f' || c == '\v';
+}
+
+inline bool isDigit ( const char c )
+{
+    return c >= '0' && c <= '9';
+}
+
+inline bool isComment ( const char c )
+{
+    return c == '!' || c == '%' || c == '#' || c == ';' || c == '$';
+}
+
+// Read the whole file in the buffer
+bool readFile ( const std::string& fileName, std::vector<char>& buffer )
+{
+    std::ifstream file ( fileName.c_str(), std::ios::in | std::ios::binary );
+    if ( !file )
+    {
+        return false;
+    }
+    file.seekg ( 0, std::ios::end );
+    const std::streamoff size = file.tellg();
+    file.seekg ( 0, std::ios::beg );
+
+    buffer.resize ( size > 0 ? static_cast<std::size_t> ( size ) : 0 );
+    if ( !buffer.empty() )
+    {
+        file.read ( &buffer[ 0 ], buffer.size() );
+        buffer.resize ( static_cast<std::size_t> ( file.gcount() ) );
+    }
+    return true;
+}
+} // anonymous namespace
+
+// ===================================================
+// Constructor & Destructor
+// ===================================================
+
+MeshFileTokenizer::MeshFileTokenizer ( const std::string& fileName ) :
+    M_begin    ( 0 ),
+    M_end      ( 0 ),
+    M_position ( 0 ),
+    M_map      ( 0 ),
+    M_mapSize  ( 0 ),
+    M_buffer   ()
+{
+#ifdef LIFEV_MESH_FILE_TOKENIZER_MMAP
+    const int fileDescriptor = open ( fileName.c_str(), O_RDONLY );
+    if ( fileDescriptor >= 0 )
+    {
+        struct stat fileStatus;
+        if ( fstat ( fileDescriptor, &fileStatus ) == 0 && fileStatus.st_size > 0 )
+        {
+            const std::size_t mapSize = static_cast<std::size_t> ( fileStatus.st_size );
+            void* map = mmap ( 0, mapSize, PROT_READ, MAP_PRIVATE, fileDescriptor, 0 );
+            if ( map != MAP_FAILED )
+            {
+#ifdef MADV_SEQUENTIAL
+                madvise ( map, mapSize, MADV_SEQUENTIAL );
+#endif
+                M_map = map;
+                M_mapSize = mapSize;
+                M_begin = static_cast<const char*> ( map );
+                M_end = M_begin + M_mapSize;
+            }
+        }
+        close ( fileDescriptor );
+    }
+#endif
+
+    // Mapping not available: read the whole file at once
+    if ( !M_map && readFile ( fileName, M_buffer ) && !M_buffer.empty() )
+    {
+        M_begin = &M_buffer[ 0 ];
+        M_end = M_begin + M_buffer.size();
+    }
+
+    M_position = M_begin;
+}
+
+MeshFileTokenizer::~MeshFileTokenizer()
+{
+#ifdef LIFEV_MESH_FILE_TOKENIZER_MMAP
+    if ( M_map )
+    {
+        munmap ( M_map, M_mapSize );
+    }
+#endif
+}
+
+// ===================================================
+// Public Methods
+// ===================================================
+
+bool
+MeshFileTokenizer::nextGoodLine ( std::string& line )
+{
+    // Skip the rest of the current line if we are in the middle of it
+    // (e.g. after reading the last number of a section)
+    while ( M_position < M_end && ( *M_position == ' ' || *M_position == '\t' || *M_position == '\r' ) )
+    {
+        ++M_position;
+    }
+    if ( M_position < M_end && *M_position == '\n' )
+    {
+        ++M_position;
+    }
+
+    while ( M_position < M_end && isComment ( *M_position ) )
+    {
+        while ( M_position < M_end && *M_position++ != '\n' )
+        {}
+    }
+
+    if ( M_position >= M_end )
+    {
+        line.clear();
+        return false;
+    }
+
+    const char* lineBegin = M_position;
+    while ( M_position < M_end && *M_position != '\n' )
+    {
+        ++M_position;
+    }
+    line.assign ( lineBegin, M_position );
+    if ( M_position < M_end )
+    {
+        ++M_position;
+    }
+    return true;
+}
+
+std::string
+MeshFileTokenizer::nextWord()
+{
+    skipSpaces();
+    const char* wordBegin = M_position;
+    while ( M_position < M_end && !isSpace ( *M_position ) )
+    {
+        ++M_position;
+    }
+    return std::string ( wordBegin, M_position );
+}
+
+Int
+MeshFileTokenizer::nextInt()
+{
+    skipSpaces();
+
+    bool negative ( false );
+    if ( M_position < M_end && ( *M_position == '-' || *M_position == '+' ) )
+    {
+        negative = ( *M_position == '-' );
+        ++M_position;
+    }
+
+    Int value ( 0 );
+    while ( M_position < M_end && isDigit ( *M_position ) )
+    {
+        value = 10 * value + ( *M_position - '0' );
+        ++M_position;
+    }
+    return negative ? -value : value;
+}
+
+Real
+MeshFileTokenizer::nextReal()
+{
+    skipSpaces();
+
+    const char* numberBegin = M_position;
+
+    bool negative ( false );
+    if ( M_position < M_end && ( *M_position == '-' || *M_position == '+' ) )
+    {
+        negative = ( *M_position == '-' );
+        ++M_position;
+    }
+
+    // Significant digits as an integer and decimal exponent
+    uint64_type mantissa ( 0 );
+    Int numDigits ( 0 );
+    Int exponent ( 0 );
+
+    while ( M_position < M_end && isDigit ( *M_position ) )
+    {
+        if ( mantissa != 0 || *M_position != '0' )
+        {
+            mantissa = 10 * mantissa + ( *M_position - '0' );
+            ++numDigits;
+        }
+        ++M_position;
+    }
+    if ( M_position < M_end && *M_position == '.' )
+    {
+        ++M_position;
+        while ( M_position < M_end && isDigit ( *M_position ) )
+        {
+            if ( mantissa != 0 || *M_position != '0' )
+            {
+                mantissa = 10 * mantissa + ( *M_position - '0' );
+                ++numDigits;
+            }
+            --exponent;
+            ++M_position;
+        }
+    }
+    if ( M_position < M_end && ( *M_position == 'e' || *M_position == 'E' || *M_position == 'd' || *M_position == 'D' ) )
+    {
+        ++M_position;
+
+        // The exponent follows immediately, without spaces
+        bool negativeExponent ( false );
+        if ( M_position < M_end && ( *M_position == '-' || *M_position == '+' ) )
+        {
+            negativeExponent = ( *M_position == '-' );
+            ++M_position;
+        }
+        Int exponentValue ( 0 );
+        while ( M_position < M_end && isDigit ( *M_position ) )
+        {
+            exponentValue = 10 * exponentValue + ( *M_position - '0' );
+            ++M_position;
+        }
+        exponent += negativeExponent ? -exponentValue : exponentValue;
+    }
+
+    // Fast path: the mantissa and the power of ten are exact doubles,
+    // so that the result is correctly rounded
+    if ( numDigits <= 15 && exponent >= -22 && exponent <= 22 )
+    {
+        const Real value = exponent < 0 ? static_cast<Real> ( mantissa ) / S_exactPowersOfTen[ -exponent ]
+                                        : static_cast<Real> ( mantissa ) * S_exactPowersOfTen[ exponent ];
+        return negative ? -value : value;
+    }
+
+    // Slow path: let strtod deal with it
+    const std::string number ( numberBegin, M_position );
+    return std::strtod ( number.c_str(), 0 );
+}
+
+Int
+MeshFileTokenizer::nextIntField ( const std::string& line )
+{
+    for ( std::string::const_iterator is = line.begin(); is != line.end(); ++is )
+    {
+        if ( *is != ' ' )
+        {
+            return std::atoi ( line.c_str() );
+        }
+    }
+    return nextInt();
+}
+
+// ===================================================
+// Private Methods
+// ===================================================
+
+void
+MeshFileTokenizer::skipSpaces()
+{
+    while ( M_position < M_end && isSpace ( *M_position ) )
+    {
+        ++M_position;
+    }
+}
+
+} // namespace LifeV
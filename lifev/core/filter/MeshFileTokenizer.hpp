@@ -0,0 +1,146 @@
+//@HEADER
+/*
+*******************************************************************************
+
+Copyright (C) 2004, 2005, 2007 EPFL, Politecnico di Milano, INRIA
+Copyright (C) 2010, 2011, 2012 EPFL, Politecnico di Milano, Emory University
+
+This file is part of LifeV.
+
+LifeV is free software; you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+LifeV is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with LifeV.  If not, see <http://www.gnu.org/licenses/>.
+
+*******************************************************************************
+*/
+//@HEADER
+
+/*!
+  @file
+  @brief Memory mapped tokenizer for ASCII mesh files
+
+  @date 19-10-2026
+*/
+
+#ifndef MESH_FILE_TOKENIZER_H_
+#define MESH_FILE_TOKENIZER_H_
+
+#include <lifev/core/LifeV.hpp>
+
+#include <string>
+#include <vector>
+
+namespace LifeV
+{
+
+/*!
+  @brief Memory mapped tokenizer for ASCII mesh files
+
+  The file is mapped in memory on POSIX systems (elsewhere, or when the
+  mapping fails, it is read at once with std::ifstream) and parsed in place: numbers are converted
+  directly from the file buffer, without going through std::istream and
+  without any allocation. It replaces the std::ifstream based parsing of
+  the mesh readers, which dominates the loading time of large meshes.
+
+  Usage:
+      - construct the tokenizer with the name of the file, check isOpen()
+      - use nextGoodLine() to look for the section keywords
+      - use nextInt(), nextUInt() and nextReal() to read the numeric fields
+*/
+class MeshFileTokenizer
+{
+public:
+    //! @name Constructors and Destructor
+    //@{
+    //! Constructor
+    /*!
+     * \param fileName the name of the file to be read
+     */
+    explicit MeshFileTokenizer ( const std::string& fileName );
+
+    //! Destructor, unmaps the file
+    virtual ~MeshFileTokenizer();
+    //@}
+
+    //! @name Public Methods
+    //@{
+    //! Read the next line which is not a comment
+    /*!
+     * Lines starting with one of the characters !%#;$ are skipped,
+     * consistently with nextGoodLine() in StringUtility.
+     * \param line the line read (output parameter)
+     * \return false if the end of the file is reached
+     */
+    bool nextGoodLine ( std::string& line );
+
+    //! Read the next whitespace separated word
+    std::string nextWord();
+
+    //! Read the next integer
+    Int nextInt();
+
+    //! Read the next unsigned integer
+    UInt nextUInt()
+    {
+        return static_cast<UInt> ( nextInt() );
+    }
+
+    //! Read the next real number
+    /*!
+     * Numbers with up to 15 significant digits and a small exponent are
+     * converted exactly with integer arithmetic, the others with strtod.
+     */
+    Real nextReal();
+
+    //! Read the integer in the remaining part of a line or, if it is empty, from the file
+    /*!
+     * \param line the remaining part of the line
+     */
+    Int nextIntField ( const std::string& line );
+    //@}
+
+    //! @name Get Methods
+    //@{
+    //! True if the file has been opened
+    bool isOpen() const
+    {
+        return M_begin != 0;
+    }
+
+    //! True if the end of the file has not been reached
+    bool good() const
+    {
+        return M_position < M_end;
+    }
+    //@}
+
+private:
+    //! @name Private Methods
+    //@{
+    MeshFileTokenizer ( const MeshFileTokenizer& );
+    MeshFileTokenizer& operator= ( const MeshFileTokenizer& );
+
+    void skipSpaces();
+    //@}
+
+    const char*        M_begin;
+    const char*        M_end;
+    const char*        M_position;
+
+    void*              M_map;
+    std::size_t        M_mapSize;
+    std::vector<char>  M_buffer;
+};
+
+} // namespace LifeV
+
+#endif // MESH_FILE_TOKENIZER_H_
@@ -31,6 +31,7 @@
 #include <lifev/core/LifeV.hpp>
 #include <lifev/core/mesh/BareMesh.hpp>
 #include <lifev/core/mesh/InternalEntitySelector.hpp>
+#include <lifev/core/filter/MeshFileTokenizer.hpp>
 
 #include <fstream>
 
@@ -40,250 +41,13 @@ namespace LifeV
 namespace MeshIO
 {
 
-namespace
-{
-
-// ===================================================
-// INRIA mesh readers
-// ===================================================
-
-//! nextIntINRIAMeshField -
-/*!
-  It gets an integer field from the std::string line
-  if it is not empty, otherwise from the input stream.
-  It assumes that the std::string is either empty or
-  it contains and integer. No check is made to verify this.
-
-  @param line, the mesh data structure to fill in.
-  @param myStream, the name of the mesh file  to read.
-  @return true if everything went fine, false otherwise.
-*/
-Int
-nextIntINRIAMeshField ( std::string const& line,
-                        std::istream&       myStream )
-{
-    /*
-     first control if line has something.
-     If so use atoi (the version from util_string.h)
-     to extract the integer.
-     Otherwise get if from the input stream
-     */
-
-    for ( std::string::const_iterator is = line.begin(); is != line.end(); ++is )
-    {
-        if ( *is != ' ' )
-        {
-            return atoi ( line );
-        }
-    }
-    Int dummy;
-    myStream >> dummy;
-
-    return dummy;
-}// Function nextIntINRIAMeshField
-
-//! readINRIAMeshFileHead - It Reads all basic info from INRIA MESH.
-/*!
-  It Reads all basic info from INRIA MESH file
-  so as to be able to properly dimension all arrays
-
-  @param myStream,
-  @param numberVertices,
-  @param numberBoundaryVertices,
-  @param numberBoundaryFaces,
-  @param numberBoundaryEdges,
-  @param numberVolumes,
-  @param numberStoredFaces,
-  @param shape,
-  @param iSelect,
-  @return false if mesh check is unsuccessfull.
-*/
-bool
-readINRIAMeshFileHead ( std::ifstream&           myStream,
-                        UInt&                    numberVertices,
-                        UInt&                    numberBoundaryVertices,
-                        UInt&                    numberBoundaryFaces,
-                        UInt&                    numberBoundaryEdges,
-                        UInt&                    numberVolumes,
-                        UInt&                    numberStoredFaces,
-                        ReferenceShapes&         shape,
-                        InternalEntitySelector   iSelect )
-{
-    const int idOffset = 1; //IDs in INRIA files start from 1
-
-    numberVertices = 0;
-    numberBoundaryVertices = 0;
-    numberBoundaryFaces = 0;
-    numberBoundaryEdges = 0;
-    numberVolumes = 0;
-    numberStoredFaces = 0;
-
-    std::string line;
-
-    Real x, y, z;
-
-    Int idummy;
-
-    UInt i, ibc;
-    UInt done = 0;
-    UInt p1, p2, p3, p4, p5, p6, p7, p8;
-    UInt numReadFaces = 0;
-    numberStoredFaces = 0;
-
-    //shape = NONE;
-    std::vector<bool> isboundary;
-    //streampos start=myStream.tellg();
-
-    while ( nextGoodLine ( myStream, line ).good() )
-    {
-        if ( line.find ( "MeshVersionFormatted" ) != std::string::npos )
-        {
-            idummy = nextIntINRIAMeshField ( line.substr ( line.find_last_of ( "d" ) + 1 ), myStream );
-            ASSERT_PRE0 ( idummy == 1, "I can read only formatted INRIA Mesh files, sorry" );
-        }
-
-        if ( line.find ( "Dimension" ) != std::string:: npos )
-        {
-            idummy = nextIntINRIAMeshField ( line.substr ( line.find_last_of ( "n" ) + 1 ), myStream );
-            ASSERT_PRE0 ( idummy == 3, "I can read only 3D INRIA Mesh files, sorry" );
-        }
-
-        // I assume that internal vertices have their Ref value set to 0 (not clear from medit manual)
-        if ( line.find ( "Vertices" ) != std::string::npos )
-        {
-            numberVertices = nextIntINRIAMeshField ( line.substr ( line.find_last_of ( "s" ) + 1 ), myStream );
-            done++;
-            numberBoundaryVertices = 0;
-            isboundary.resize ( numberVertices, false );
-
-            for ( i = 0; i < numberVertices; ++i )
-            {
-                myStream >> x >> y >> z >> ibc;
-                if ( ! iSelect ( markerID_Type ( ibc ) ) )
-                {
-                    numberBoundaryVertices++;
-                    isboundary[ i ] = true;
-                }
-            }
-        }
-
-        if ( line.find ( "Triangles" ) != std::string::npos )
-        {
-            ASSERT_PRE0 ( shape != HEXA, " Cannot have triangular faces in an HEXA INRIA  MESH" );
-            shape = TETRA;
-            numReadFaces = nextIntINRIAMeshField ( line.substr ( line.find_last_of ( "s" ) + 1 ), myStream );
-            numberBoundaryFaces = 0;
-
-            done++;
-
-            for ( UInt k = 0; k < numReadFaces; k++ )
-            {
-                myStream >> p1 >> p2 >> p3 >> ibc;
-                if ( isboundary[ p1 - idOffset ] && isboundary [ p2 - idOffset ] && isboundary[ p3 - idOffset ])
-                {
-                    if ( iSelect ( markerID_Type ( ibc ) ) )
-                    {
-                        std::cerr << "ATTENTION: Face (1-based numbering) "
-                                  << p1 << " "
-                                  << p2 << " "
-                                  << p3 << " has all vertices on the boundary yet is marked as interior: "
-                                  << ibc << std::endl;
-                    }
-                    ++numberBoundaryFaces;
-                }
-                else
-                {
-                    if ( !iSelect ( markerID_Type ( ibc ) ) )
-                    {
-                        std::cerr << "ATTENTION: Face (1-based numbering) "
-                                  << p1 << " "
-                                  << p2 << " "
-                                  << p3
-                                  << " has vertices in the interior yet is marked as boundary: "
-                                  << ibc << std::endl;
-                    }
-                }
-            }
-            numberStoredFaces = numReadFaces;
-        }
-
-
-        if ( line.find ( "Quadrilaterals" ) != std::string::npos )
-        {
-            ASSERT_PRE0 ( shape != TETRA, " Cannot have quad faces in an TETRA INRIA MESH" );
-            shape = HEXA;
-            numReadFaces = nextIntINRIAMeshField ( line.substr ( line.find_last_of ( "s" ) + 1 ), myStream );
-            done++;
-            numberBoundaryFaces = 0;
-
-            for ( UInt k = 0; k < numReadFaces; k++ )
-            {
-                myStream >> p1 >> p2 >> p3 >> p4 >> ibc;
-                if ( isboundary[ p1 - idOffset ] && isboundary[ p2 - idOffset ]
-                        && isboundary[ p3 - idOffset ] && isboundary[ p4 - idOffset ] )
-                {
-                    if ( iSelect ( markerID_Type ( ibc ) ) )
-                    {
-                        std::cerr << "ATTENTION: Face (1-based numbering) "
-                                  << p1 << " "
-                                  << p2 << " "
-                                  << p3 << " "
-                                  << p4
-                                  << " has all vertices on the boundary yet is marked as interior: "
-                                  << ibc << std::endl;
-                    }
-                    ++numberBoundaryFaces;
-                }
-
-            }
-            numberStoredFaces = numReadFaces;
-        }
-        // To cope with a mistake in INRIA Mesh files
-        if ( line.find ( "Tetrahedra" ) != std::string::npos )
-        {
-            ASSERT_PRE0 ( shape != HEXA, " Cannot have tetras  in a HEXA INRIA MESH" );
-            shape = TETRA;
-            numberVolumes = nextIntINRIAMeshField ( line.substr ( line.find_last_of ( "a" ) + 1 ), myStream );
-            done++;
-
-            for ( i = 0; i < numberVolumes; i++ )
-            {
-                myStream >> p1 >> p2 >> p3 >> p4 >> ibc;
-            }
-        }
-
-        if ( line.find ( "Hexahedra" ) != std::string::npos )
-        {
-            ASSERT_PRE0 ( shape != TETRA, " Cannot have Hexahedra in a TETRA INRIA MESH" );
-            shape = HEXA;
-            numberVolumes = nextIntINRIAMeshField ( line.substr ( line.find_last_of ( "a" ) + 1 ), myStream );
-            done++;
-
-            for ( i = 0; i < numberVolumes; i++ )
-            {
-                myStream >> p1 >> p2 >> p3 >> p4 >> p5 >> p6 >> p7 >> p8 >> ibc;
-            }
-        }
-        // I assume we are storing only boundary edges
-        if ( line.find ( "Edges" ) != std::string::npos )
-        {
-            numberBoundaryEdges = nextIntINRIAMeshField ( line.substr ( line.find_last_of ( "s" ) + 1 ), myStream );
-            done++;
-            for ( i = 0; i < numberBoundaryEdges; i++ )
-            {
-                myStream >> p1 >> p2 >> ibc;
-            }
-        }
-    }
-
-    LIFEV_UNUSED (idummy);
-    return true ;
-}// Function readINRIAMeshFileHead
-
-}
-
 //! INRIAMeshRead - reads .mesh meshes.
 /*!
+  The file is read in a single pass with a MeshFileTokenizer: the arrays of
+  the bare mesh are sized with the counts found at the beginning of each
+  section, and the boundary information which depends on more than one
+  section is computed once everything has been read.
+
   @param bareMesh, the bareMesh data structure to fill in.
   @param fileName, the name of the mesh file  to read.
   @param regionFlag, the identifier for the region.
@@ -301,17 +65,19 @@ ReadINRIAMeshFile ( BareMesh<GeoShape>& bareMesh,
 {
     const int idOffset = 1; //IDs in INRIA meshes start from 1
 
+    const UInt numberFacetPoints ( GeoShape::GeoBShape::S_numPoints );
+    const UInt numberRidgePoints ( GeoShape::GeoBShape::GeoBShape::S_numPoints );
+    const UInt numberElementPoints ( GeoShape::S_numPoints );
+
     std::string line, faceName, volumeName;
 
-    Real x, y, z;
-    ID buffer;
+    Int idummy;
 
     UInt done = 0;
-    UInt numberPoints, numberBoundaryPoints;
-    UInt numberVertices, numberBoundaryVertices;
-    UInt numberEdges, numberBoundaryEdges;
-    UInt numberBoundaryFaces, numberStoredFaces;
-    UInt numberVolumes;
+    UInt numberVertices ( 0 ), numberBoundaryVertices ( 0 );
+    UInt numberBoundaryEdges ( 0 );
+    UInt numberBoundaryFaces ( 0 ), numberStoredFaces ( 0 );
+    UInt numberVolumes ( 0 );
 
     std::stringstream discardedLog;
 
@@ -319,54 +85,22 @@ ReadINRIAMeshFile ( BareMesh<GeoShape>& bareMesh,
 
     std::ostream& oStr = verbose ? std::cout : discardedLog;
 
-    // open stream to read header
-
-    std::ifstream hstream ( fileName.c_str() );
-
     if ( verbose )
     {
         std::cout << "Reading from file " << fileName << std::endl;
     }
 
-    if ( hstream.fail() )
-    {
-        std::cerr << " Error in readINRIAMeshFile = file " << fileName
-                  << " not found or locked" << std::endl;
-        std::abort();
-    }
-
-    if ( verbose )
-    {
-        std::cout << "Reading INRIA mesh file" << fileName << std::endl;
-    }
+    MeshFileTokenizer tokenizer ( fileName );
 
-    if ( ! MeshIO::readINRIAMeshFileHead ( hstream, numberVertices, numberBoundaryVertices,
-                                           numberBoundaryFaces, numberBoundaryEdges,
-                                           numberVolumes, numberStoredFaces, shape, iSelect) )
-    {
-        std::cerr << " Error while reading INRIA mesh file headers" << std::endl;
-        std::abort() ;
-    }
-
-    hstream.close();
-
-    //Reopen the stream: I know it is stupid but this is how it goes
-    std::ifstream myStream ( fileName.c_str() );
-
-    if ( myStream.fail() )
+    if ( !tokenizer.isOpen() )
     {
         std::cerr << " Error in readINRIAMeshFile = file " << fileName
                   << " not found or locked" << std::endl;
         std::abort();
     }
 
-    ASSERT_PRE0 ( GeoShape::S_shape == shape, "INRIA Mesh file and mesh element shape is not consistent" );
-
-    numberPoints         =  numberVertices;
-    numberBoundaryPoints = numberBoundaryVertices;
-
     // Be a little verbose
-    switch ( shape )
+    switch ( GeoShape::S_shape )
     {
         case HEXA:
             ASSERT_PRE0 ( GeoShape::S_numPoints == 8, "Sorry I can read only linear Hexa meshes" );
@@ -392,8 +126,6 @@ ReadINRIAMeshFile ( BareMesh<GeoShape>& bareMesh,
                 {
                     std::cout << "Quadratic Tetra mesh (from linear geometry)" << std::endl;
                 }
-                numberPoints         += numberEdges;
-                numberBoundaryPoints += numberBoundaryEdges;
             }
             else
             {
@@ -407,82 +139,78 @@ ReadINRIAMeshFile ( BareMesh<GeoShape>& bareMesh,
             ERROR_MSG ( "Current version of INRIA Mesh file reader only accepts TETRA and HEXA" );
     }
 
-    // Set all basic data structure
-    bareMesh.numBoundaryPoints = numberBoundaryPoints;
-    bareMesh.numVertices = numberVertices;
-    bareMesh.numBoundaryVertices = numberBoundaryVertices;
-    bareMesh.points.reshape ( 3, numberPoints );
-    bareMesh.pointMarkers.resize ( numberPoints );
-    bareMesh.pointIDs.resize ( numberPoints );
-
-    bareMesh.ridges.reshape    ( GeoShape::GeoBShape::GeoBShape::S_numPoints, numberBoundaryEdges );
-    bareMesh.ridgeMarkers.resize ( numberBoundaryEdges );
-    bareMesh.ridgeIDs.resize ( numberBoundaryEdges );
-
-    bareMesh.numBoundaryFacets = numberBoundaryFaces;
-    bareMesh.facets.reshape ( GeoShape::GeoBShape::S_numPoints, numberStoredFaces );
-    bareMesh.facetMarkers.resize ( numberStoredFaces );
-    bareMesh.facetIDs.resize ( numberStoredFaces );
+    bareMesh.regionMarkerID = regionFlag;
 
-    bareMesh.elements.reshape ( GeoShape::S_numPoints, numberVolumes );
-    bareMesh.elementMarkers.resize ( numberVolumes );
-    bareMesh.elementIDs.resize ( numberVolumes );
+    while ( tokenizer.nextGoodLine ( line ) )
+    {
+        if ( line.find ( "MeshVersionFormatted" ) != std::string::npos )
+        {
+            idummy = tokenizer.nextIntField ( line.substr ( line.find_last_of ( "d" ) + 1 ) );
+            ASSERT_PRE0 ( idummy == 1, "I can read only formatted INRIA Mesh files, sorry" );
+        }
 
-    bareMesh.regionMarkerID = regionFlag;
+        if ( line.find ( "Dimension" ) != std::string::npos )
+        {
+            idummy = tokenizer.nextIntField ( line.substr ( line.find_last_of ( "n" ) + 1 ) );
+            ASSERT_PRE0 ( idummy == 3, "I can read only 3D INRIA Mesh files, sorry" );
+        }
 
-    UInt count = 0;
-    Int  ibc;
+        if ( line.find ( "Triangles" ) != std::string::npos || line.find ( "Tetrahedra" ) != std::string::npos )
+        {
+            ASSERT_PRE0 ( shape != HEXA, " Cannot have triangles or tetras in a HEXA INRIA MESH" );
+            shape = TETRA;
+        }
 
-    // To account for internal faces
-    if ( numberStoredFaces > numberBoundaryFaces )
-    {
-        oStr << "WARNING: The mesh file (apparently) contains "
-             << numberStoredFaces - numberBoundaryFaces << " internal faces" << std::endl;
-    }
+        if ( line.find ( "Quadrilaterals" ) != std::string::npos || line.find ( "Hexahedra" ) != std::string::npos )
+        {
+            ASSERT_PRE0 ( shape != TETRA, " Cannot have quads or hexahedra in a TETRA INRIA MESH" );
+            shape = HEXA;
+        }
 
-    while ( nextGoodLine ( myStream, line ).good() )
-    {
+        // I assume that internal vertices have their Ref value set to 0 (not clear from medit manual)
         if ( line.find ( "Vertices" ) != std::string::npos )
         {
-            nextIntINRIAMeshField ( line.substr ( line.find_last_of ( "s" ) + 1 ), myStream );
+            numberVertices = tokenizer.nextIntField ( line.substr ( line.find_last_of ( "s" ) + 1 ) );
+            numberBoundaryVertices = 0;
+
+            bareMesh.points.reshape ( 3, numberVertices );
+            bareMesh.pointMarkers.resize ( numberVertices );
+            bareMesh.pointIDs.resize ( numberVertices );
 
             for ( UInt i = 0; i < numberVertices; i++ )
             {
-                myStream >> x >> y >> z >> ibc;
+                bareMesh.points ( 0, i ) = tokenizer.nextReal();
+                bareMesh.points ( 1, i ) = tokenizer.nextReal();
+                bareMesh.points ( 2, i ) = tokenizer.nextReal();
 
-                if ( !iSelect (markerID_Type (ibc) ) )
+                const Int ibc = tokenizer.nextInt();
+                if ( !iSelect ( markerID_Type ( ibc ) ) )
                 {
-                    ++count;
+                    ++numberBoundaryVertices;
                 }
 
-                bareMesh.points ( 0, i ) = x;
-                bareMesh.points ( 1, i ) = y;
-                bareMesh.points ( 2, i ) = z;
                 bareMesh.pointMarkers[ i ] = ibc;
-                bareMesh.pointIDs[i] = i;
+                bareMesh.pointIDs[ i ] = i;
             }
             done++;
-
-            if ( count != numberBoundaryVertices )
-            {
-                std::cerr << "Number boundary points inconsistent!" << std::endl;
-            }
         }
 
         if ( line.find ( faceName ) != std::string::npos )
         {
-            nextIntINRIAMeshField ( line.substr ( line.find_last_of ( "s" ) + 1 ), myStream );
+            numberStoredFaces = tokenizer.nextIntField ( line.substr ( line.find_last_of ( "s" ) + 1 ) );
             oStr << "Reading boundary faces " << std::endl;
 
+            bareMesh.facets.reshape ( numberFacetPoints, numberStoredFaces );
+            bareMesh.facetMarkers.resize ( numberStoredFaces );
+            bareMesh.facetIDs.resize ( numberStoredFaces );
+
             for ( UInt i = 0; i < numberStoredFaces; i++ )
             {
-                for ( UInt k = 0; k < GeoShape::GeoBShape::S_numPoints; k++ )
+                for ( UInt k = 0; k < numberFacetPoints; k++ )
                 {
-                    myStream >> buffer;
-                    bareMesh.facets ( k, i ) = buffer - idOffset;
+                    bareMesh.facets ( k, i ) = tokenizer.nextUInt() - idOffset;
                 }
-                myStream >> ibc;
-                bareMesh.facetMarkers[ i ] = ibc;
+                bareMesh.facetMarkers[ i ] = tokenizer.nextInt();
                 bareMesh.facetIDs[ i ] = i;
             }
 
@@ -490,20 +218,23 @@ ReadINRIAMeshFile ( BareMesh<GeoShape>& bareMesh,
             done++;
         }
 
+        // I assume we are storing only boundary edges
         if ( line.find ( "Edges" ) != std::string::npos )
         {
-            nextIntINRIAMeshField ( line.substr ( line.find_last_of ( "s" ) + 1 ), myStream );
+            numberBoundaryEdges = tokenizer.nextIntField ( line.substr ( line.find_last_of ( "s" ) + 1 ) );
             oStr << "Reading boundary edges " << std::endl;
 
+            bareMesh.ridges.reshape ( numberRidgePoints, numberBoundaryEdges );
+            bareMesh.ridgeMarkers.resize ( numberBoundaryEdges );
+            bareMesh.ridgeIDs.resize ( numberBoundaryEdges );
+
             for ( UInt i = 0; i < numberBoundaryEdges; i++ )
             {
-                for ( UInt k = 0; k < GeoShape::GeoBShape::GeoBShape::S_numPoints; k++ )
+                for ( UInt k = 0; k < numberRidgePoints; k++ )
                 {
-                    myStream >> buffer;
-                    bareMesh.ridges ( k, i ) = buffer - idOffset;
+                    bareMesh.ridges ( k, i ) = tokenizer.nextUInt() - idOffset;
                 }
-                myStream >> ibc;
-                bareMesh.ridgeMarkers[ i ] = ibc;
+                bareMesh.ridgeMarkers[ i ] = tokenizer.nextInt();
                 bareMesh.ridgeIDs[ i ] = i;
             }
             oStr << "Boundary edges read " << std::endl;
@@ -512,28 +243,72 @@ ReadINRIAMeshFile ( BareMesh<GeoShape>& bareMesh,
 
         if ( line.find ( volumeName ) != std::string::npos )
         {
-            count = 0;
-            nextIntINRIAMeshField ( line.substr ( line.find_last_of ( "a" ) + 1 ), myStream );
+            numberVolumes = tokenizer.nextIntField ( line.substr ( line.find_last_of ( "a" ) + 1 ) );
             oStr << "Reading volumes " << std::endl;
 
+            bareMesh.elements.reshape ( numberElementPoints, numberVolumes );
+            bareMesh.elementMarkers.resize ( numberVolumes );
+            bareMesh.elementIDs.resize ( numberVolumes );
+
             for ( UInt i = 0; i < numberVolumes; i++ )
             {
-                for ( UInt k = 0; k < GeoShape::S_numPoints; k++ )
+                for ( UInt k = 0; k < numberElementPoints; k++ )
                 {
-                    myStream >> buffer;
-                    bareMesh.elements ( k, i ) = buffer - idOffset;
+                    bareMesh.elements ( k, i ) = tokenizer.nextUInt() - idOffset;
                 }
-                myStream >> ibc;
-                bareMesh.elementMarkers[ i ] = ibc;
+                bareMesh.elementMarkers[ i ] = tokenizer.nextInt();
                 bareMesh.elementIDs[ i ] = i;
-                count++;
             }
-            oStr << count << " Volume elements read" << std::endl;
+            oStr << numberVolumes << " Volume elements read" << std::endl;
             done++;
         }
     }
 
-    myStream.close();
+    ASSERT_PRE0 ( GeoShape::S_shape == shape, "INRIA Mesh file and mesh element shape is not consistent" );
+
+    // A stored face is a boundary face if all its vertices are on the boundary
+    const UInt numberFacetVertices ( GeoShape::GeoBShape::S_numVertices );
+    for ( UInt i = 0; i < numberStoredFaces; i++ )
+    {
+        bool boundary ( true );
+        for ( UInt k = 0; k < numberFacetVertices; k++ )
+        {
+            boundary = boundary && !iSelect ( markerID_Type ( bareMesh.pointMarkers[ bareMesh.facets ( k, i ) ] ) );
+        }
+
+        const bool markedInternal ( iSelect ( markerID_Type ( bareMesh.facetMarkers[ i ] ) ) );
+        if ( boundary )
+        {
+            ++numberBoundaryFaces;
+        }
+        // Only triangles were ever checked for interior vertices marked as boundary
+        if ( boundary == markedInternal && ( boundary || shape == TETRA ) )
+        {
+            std::cerr << "ATTENTION: Face (1-based numbering)";
+            for ( UInt k = 0; k < numberFacetVertices; k++ )
+            {
+                std::cerr << " " << bareMesh.facets ( k, i ) + idOffset;
+            }
+            std::cerr << ( boundary ? " has all vertices on the boundary yet is marked as interior: "
+                           : " has vertices in the interior yet is marked as boundary: " )
+                      << bareMesh.facetMarkers[ i ] << std::endl;
+        }
+    }
+
+    // To account for internal faces
+    if ( numberStoredFaces > numberBoundaryFaces )
+    {
+        oStr << "WARNING: The mesh file (apparently) contains "
+             << numberStoredFaces - numberBoundaryFaces << " internal faces" << std::endl;
+    }
+
+    // Set all basic data structure
+    bareMesh.numBoundaryPoints = numberBoundaryVertices;
+    bareMesh.numVertices = numberVertices;
+    bareMesh.numBoundaryVertices = numberBoundaryVertices;
+    bareMesh.numBoundaryFacets = numberBoundaryFaces;
+
+    LIFEV_UNUSED ( idummy );
     return done == 4 ;
 }
 
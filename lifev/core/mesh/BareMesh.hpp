@@ -35,6 +35,8 @@
 #ifndef BAREMESH_HPP_
 #define BAREMESH_HPP_
 
+#include <Epetra_Comm.h>
+
 #include <lifev/core/LifeV.hpp>
 
 #include <lifev/core/mesh/ElementShapes.hpp>
@@ -98,6 +100,96 @@ void BareMesh<GeoShapeType>::clear()
     clearVector ( elementIDs );
 }
 
+//! Broadcast a bare mesh read by one process to all the others
+/**
+ * It allows to read a mesh file only once and then send it to all the
+ * processes, instead of letting every process read the whole file.
+ * @param bareMesh the bare mesh, filled on the root process
+ * @param comm the communicator
+ * @param root the process which has read the mesh
+ */
+template <typename GeoShapeType>
+void broadcastBareMesh ( BareMesh<GeoShapeType>& bareMesh, const Epetra_Comm& comm, const Int root = 0 )
+{
+    Epetra_Comm& bcastComm = const_cast<Epetra_Comm&> ( comm );
+
+    // Sizes and scalar data
+    Int sizes[ 16 ] =
+    {
+        static_cast<Int> ( bareMesh.regionMarkerID ),
+        static_cast<Int> ( bareMesh.numBoundaryPoints ),
+        static_cast<Int> ( bareMesh.numVertices ),
+        static_cast<Int> ( bareMesh.numBoundaryVertices ),
+        static_cast<Int> ( bareMesh.numBoundaryFacets ),
+        static_cast<Int> ( bareMesh.isPartitioned ),
+        static_cast<Int> ( bareMesh.points.numberOfRows() ),
+        static_cast<Int> ( bareMesh.points.numberOfColumns() ),
+        static_cast<Int> ( bareMesh.ridges.numberOfRows() ),
+        static_cast<Int> ( bareMesh.ridges.numberOfColumns() ),
+        static_cast<Int> ( bareMesh.facets.numberOfRows() ),
+        static_cast<Int> ( bareMesh.facets.numberOfColumns() ),
+        static_cast<Int> ( bareMesh.elements.numberOfRows() ),
+        static_cast<Int> ( bareMesh.elements.numberOfColumns() ),
+        static_cast<Int> ( bareMesh.nDimensions ),
+        static_cast<Int> ( bareMesh.refShape )
+    };
+    bcastComm.Broadcast ( sizes, 16, root );
+
+    if ( comm.MyPID() != root )
+    {
+        bareMesh.regionMarkerID = sizes[ 0 ];
+        bareMesh.numBoundaryPoints = sizes[ 1 ];
+        bareMesh.numVertices = sizes[ 2 ];
+        bareMesh.numBoundaryVertices = sizes[ 3 ];
+        bareMesh.numBoundaryFacets = sizes[ 4 ];
+        bareMesh.isPartitioned = sizes[ 5 ];
+        bareMesh.points.reshape ( sizes[ 6 ], sizes[ 7 ] );
+        bareMesh.ridges.reshape ( sizes[ 8 ], sizes[ 9 ] );
+        bareMesh.facets.reshape ( sizes[ 10 ], sizes[ 11 ] );
+        bareMesh.elements.reshape ( sizes[ 12 ], sizes[ 13 ] );
+        bareMesh.nDimensions = sizes[ 14 ];
+        bareMesh.refShape = static_cast<ReferenceShapes> ( sizes[ 15 ] );
+        bareMesh.pointMarkers.resize ( sizes[ 7 ] );
+        bareMesh.pointIDs.resize ( sizes[ 7 ] );
+        bareMesh.ridgeMarkers.resize ( sizes[ 9 ] );
+        bareMesh.ridgeIDs.resize ( sizes[ 9 ] );
+        bareMesh.facetMarkers.resize ( sizes[ 11 ] );
+        bareMesh.facetIDs.resize ( sizes[ 11 ] );
+        bareMesh.elementMarkers.resize ( sizes[ 13 ] );
+        bareMesh.elementIDs.resize ( sizes[ 13 ] );
+    }
+
+    // IDs and markers have the size of an Int
+    std::vector<ID>* idVectors[ 8 ] =
+    {
+        &bareMesh.pointMarkers, &bareMesh.pointIDs,
+        &bareMesh.ridgeMarkers, &bareMesh.ridgeIDs,
+        &bareMesh.facetMarkers, &bareMesh.facetIDs,
+        &bareMesh.elementMarkers, &bareMesh.elementIDs
+    };
+    for ( UInt i = 0; i < 8; ++i )
+    {
+        if ( !idVectors[ i ]->empty() )
+        {
+            bcastComm.Broadcast ( reinterpret_cast<Int*> ( & ( *idVectors[ i ] ) [ 0 ] ), idVectors[ i ]->size(), root );
+        }
+    }
+
+    ArraySimple<UInt>* connectivities[ 3 ] = { &bareMesh.ridges, &bareMesh.facets, &bareMesh.elements };
+    for ( UInt i = 0; i < 3; ++i )
+    {
+        if ( !connectivities[ i ]->empty() )
+        {
+            bcastComm.Broadcast ( reinterpret_cast<Int*> ( & ( *connectivities[ i ] ) [ 0 ] ), connectivities[ i ]->size(), root );
+        }
+    }
+
+    if ( !bareMesh.points.empty() )
+    {
+        bcastComm.Broadcast ( &bareMesh.points[ 0 ], bareMesh.points.size(), root );
+    }
+}
+
 }
 
 #endif /* BAREMESH_HPP_ */
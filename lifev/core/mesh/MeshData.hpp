@@ -45,6 +45,8 @@
 
 #include <string>
 #include <ostream>
+#include <fstream>
+#include <stdexcept>
 
 #include <Teuchos_ParameterList.hpp>
 
@@ -278,6 +280,65 @@ void readMesh ( RegionMesh<GEOSHAPE, MC>& mesh, const MeshData& data )
     }
 }
 
+//! Read a mesh on one process and broadcast it
+/*!
+  INRIA .mesh files are read only by process 0 and sent to the other
+  processes as a bare mesh, so that a large file is read once per run
+  instead of once per process. The other formats are read by every process.
+  @param mesh the mesh to be filled
+  @param data the mesh data
+  @param comm the communicator (all the processes must call this function)
+ */
+template <typename GEOSHAPE, typename MC>
+void readMesh ( RegionMesh<GEOSHAPE, MC>& mesh, const MeshData& data, const Epetra_Comm& comm )
+{
+    if ( data.meshType() != ".mesh" || comm.NumProc() == 1 )
+    {
+        readMesh ( mesh, data );
+        return;
+    }
+
+    if ( data.verbose() )
+    {
+        std::cout << "\nBuilding mesh ... ";
+    }
+
+    // Process 0 tells the others whether it could read the file before sending the mesh
+    const std::string fileName ( data.meshDir() + data.meshFile() );
+    BareMesh<GEOSHAPE> bareMesh;
+    Int readDone ( 0 );
+    if ( comm.MyPID() == 0 && std::ifstream ( fileName.c_str() ).good() )
+    {
+        try
+        {
+            readDone = MeshIO::ReadINRIAMeshFile ( bareMesh, fileName, 1, data.verbose() );
+        }
+        catch ( const std::exception& error )
+        {
+            std::cerr << error.what() << std::endl;
+            readDone = 0;
+        }
+    }
+    const_cast<Epetra_Comm&> ( comm ).Broadcast ( &readDone, 1, 0 );
+    if ( !readDone )
+    {
+        ERROR_MSG ( "Sorry, the mesh file " + fileName + " can not be read" );
+    }
+
+    broadcastBareMesh ( bareMesh, comm );
+    convertBareMesh ( bareMesh, mesh, data.verbose() );
+    bareMesh.clear();
+
+    //Update Edges & Faces
+    mesh.updateElementRidges ( true, data.verbose() );
+    mesh.updateElementFacets ( true, data.verbose() );
+
+    if ( data.verbose() )
+    {
+        std::cout << "mesh read.\n" << std::endl;
+    }
+}
+
 
 
 } // namespace LifeV
@@ -163,13 +163,9 @@ makeBareFace ( ID const i, ID const j, ID const k )
 std::pair<BareFace, bool>
 makeBareFace ( ID const i, ID const j, ID const k, ID const l )
 {
-    std::vector<ID> helper ( 4 );
-    helper[ 0 ] = i;
-    helper[ 1 ] = j;
-    helper[ 2 ] = k;
-    helper[ 3 ] = l;
-    std::vector<ID>::iterator vi = std::max_element ( helper.begin(), helper.end() );
-    std::rotate ( helper.begin(), vi, helper.end() );
-    return makeBareFace ( helper[ 1 ], helper[ 2 ], helper[ 3 ] );
+    // Start from the vertex following the largest one (no heap allocation: this is called for every face)
+    const ID helper[ 4 ] = { i, j, k, l };
+    const UInt maxPosition ( std::max_element ( helper, helper + 4 ) - helper );
+    return makeBareFace ( helper[ ( maxPosition + 1 ) % 4 ], helper[ ( maxPosition + 2 ) % 4 ], helper[ ( maxPosition + 3 ) % 4 ] );
 }
 }
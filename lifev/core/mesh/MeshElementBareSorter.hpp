@@ -0,0 +1,208 @@
+//@HEADER
+/*
+*******************************************************************************
+
+    Copyright (C) 2004, 2005, 2007 EPFL, Politecnico di Milano, INRIA
+    Copyright (C) 2010, 2011, 2012 EPFL, Politecnico di Milano, Emory University
+
+    This file is part of LifeV.
+
+    LifeV is free software; you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    LifeV is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with LifeV.  If not, see <http://www.gnu.org/licenses/>.
+
+*******************************************************************************
+*/
+//@HEADER
+
+/*!
+    @file
+    @brief Sort-based grouping of bare mesh entities
+
+    @date 2026-10-19
+
+    The mesh topology builders in MeshUtility need to find all the copies of
+    the same BareFace (or BareEdge) generated by looping over the elements.
+    Instead of inserting every copy in a tree, the copies are collected in a
+    contiguous array together with the element that generated them and then
+    sorted with a stable LSD radix sort on the point IDs. After sorting, the
+    copies of the same bare entity are adjacent and appear in the order in
+    which the elements were visited, so that the result of the old map based
+    algorithms (which depends on the visiting order) can be reproduced exactly.
+ */
+
+#ifndef MESHELEMENTBARESORTER_H
+#define MESHELEMENTBARESORTER_H 1
+
+#include <vector>
+#include <algorithm>
+
+#include <lifev/core/LifeV.hpp>
+#include <lifev/core/mesh/MeshElementBare.hpp>
+
+namespace LifeV
+{
+
+//! BareItemKey - Access to the point IDs of a bare entity as a sequence
+/*!
+    The IDs are listed from the most significant one (first) to the least
+    significant one, consistently with cmpBareItem.
+ */
+template <typename BareItemType>
+struct BareItemKey;
+
+template <>
+struct BareItemKey<BareEdge>
+{
+    static const UInt S_numIds = 2;
+
+    static ID id ( const BareEdge& edge, const UInt i )
+    {
+        return i == 0 ? edge.first : edge.second;
+    }
+};
+
+template <>
+struct BareItemKey<BareFace>
+{
+    static const UInt S_numIds = 3;
+
+    static ID id ( const BareFace& face, const UInt i )
+    {
+        return i == 0 ? face.first : ( i == 1 ? face.second : face.third );
+    }
+};
+
+
+//! BareItemOccurrence - A bare entity generated while visiting an element
+/*!
+    It stores the bare entity, the ID of the element (or facet) that generated it,
+    the local position of the entity in that element and a user flag.
+ */
+template <typename BareItemType>
+struct BareItemOccurrence
+{
+    typedef BareItemType bareItem_Type;
+
+    BareItemOccurrence() :
+        item(),
+        elementId ( NotAnId ),
+        localId ( NotAnId ),
+        flag ( false )
+    {}
+
+    BareItemOccurrence ( const bareItem_Type& bareItem, const ID element, const ID local, const bool userFlag = false ) :
+        item ( bareItem ),
+        elementId ( element ),
+        localId ( local ),
+        flag ( userFlag )
+    {}
+
+    bareItem_Type item;
+    ID elementId;
+    ID localId;
+    bool flag;
+};
+
+
+//! Stable sort of a list of bare entity occurrences
+/*!
+    The occurrences are ordered according to cmpBareItem, while occurrences of
+    the same bare entity keep their relative order.
+    The sort is a least significant digit radix sort on the point IDs: only
+    the digits actually used by the largest ID are processed, so that the cost
+    is linear in the number of occurrences.
+
+    @param occurrences the list to be sorted
+ */
+template <typename BareItemType>
+void sortBareItemOccurrences ( std::vector< BareItemOccurrence<BareItemType> >& occurrences )
+{
+    typedef BareItemKey<BareItemType>                 key_Type;
+    typedef BareItemOccurrence<BareItemType>          occurrence_Type;
+    typedef typename std::vector<occurrence_Type>::size_type size_Type;
+
+    const UInt digitBits ( 11 );
+    const UInt numBuckets ( 1 << digitBits );
+    const UInt digitMask ( numBuckets - 1 );
+
+    const size_Type numOccurrences ( occurrences.size() );
+    if ( numOccurrences < 2 )
+    {
+        return;
+    }
+
+    // Number of digits needed to represent the largest ID
+    ID maxId ( 0 );
+    for ( size_Type i = 0; i < numOccurrences; ++i )
+    {
+        for ( UInt k = 0; k < key_Type::S_numIds; ++k )
+        {
+            maxId = std::max ( maxId, key_Type::id ( occurrences[ i ].item, k ) );
+        }
+    }
+    UInt numDigits ( 0 );
+    for ( ID residual = maxId; residual > 0; residual >>= digitBits )
+    {
+        ++numDigits;
+    }
+
+    std::vector<occurrence_Type> buffer ( numOccurrences );
+    std::vector<size_Type>       offsets ( numBuckets );
+
+    occurrence_Type* source      = &occurrences[ 0 ];
+    occurrence_Type* destination = &buffer[ 0 ];
+
+    // Least significant ID first, least significant digit first
+    for ( UInt k = key_Type::S_numIds; k > 0; --k )
+    {
+        for ( UInt digit = 0; digit < numDigits; ++digit )
+        {
+            const UInt shift ( digit * digitBits );
+
+            std::fill ( offsets.begin(), offsets.end(), 0 );
+            for ( size_Type i = 0; i < numOccurrences; ++i )
+            {
+                ++offsets[ ( key_Type::id ( source[ i ].item, k - 1 ) >> shift ) & digitMask ];
+            }
+
+            // All the occurrences share this digit: nothing to do
+            if ( offsets[ ( key_Type::id ( source[ 0 ].item, k - 1 ) >> shift ) & digitMask ] == numOccurrences )
+            {
+                continue;
+            }
+
+            size_Type position ( 0 );
+            for ( UInt bucket = 0; bucket < numBuckets; ++bucket )
+            {
+                const size_Type count ( offsets[ bucket ] );
+                offsets[ bucket ] = position;
+                position += count;
+            }
+
+            for ( size_Type i = 0; i < numOccurrences; ++i )
+            {
+                destination[ offsets[ ( key_Type::id ( source[ i ].item, k - 1 ) >> shift ) & digitMask ]++ ] = source[ i ];
+            }
+            std::swap ( source, destination );
+        }
+    }
+
+    if ( source != &occurrences[ 0 ] )
+    {
+        occurrences.swap ( buffer );
+    }
+}
+
+} // Namespace LifeV
+
+#endif /* MESHELEMENTBARESORTER_H */
@@ -43,6 +43,12 @@
 
 #include <algorithm>
 #include <iterator>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+#include <iomanip>
+#include <ctime>
 
 #include <boost/numeric/ublas/matrix.hpp>
 #include <boost/numeric/ublas/io.hpp>
@@ -111,8 +117,189 @@ getMeshData ( const std::string& meshName,
 }
 
 
+//! Key identifying a partition of a mesh file
+/*!
+  The key combines a 64 bit FNV-1a hash of the content of the mesh file,
+  computed on process 0, with the number of parts, the overlap and the
+  mesh order, so that a stored partition is never reused for a modified
+  mesh or a different run configuration.
+
+  @param fileName full name of the mesh file
+  @param comm communicator (the number of parts is the number of processes)
+  @param meshOrder order of the mesh
+  @param overlap overlap of the partitions
+  @return the key, identical on all processes
+*/
+inline std::string
+partitionCacheKey ( const std::string& fileName,
+                    const Epetra_Comm& comm,
+                    const std::string& meshOrder,
+                    const UInt overlap = 0 )
+{
+    // Broadcast as two 32 bit halves
+    Int hash[ 2 ] = { 0, 0 };
+    if ( comm.MyPID() == 0 )
+    {
+        uint64_type value ( 14695981039346656037ULL );
+        std::ifstream file ( fileName.c_str(), std::ios::in | std::ios::binary );
+        std::vector<char> buffer ( 1 << 20 );
+        while ( file )
+        {
+            file.read ( &buffer[ 0 ], buffer.size() );
+            const std::streamsize count ( file.gcount() );
+            for ( std::streamsize i = 0; i < count; ++i )
+            {
+                value = ( value ^ static_cast<unsigned char> ( buffer[ i ] ) ) * 1099511628211ULL;
+            }
+        }
+        hash[ 0 ] = static_cast<Int> ( value >> 32 );
+        hash[ 1 ] = static_cast<Int> ( value & 0xffffffffULL );
+    }
+    const_cast<Epetra_Comm&> ( comm ).Broadcast ( hash, 2, 0 );
+
+    std::ostringstream key;
+    key << std::hex << std::setfill ( '0' )
+        << std::setw ( 8 ) << static_cast<UInt> ( hash[ 0 ] )
+        << std::setw ( 8 ) << static_cast<UInt> ( hash[ 1 ] )
+        << std::dec << "_np" << comm.NumProc() << "_ov" << overlap << "_" << meshOrder;
+    return key.str();
+}
+
+//! Read a *.mesh file and load its partition from a cache
+/*!
+  The partition is looked up in the cache folder with a key built by
+  partitionCacheKey(). If it is not there, process 0 partitions the mesh
+  in serial mode and stores all the parts with PartitionIO, then every
+  process reads its own part. The full mesh is read only if it is requested
+  or if the partition has to be computed, and the mesh informations are
+  printed only in these cases. Without MPI or HDF5 the mesh is simply
+  partitioned online.
+
+  @param meshLocal The partitioned mesh that we want to generate
+  @param meshFull  The non partitioned mesh that we want to keep
+  @param meshName name of the mesh file
+  @param resourcesPath path to the mesh folder
+  @param cachePath path to the folder containing the stored partitions
+  @param meshOrder order of the mesh
+  @param overlap overlap of the partitions
+*/
+template< typename RegionMeshType>
+void loadMeshFromPartitionCache ( boost::shared_ptr< RegionMeshType >& meshLocal,
+                                  boost::shared_ptr< RegionMeshType >& meshFull,
+                                  const std::string& meshName,
+                                  const std::string& resourcesPath,
+                                  const std::string& cachePath,
+                                  const std::string& meshOrder = "P1",
+                                  const UInt overlap = 0 )
+{
+#if defined(HAVE_MPI) && defined(LIFEV_HAS_HDF5)
+    boost::shared_ptr<Epetra_MpiComm> Comm ( new Epetra_MpiComm ( MPI_COMM_WORLD ) );
+    Displayer displayer ( Comm );
+
+    LifeChrono meshReadChrono;
+    meshReadChrono.start();
+
+    const std::string partsFileName ( cachePath + meshName + "_"
+                                      + partitionCacheKey ( resourcesPath + meshName, *Comm, meshOrder, overlap ) + ".h5" );
+
+    Int cached ( 0 );
+    if ( Comm->MyPID() == 0 )
+    {
+        cached = std::ifstream ( partsFileName.c_str() ).good() ? 1 : 0;
+    }
+    Comm->Broadcast ( &cached, 1, 0 );
+
+    boost::shared_ptr<RegionMeshType > fullMesh;
+    if ( meshFull )
+    {
+        fullMesh.reset ( new RegionMeshType );
+        readMesh (*fullMesh, getMeshData (meshName, resourcesPath, meshOrder ), *Comm );
+    }
+    else if ( !cached && Comm->MyPID() == 0 )
+    {
+        fullMesh.reset ( new RegionMeshType );
+        readMesh (*fullMesh, getMeshData (meshName, resourcesPath, meshOrder ) );
+    }
+
+    if ( fullMesh )
+    {
+        MeshUtility::printMeshInfos ( fullMesh );
+    }
+
+    if ( !cached )
+    {
+        displayer.leaderPrint ("Partition not found in cache, writing ", partsFileName, "\n");
+        if ( Comm->MyPID() == 0 )
+        {
+            // Serial partitioning of all the parts on process 0
+            boost::shared_ptr<Epetra_Comm> selfComm ( new Epetra_MpiComm ( MPI_COMM_SELF ) );
+            MeshPartitioner< RegionMeshType > meshPartitioner;
+            meshPartitioner.setup ( Comm->NumProc(), selfComm );
+            meshPartitioner.setPartitionOverlap ( overlap );
+            meshPartitioner.attachUnpartitionedMesh ( fullMesh );
+            meshPartitioner.doPartitionGraph();
+            meshPartitioner.doPartitionMesh();
+            meshPartitioner.releaseUnpartitionedMesh();
+
+            // Write to a temporary file first, since concurrent runs may share the cache
+            std::ostringstream temporaryName;
+            temporaryName << partsFileName << "." << Comm->MyPID() << "_" << std::time ( 0 ) << "_" << std::clock() << ".tmp";
+            PartitionIO< RegionMeshType > partitionIO ( temporaryName.str(),
+                                                        boost::dynamic_pointer_cast<Epetra_MpiComm> ( selfComm ) );
+            partitionIO.write ( meshPartitioner.meshPartitions() );
+            std::rename ( temporaryName.str().c_str(), partsFileName.c_str() );
+        }
+        Comm->Barrier();
+    }
+
+    PartitionIO< RegionMeshType > partitionIO ( partsFileName, Comm );
+    partitionIO.read ( meshLocal );
+
+    meshReadChrono.stop();
+    displayer.leaderPrint ("Loading time: ", meshReadChrono.diff(), " s.\n");
+
+    if ( meshFull )
+    {
+        meshFull = fullMesh;
+    }
+#else
+    // Online partitioning, as in loadMesh but with the requested overlap
+#ifdef HAVE_MPI
+    boost::shared_ptr<Epetra_Comm> Comm ( new Epetra_MpiComm ( MPI_COMM_WORLD ) );
+#else
+    boost::shared_ptr<Epetra_Comm> Comm ( new Epetra_SerialComm );
+#endif
+    Displayer displayer ( Comm );
+
+    LifeChrono meshReadChrono;
+    meshReadChrono.start();
+    boost::shared_ptr<RegionMeshType > fullMesh ( new RegionMeshType );
+    readMesh (*fullMesh, getMeshData (meshName, resourcesPath, meshOrder ), *Comm );
+    MeshUtility::printMeshInfos ( fullMesh );
+    meshReadChrono.stop();
+    displayer.leaderPrint ("Loading time: ", meshReadChrono.diff(), " s.\n");
+
+    LifeChrono meshPartChrono;
+    meshPartChrono.start();
+    MeshPartitioner< RegionMeshType > meshPartitioner;
+    meshPartitioner.setPartitionOverlap ( overlap );
+    meshPartitioner.doPartition ( fullMesh, Comm );
+    meshLocal = meshPartitioner.meshPartition();
+    meshPartChrono.stop();
+    displayer.leaderPrint ("Partitioning time: ", meshPartChrono.diff(), " s.\n");
+    if ( meshFull )
+    {
+        meshFull = fullMesh;
+    }
+#endif
+}
+
 //! Read and partitioned a *.mesh file
 /*!
+  If the environment variable LIFEV_PARTITION_CACHE is set to a folder,
+  the partition is loaded from (or stored in) that folder, see
+  loadMeshFromPartitionCache().
+
   @param meshLocal The partitioned mesh that we want to generate
   @param meshFull  The non partitioned mesh that we want to keep
   @param meshName name of the mesh file
@@ -129,6 +316,15 @@ void loadMesh (  boost::shared_ptr< RegionMeshType >& meshLocal,
                  const std::string& resourcesPath,
                  const std::string& meshOrder )
 {
+#if defined(HAVE_MPI) && defined(LIFEV_HAS_HDF5)
+    const char* cachePath = std::getenv ( "LIFEV_PARTITION_CACHE" );
+    if ( cachePath && *cachePath )
+    {
+        loadMeshFromPartitionCache ( meshLocal, meshFull, meshName, resourcesPath, std::string ( cachePath ) + "/", meshOrder );
+        return;
+    }
+#endif
+
 #ifdef HAVE_MPI
     boost::shared_ptr<Epetra_Comm> Comm ( new Epetra_MpiComm ( MPI_COMM_WORLD ) );
 #else
@@ -139,7 +335,7 @@ void loadMesh (  boost::shared_ptr< RegionMeshType >& meshLocal,
     LifeChrono meshReadChrono;
     meshReadChrono.start();
     boost::shared_ptr<RegionMeshType > fullMesh ( new RegionMeshType );
-    readMesh (*fullMesh, getMeshData (meshName, resourcesPath, meshOrder ) );
+    readMesh (*fullMesh, getMeshData (meshName, resourcesPath, meshOrder ), *Comm );
     MeshUtility::printMeshInfos ( fullMesh );
     meshReadChrono.stop();
     displayer.leaderPrint ("Loading time: ", meshReadChrono.diff(), " s.\n");
@@ -37,6 +37,9 @@ along with LifeV.  If not, see <http://www.gnu.org/licenses/>.
 #ifndef MESH_PART_BUILDER_H
 #define MESH_PART_BUILDER_H 1
 
+#include <algorithm>
+#include <utility>
+
 #include <boost/shared_ptr.hpp>
 
 #include <Epetra_Comm.h>
@@ -73,6 +76,8 @@ public:
     typedef MeshType mesh_Type;
     typedef boost::shared_ptr<mesh_Type> meshPtr_Type;
     typedef boost::shared_ptr<Epetra_Comm>       commPtr_Type;
+    //! Global to local ID table: (global ID, local ID) pairs sorted by global ID
+    typedef std::vector<std::pair<Int, Int> >    idPairList_Type;
     typedef struct
     {
         idList_Type elements;
@@ -122,12 +127,34 @@ public:
 
     //! \name Get Methods
     //@{
-    const std::map<Int, Int>& globalToLocalElement() const
+    //! Global to local element ID table, sorted by global ID
+    const idPairList_Type& globalToLocalElement() const
     {
         return M_globalToLocalElement;
     }
     //@}
 
+    //! \name Static Methods
+    //@{
+    //! Look up a global ID in a global to local table
+    /*!
+     * \param table - a global to local ID table, sorted by global ID
+     * \param globalId - the global ID to look for
+     * \return the local ID, or -1 if the global ID is not in the table
+     */
+    static Int localId (const idPairList_Type& table, const Int globalId)
+    {
+        idPairList_Type::const_iterator it =
+            std::lower_bound (table.begin(), table.end(),
+                              std::make_pair (globalId, static_cast<Int> (-1) ) );
+        if (it == table.end() || it->first != globalId)
+        {
+            return -1;
+        }
+        return it->second;
+    }
+    //@}
+
 private:
     //! Private Methods
     //@{
@@ -188,11 +215,11 @@ private:
     UInt                                       M_elementRidges;
     UInt                                       M_facetVertices;
     std::vector<Int>                           M_localVertices;
-    std::set<Int>                              M_localRidges;
-    std::set<Int>                              M_localFacets;
+    std::vector<Int>                           M_localRidges;
+    std::vector<Int>                           M_localFacets;
     std::vector<Int>                           M_localElements;
-    std::map<Int, Int>                         M_globalToLocalVertex;
-    std::map<Int, Int>                         M_globalToLocalElement;
+    idPairList_Type                            M_globalToLocalVertex;
+    idPairList_Type                            M_globalToLocalElement;
     meshPtr_Type                               M_originalMesh;
     meshPtr_Type                               M_meshPart;
     UInt                                       M_partIndex;
@@ -257,53 +284,80 @@ template<typename MeshType>
 void MeshPartBuilder<MeshType>::constructLocalMesh (
     const std::vector<Int>& elementList)
 {
-    std::map<Int, Int>::iterator  im;
-    std::set<Int>::iterator       is;
+    const UInt numElements = elementList.size();
 
-    Int count = 0;
-    UInt ielem;
-    UInt inode;
+    M_localElements.assign (elementList.begin(), elementList.end() );
 
-    count = 0;
-    // cycle on local element's ID
+    // Gather all the entity references of the local elements in flat arrays.
+    // Vertices are stored as (global ID, visit index) pairs, since local
+    // vertices are numbered in the order they are first visited
+    idPairList_Type vertexVisits;
+    vertexVisits.reserve (numElements * M_elementVertices);
+    M_localRidges.reserve (numElements * M_elementRidges);
+    M_localFacets.reserve (numElements * M_elementFacets);
 
-    for (UInt jj = 0; jj < elementList.size(); ++jj)
+    for (UInt jj = 0; jj < numElements; ++jj)
     {
-        ielem = elementList[jj];
-        M_localElements.push_back (ielem);
+        const UInt ielem = elementList[jj];
 
         // cycle on element's nodes
         for (UInt ii = 0; ii < M_elementVertices; ++ii)
         {
-            inode = M_originalMesh->element (ielem).point (ii).id();
-            im    = M_globalToLocalVertex.find (inode);
-
-            // if the node is not yet present in the list of local nodes,
-            // then add it
-            if (im == M_globalToLocalVertex.end() )
-            {
-                M_globalToLocalVertex.insert (std::make_pair (inode, count) );
-                ++count;
-                // store here the global numbering of the node
-                M_localVertices.push_back (
-                    M_originalMesh->element (ielem).point (ii).id() );
-            }
+            vertexVisits.push_back (
+                std::make_pair (static_cast<Int> (M_originalMesh->element (ielem).point (ii).id() ),
+                                static_cast<Int> (vertexVisits.size() ) ) );
         }
 
         // cycle on element's edges
         for (UInt ii = 0; ii < M_elementRidges; ++ii)
         {
             // store here the global numbering of the edge
-            M_localRidges.insert (M_originalMesh->localRidgeId (ielem, ii) );
+            M_localRidges.push_back (M_originalMesh->localRidgeId (ielem, ii) );
         }
 
         // cycle on element's faces
         for (UInt ii = 0; ii < M_elementFacets; ++ii)
         {
             // store here the global numbering of the face
-            M_localFacets.insert (M_originalMesh->localFacetId (ielem, ii) );
+            M_localFacets.push_back (M_originalMesh->localFacetId (ielem, ii) );
+        }
+    }
+
+    // Ridges and facets are numbered by increasing global ID
+    std::sort (M_localRidges.begin(), M_localRidges.end() );
+    M_localRidges.erase (std::unique (M_localRidges.begin(), M_localRidges.end() ),
+                         M_localRidges.end() );
+    std::sort (M_localFacets.begin(), M_localFacets.end() );
+    M_localFacets.erase (std::unique (M_localFacets.begin(), M_localFacets.end() ),
+                         M_localFacets.end() );
+
+    // Keep the first visit of each vertex: after sorting, the first pair
+    // with a given global ID holds the smallest visit index
+    std::sort (vertexVisits.begin(), vertexVisits.end() );
+    idPairList_Type firstVisits;
+    firstVisits.reserve (vertexVisits.size() / 2 + 1);
+    for (UInt i = 0; i < vertexVisits.size(); ++i)
+    {
+        if (i == 0 || vertexVisits[i].first != vertexVisits[i - 1].first)
+        {
+            firstVisits.push_back (std::make_pair (vertexVisits[i].second,
+                                                   vertexVisits[i].first) );
         }
     }
+    idPairList_Type().swap (vertexVisits);
+
+    // Local vertex numbering follows the visiting order
+    std::sort (firstVisits.begin(), firstVisits.end() );
+    M_localVertices.resize (firstVisits.size() );
+    M_globalToLocalVertex.resize (firstVisits.size() );
+    for (UInt inode = 0; inode < firstVisits.size(); ++inode)
+    {
+        // store here the global numbering of the node
+        M_localVertices[inode] = firstVisits[inode].second;
+        M_globalToLocalVertex[inode] = std::make_pair (firstVisits[inode].second,
+                                                       static_cast<Int> (inode) );
+    }
+    std::sort (M_globalToLocalVertex.begin(), M_globalToLocalVertex.end() );
 }
 
 template<typename MeshType>
@@ -345,7 +399,6 @@ template<typename MeshType>
 void MeshPartBuilder<MeshType>::constructElements()
 {
     Int count;
-    std::map<Int, Int>::iterator im;
     std::vector<Int>::iterator it;
     count = 0;
     UInt inode;
@@ -353,6 +406,7 @@ void MeshPartBuilder<MeshType>::constructElements()
     typename MeshType::element_Type* pv = 0;
 
     M_meshPart->elementList().reserve (M_localElements.size() );
+    M_globalToLocalElement.reserve (M_localElements.size() );
 
     // loop in the list of local elements
     // CAREFUL! in this loop inode is the global numbering of the points
@@ -364,27 +418,23 @@ void MeshPartBuilder<MeshType>::constructElements()
         *pv = M_originalMesh->element ( *it );
         pv->setLocalId ( count );
 
-        M_globalToLocalElement.insert (std::make_pair (pv->id(),
-                                                       pv->localId() ) );
+        M_globalToLocalElement.push_back (std::make_pair (static_cast<Int> (pv->id() ),
+                                                          static_cast<Int> (pv->localId() ) ) );
 
         for (ID id = 0; id < M_elementVertices; ++id)
         {
             inode = M_originalMesh->element (*it).point (id).id();
-            // im is an iterator to a map element
-            // im->first is the key (i. e. the global ID "inode")
-            // im->second is the value (i. e. the local ID "count")
-            im = M_globalToLocalVertex.find (inode);
-            pv->setPoint (id, M_meshPart->point ( (*im).second ) );
+            pv->setPoint (id, M_meshPart->point (localId (M_globalToLocalVertex, inode) ) );
         }
     }
+    std::sort (M_globalToLocalElement.begin(), M_globalToLocalElement.end() );
 }
 
 template<typename MeshType>
 void MeshPartBuilder<MeshType>::constructRidges()
 {
     Int count;
-    std::map<Int, Int>::iterator im;
-    std::set<Int>::iterator is;
+    std::vector<Int>::const_iterator is;
 
     typename MeshType::ridge_Type* pe;
     UInt inode;
@@ -412,11 +462,7 @@ void MeshPartBuilder<MeshType>::constructRidges()
         for (ID id = 0; id < 2; ++id)
         {
             inode = M_originalMesh->ridge (*is).point (id).id();
-            // im is an iterator to a map element
-            // im->first is the key (i. e. the global ID "inode")
-            // im->second is the value (i. e. the local ID "count")
-            im = M_globalToLocalVertex.find (inode);
-            pe->setPoint (id, M_meshPart->pointList ( (*im).second) );
+            pe->setPoint (id, M_meshPart->pointList (localId (M_globalToLocalVertex, inode) ) );
         }
     }
 }
@@ -425,8 +471,7 @@ template<typename MeshType>
 void MeshPartBuilder<MeshType>::constructFacets()
 {
     Int count;
-    std::map<Int, Int>::iterator im;
-    std::set<Int>::iterator      is;
+    std::vector<Int>::const_iterator is;
 
     typename MeshType::facet_Type* pf = 0;
 
@@ -450,30 +495,11 @@ void MeshPartBuilder<MeshType>::constructFacets()
         Int elem2 = M_originalMesh->facet (*is).secondAdjacentElementIdentity();
 
         // find the mesh elements adjacent to the face
-        im =  M_globalToLocalElement.find (elem1);
-
-        ID localElem1;
-
-        if (im == M_globalToLocalElement.end() )
-        {
-            localElem1 = NotAnId;
-        }
-        else
-        {
-            localElem1 = (*im).second;
-        }
+        const Int localIdElem1 = localId (M_globalToLocalElement, elem1);
+        const ID localElem1 = (localIdElem1 < 0) ? NotAnId : localIdElem1;
 
-        im =  M_globalToLocalElement.find (elem2);
-
-        ID localElem2;
-        if (im == M_globalToLocalElement.end() )
-        {
-            localElem2 = NotAnId;
-        }
-        else
-        {
-            localElem2 = (*im).second;
-        }
+        const Int localIdElem2 = localId (M_globalToLocalElement, elem2);
+        const ID localElem2 = (localIdElem2 < 0) ? NotAnId : localIdElem2;
 
         pf =  & (M_meshPart->addFacet (boundary) );
         *pf = M_originalMesh->facet ( *is );
@@ -483,8 +509,7 @@ void MeshPartBuilder<MeshType>::constructFacets()
         for (ID id = 0; id < M_originalMesh->facet (*is).S_numLocalVertices; ++id)
         {
             inode = pf->point (id).id();
-            im = M_globalToLocalVertex.find (inode);
-            pf->setPoint (id, M_meshPart->pointList ( (*im).second) );
+            pf->setPoint (id, M_meshPart->pointList (localId (M_globalToLocalVertex, inode) ) );
         }
 
         // true if we are on a subdomain border
@@ -485,7 +485,7 @@ template < typename MeshType>
 void
 MeshPartitionTool < MeshType >::globalToLocal (const Int curPart)
 {
-    const std::map<Int, Int>& globalToLocalMap =
+    const typename meshPartBuilder_Type::idPairList_Type& globalToLocalTable =
         M_meshPartBuilder->globalToLocalElement();
     idTable_Type& currentGraph = * (M_secondStageParts->at (curPart) );
 
@@ -495,7 +495,8 @@ MeshPartitionTool < MeshType >::globalToLocal (const Int curPart)
         idList_Type& currentElements = * (currentGraph[i]);
         for (Int j = 0; j < currentSize; ++j)
         {
-            currentElements[j] = globalToLocalMap.find (currentElements[j])->second;
+            currentElements[j] = meshPartBuilder_Type::localId (globalToLocalTable,
+                                                                currentElements[j]);
         }
     }
 }
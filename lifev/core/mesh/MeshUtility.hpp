@@ -50,6 +50,7 @@
 #include <lifev/core/util/Switch.hpp>
 #include <lifev/core/array/VectorSmall.hpp>
 #include <lifev/core/mesh/MeshElementBare.hpp>
+#include <lifev/core/mesh/MeshElementBareSorter.hpp>
 #include <lifev/core/mesh/MarkerDefinitions.hpp>
 #include <lifev/core/mesh/MeshEntity.hpp>
 #include <lifev/core/mesh/MeshEntityContainer.hpp>
@@ -447,11 +448,10 @@ UInt findFaces ( const MeshType& mesh, temporaryFaceContainer_Type& boundaryFace
                  UInt& numInternalFaces, temporaryFaceContainer_Type& internalFaces,
                  bool buildAllFaces = false )
 {
-    UInt                                  point1Id, point2Id, point3Id, point4Id;
-    BareFace                              bareFace;
-    typename MeshType::elementShape_Type   volumeShape;
-    typedef typename MeshType::volumes_Type    volumeContainer_Type;
-    temporaryFaceContainer_Type::iterator faceContainerIterator;
+    typedef BareItemOccurrence<BareFace>        faceOccurrence_Type;
+    typedef std::vector<faceOccurrence_Type>    faceOccurrenceContainer_Type;
+
+    typename MeshType::elementShape_Type  volumeShape;
 
     // clean first in case it has been already used
     boundaryFaceContainer.clear();
@@ -461,22 +461,26 @@ UInt findFaces ( const MeshType& mesh, temporaryFaceContainer_Type& boundaryFace
     }
     numInternalFaces = 0;
 
-    for ( typename volumeContainer_Type::const_iterator volumeContainerIterator = mesh.volumeList.begin();
-            volumeContainerIterator != mesh.volumeList.end(); ++volumeContainerIterator )
+    // Collect all the faces seen by the volumes, in the order in which they are visited.
+    // Each volume writes its own slots, so the loop can be shared among threads
+    const UInt numVolumes ( mesh.volumeList.size() );
+    const UInt numLocalFaces ( mesh.numLocalFaces() );
+    faceOccurrenceContainer_Type faceOccurrences ( numVolumes * numLocalFaces );
+
+    #pragma omp parallel for
+    for ( UInt iVolume = 0; iVolume < numVolumes; ++iVolume )
     {
-        for ( ID jFaceLocalId = 0; jFaceLocalId < mesh.numLocalFaces(); ++jFaceLocalId )
+        const typename MeshType::volume_Type& volume ( mesh.volumeList[ iVolume ] );
+        for ( ID jFaceLocalId = 0; jFaceLocalId < numLocalFaces; ++jFaceLocalId )
         {
-            point1Id = volumeShape.faceToPoint ( jFaceLocalId, 0 );
-            point2Id = volumeShape.faceToPoint ( jFaceLocalId, 1 );
-            point3Id = volumeShape.faceToPoint ( jFaceLocalId, 2 );
             // go to global
-            point1Id = ( volumeContainerIterator->point ( point1Id ) ).localId();
-            point2Id = ( volumeContainerIterator->point ( point2Id ) ).localId();
-            point3Id = ( volumeContainerIterator->point ( point3Id ) ).localId();
+            const UInt point1Id ( volume.point ( volumeShape.faceToPoint ( jFaceLocalId, 0 ) ).localId() );
+            const UInt point2Id ( volume.point ( volumeShape.faceToPoint ( jFaceLocalId, 1 ) ).localId() );
+            const UInt point3Id ( volume.point ( volumeShape.faceToPoint ( jFaceLocalId, 2 ) ).localId() );
+            BareFace bareFace;
             if ( MeshType::facetShape_Type::S_numVertices == 4 )
             {
-                point4Id = volumeShape.faceToPoint ( jFaceLocalId, 3 );
-                point4Id = ( volumeContainerIterator->point ( point4Id ) ).localId();
+                const UInt point4Id ( volume.point ( volumeShape.faceToPoint ( jFaceLocalId, 3 ) ).localId() );
                 bareFace = ( makeBareFace ( point1Id, point2Id, point3Id, point4Id ) ).first;
             }
             else
@@ -484,23 +488,56 @@ UInt findFaces ( const MeshType& mesh, temporaryFaceContainer_Type& boundaryFace
                 bareFace = ( makeBareFace ( point1Id, point2Id, point3Id ) ).first;
             }
 
-            if ( ( faceContainerIterator = boundaryFaceContainer.find ( bareFace ) ) == boundaryFaceContainer.end() )
-            {
-                boundaryFaceContainer.insert (
-                    std::make_pair ( bareFace, std::make_pair ( volumeContainerIterator->localId(), jFaceLocalId ) ) );
-            }
-            else
+            faceOccurrences[ iVolume * numLocalFaces + jFaceLocalId ] =
+                faceOccurrence_Type ( bareFace, volume.localId(), jFaceLocalId, point1Id > point2Id );
+        }
+    }
+
+    // Copies of the same face become adjacent, in visiting order
+    sortBareItemOccurrences ( faceOccurrences );
+
+    /*
+      Each group of copies is processed as the sequence of insertions/removals
+      of the original map based algorithm: the odd copies are inserted in the boundary
+      container, the even ones remove it (internal face). Since groups come out sorted
+      the containers are filled by appending, in constant time.
+     */
+    typename faceOccurrenceContainer_Type::const_iterator groupBegin ( faceOccurrences.begin() );
+    while ( groupBegin != faceOccurrences.end() )
+    {
+        typename faceOccurrenceContainer_Type::const_iterator groupEnd ( groupBegin + 1 );
+        while ( groupEnd != faceOccurrences.end() && groupEnd->item == groupBegin->item )
+        {
+            ++groupEnd;
+        }
+        const UInt numCopies ( groupEnd - groupBegin );
+
+        numInternalFaces += numCopies / 2;
+
+        if ( buildAllFaces )
+        {
+            for ( typename faceOccurrenceContainer_Type::const_iterator copy = groupBegin + 1;
+                    copy < groupEnd; copy += 2 )
             {
-                if ( buildAllFaces && point1Id > point2Id )
+                if ( copy->flag )
                 {
-                    internalFaces.insert (
-                        ( std::make_pair ( bareFace, std::make_pair ( volumeContainerIterator->localId(), jFaceLocalId ) ) ) );
+                    internalFaces.insert ( internalFaces.end(),
+                                           std::make_pair ( copy->item, std::make_pair ( copy->elementId, copy->localId ) ) );
+                    break;
                 }
-                boundaryFaceContainer.erase ( faceContainerIterator ); // counted twice: internal face
-                ++numInternalFaces;
             }
         }
+
+        if ( numCopies % 2 )
+        {
+            const faceOccurrence_Type& lastCopy ( * ( groupEnd - 1 ) );
+            boundaryFaceContainer.insert ( boundaryFaceContainer.end(),
+                                           std::make_pair ( lastCopy.item, std::make_pair ( lastCopy.elementId, lastCopy.localId ) ) );
+        }
+
+        groupBegin = groupEnd;
     }
+
     return boundaryFaceContainer.size();
 }
 
@@ -554,10 +591,13 @@ UInt findBoundaryFaces ( const MeshType& mesh,
 template <typename MeshType>
 UInt findBoundaryEdges ( const MeshType& mesh, temporaryEdgeContainer_Type& boundaryEdgeContainer )
 {
+    typedef BareItemOccurrence<BareEdge>        edgeOccurrence_Type;
+    typedef std::vector<edgeOccurrence_Type>    edgeOccurrenceContainer_Type;
+    typedef typename MeshType::facetShape_Type  facetShape_Type;
+    typedef typename MeshType::faces_Type       faceContainer_Type;
+
     UInt                                 point1Id, point2Id;
     BareEdge                             bareEdge;
-    typedef typename MeshType::facetShape_Type facetShape_Type;
-    typedef typename MeshType::faces_Type     faceContainer_Type;
 
 
     if ( ! mesh.hasFaces() )
@@ -568,6 +608,9 @@ UInt findBoundaryEdges ( const MeshType& mesh, temporaryEdgeContainer_Type& boun
     // clean first in case it has been already used
     boundaryEdgeContainer.clear();
 
+    edgeOccurrenceContainer_Type edgeOccurrences;
+    edgeOccurrences.reserve ( mesh.numBFaces() * mesh.numLocalEdgesOfFace() );
+
     // the following cycle assumes to visit only the boundary faces in mesh.faceList()
     for ( typename faceContainer_Type::const_iterator faceContainerIterator = mesh.faceList.begin();
             faceContainerIterator != mesh.faceList.begin() + mesh.numBFaces(); ++faceContainerIterator )
@@ -580,8 +623,20 @@ UInt findBoundaryEdges ( const MeshType& mesh, temporaryEdgeContainer_Type& boun
             point1Id = ( faceContainerIterator->point ( point1Id ) ).localId();
             point2Id = ( faceContainerIterator->point ( point2Id ) ).localId();
             bareEdge = ( makeBareEdge ( point1Id, point2Id ) ).first;
-            boundaryEdgeContainer.insert (
-                std::make_pair ( bareEdge, std::make_pair ( faceContainerIterator->localId(), jEdgeLocalId ) ) );
+            edgeOccurrences.push_back ( edgeOccurrence_Type ( bareEdge, faceContainerIterator->localId(), jEdgeLocalId ) );
+        }
+    }
+
+    sortBareItemOccurrences ( edgeOccurrences );
+
+    // Keep the first copy of each edge, as a map insertion would do
+    for ( typename edgeOccurrenceContainer_Type::const_iterator copy = edgeOccurrences.begin();
+            copy != edgeOccurrences.end(); ++copy )
+    {
+        if ( copy == edgeOccurrences.begin() || ( copy - 1 )->item != copy->item )
+        {
+            boundaryEdgeContainer.insert ( boundaryEdgeContainer.end(),
+                                           std::make_pair ( copy->item, std::make_pair ( copy->elementId, copy->localId ) ) );
         }
     }
     return boundaryEdgeContainer.size();
@@ -614,10 +669,10 @@ UInt findInternalEdges ( const MeshType& mesh,
                          const temporaryEdgeContainer_Type& boundaryEdgeContainer,
                          temporaryEdgeContainer_Type& internalEdgeContainer )
 {
-    UInt                                   point1Id, point2Id;
-    BareEdge                               bareEdge;
-    typedef typename MeshType::elementShape_Type volumeShape_Type;
-    typedef typename MeshType::volumes_Type     volumeContainer_Type;
+    typedef BareItemOccurrence<BareEdge>          edgeOccurrence_Type;
+    typedef std::vector<edgeOccurrence_Type>      edgeOccurrenceContainer_Type;
+    typedef typename MeshType::elementShape_Type  volumeShape_Type;
+
     temporaryEdgeContainer_Type            temporaryEdgeContainer;
 
     ASSERT0 ( mesh.numVolumes() > 0, "We must have some 3D elements stored n the mesh to use this function!" );
@@ -625,21 +680,43 @@ UInt findInternalEdges ( const MeshType& mesh,
     internalEdgeContainer.clear();
     internalEdgeContainer.swap (temporaryEdgeContainer);
 
-    for ( typename volumeContainer_Type::const_iterator volumeContainerIterator = mesh.volumeList.begin();
-            volumeContainerIterator != mesh.volumeList.end(); ++volumeContainerIterator )
+    const UInt numVolumes ( mesh.volumeList.size() );
+    const UInt numLocalEdges ( mesh.numLocalEdges() );
+    edgeOccurrenceContainer_Type edgeOccurrences ( numVolumes * numLocalEdges );
+
+    #pragma omp parallel for
+    for ( UInt iVolume = 0; iVolume < numVolumes; ++iVolume )
     {
-        for ( ID jEdgeLocalId = 0; jEdgeLocalId < mesh.numLocalEdges(); ++jEdgeLocalId )
+        const typename MeshType::volume_Type& volume ( mesh.volumeList[ iVolume ] );
+        for ( ID jEdgeLocalId = 0; jEdgeLocalId < numLocalEdges; ++jEdgeLocalId )
         {
-            point1Id = volumeShape_Type::edgeToPoint ( jEdgeLocalId, 0 );
-            point2Id = volumeShape_Type::edgeToPoint ( jEdgeLocalId, 1 );
             // go to global
-            point1Id = ( volumeContainerIterator->point ( point1Id ) ).localId();
-            point2Id = ( volumeContainerIterator->point ( point2Id ) ).localId();
-            bareEdge = ( makeBareEdge ( point1Id, point2Id ) ).first;
-            if ( boundaryEdgeContainer.find ( bareEdge ) == boundaryEdgeContainer.end() )
-                internalEdgeContainer.insert
-                ( std::make_pair ( bareEdge, std::make_pair ( volumeContainerIterator->localId(), jEdgeLocalId ) ) );
+            const UInt point1Id ( volume.point ( volumeShape_Type::edgeToPoint ( jEdgeLocalId, 0 ) ).localId() );
+            const UInt point2Id ( volume.point ( volumeShape_Type::edgeToPoint ( jEdgeLocalId, 1 ) ).localId() );
+            edgeOccurrences[ iVolume * numLocalEdges + jEdgeLocalId ] =
+                edgeOccurrence_Type ( makeBareEdge ( point1Id, point2Id ).first, volume.localId(), jEdgeLocalId );
+        }
+    }
+
+    sortBareItemOccurrences ( edgeOccurrences );
+
+    // Both lists are sorted: walk them together to skip the boundary edges
+    cmpBareItem<BareEdge> lessThan;
+    temporaryEdgeContainer_Type::const_iterator boundaryEdgeIterator ( boundaryEdgeContainer.begin() );
+    for ( typename edgeOccurrenceContainer_Type::const_iterator copy = edgeOccurrences.begin();
+            copy != edgeOccurrences.end(); ++copy )
+    {
+        if ( copy != edgeOccurrences.begin() && ( copy - 1 )->item == copy->item )
+        {
+            continue;
+        }
+        while ( boundaryEdgeIterator != boundaryEdgeContainer.end() && lessThan ( boundaryEdgeIterator->first, copy->item ) )
+        {
+            ++boundaryEdgeIterator;
         }
+        if ( boundaryEdgeIterator == boundaryEdgeContainer.end() || boundaryEdgeIterator->first != copy->item )
+            internalEdgeContainer.insert ( internalEdgeContainer.end(),
+                                           std::make_pair ( copy->item, std::make_pair ( copy->elementId, copy->localId ) ) );
     }
     return internalEdgeContainer.size();
 }
@@ -0,0 +1,234 @@
+//@HEADER
+/*
+*******************************************************************************
+
+    Copyright (C) 2004, 2005, 2007 EPFL, Politecnico di Milano, INRIA
+    Copyright (C) 2010 EPFL, Politecnico di Milano, Emory University
+
+    This file is part of LifeV.
+
+    LifeV is free software; you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    LifeV is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with LifeV.  If not, see <http://www.gnu.org/licenses/>.
+
+*******************************************************************************
+*/
+//@HEADER
+
+/*!
+    @file
+    @brief Test of the Dirichlet row elimination of MatrixEpetra
+
+    @date 19-10-2026
+
+    The vector overloads of MatrixEpetra::diagonalize send the constrained
+    rows to their owners through a DiagonalizationPlan. Each process gives
+    rows owned by the others; the resulting matrix and right hand side are
+    compared with the ones of the row by row elimination, applied by every
+    process to the rows of all the processes as the former implementation did.
+ */
+
+// ===================================================
+//! Includes
+// ===================================================
+
+#include <Epetra_ConfigDefs.h>
+#ifdef HAVE_MPI
+#include <mpi.h>
+#include <Epetra_MpiComm.h>
+#else
+#include <Epetra_SerialComm.h>
+#endif
+
+#include <cmath>
+#include <iostream>
+
+#include <lifev/core/LifeV.hpp>
+#include <lifev/core/array/MapEpetra.hpp>
+#include <lifev/core/array/MatrixEpetra.hpp>
+#include <lifev/core/array/VectorEpetra.hpp>
+
+using namespace LifeV;
+
+// put all local stuff in a local namespace
+namespace
+{
+
+typedef MatrixEpetra<Real>               matrix_Type;
+typedef boost::shared_ptr<matrix_Type>   matrixPtr_Type;
+typedef VectorEpetra                     vector_Type;
+
+const Int  numRows ( 40 );
+const UInt offset ( 2 );
+
+// A banded matrix coupling rows owned by different processes
+matrixPtr_Type buildMatrix ( const MapEpetra& map )
+{
+    matrixPtr_Type matrix ( new matrix_Type ( map ) );
+
+    const Epetra_Map& rowMap ( *map.map ( Unique ) );
+    for ( Int i = 0; i < rowMap.NumMyElements(); ++i )
+    {
+        const Int row ( rowMap.GID ( i ) );
+        matrix->addToCoefficient ( row, row, 4. + row % 3 );
+        for ( Int shift = 1; shift <= 5; shift += 4 )
+        {
+            if ( row - shift >= 0 )
+            {
+                matrix->addToCoefficient ( row, row - shift, -1. - 0.01 * shift );
+            }
+            if ( row + shift < numRows )
+            {
+                matrix->addToCoefficient ( row, row + shift, -1. + 0.01 * shift );
+            }
+        }
+    }
+    matrix->globalAssemble();
+    return matrix;
+}
+
+vector_Type buildRhs ( const MapEpetra& map )
+{
+    vector_Type rhs ( map, Unique );
+    const Epetra_BlockMap& rowMap ( rhs.blockMap() );
+    for ( Int i = 0; i < rowMap.NumMyElements(); ++i )
+    {
+        rhs[ rowMap.GID ( i ) ] = 0.5 * rowMap.GID ( i ) + 1.;
+    }
+    return rhs;
+}
+
+// Largest difference between the entries of two matrices with the same structure
+Real matrixDifference ( const matrix_Type& matrix1, const matrix_Type& matrix2 )
+{
+    const Epetra_FECrsMatrix& epetra1 ( *matrix1.matrixPtr() );
+    const Epetra_FECrsMatrix& epetra2 ( *matrix2.matrixPtr() );
+
+    Real localDifference ( 0. );
+    for ( Int row = 0; row < epetra1.NumMyRows(); ++row )
+    {
+        Int numEntries1, numEntries2;
+        Real* values1;
+        Real* values2;
+        Int* indices1;
+        Int* indices2;
+        epetra1.ExtractMyRowView ( row, numEntries1, values1, indices1 );
+        epetra2.ExtractMyRowView ( row, numEntries2, values2, indices2 );
+        // A different structure is recorded as a difference of one: every process must reach the reduction
+        if ( numEntries1 != numEntries2 )
+        {
+            localDifference = std::max ( localDifference, 1. );
+            continue;
+        }
+        for ( Int j = 0; j < numEntries1; ++j )
+        {
+            if ( indices1[ j ] != indices2[ j ] )
+            {
+                localDifference = std::max ( localDifference, 1. );
+                break;
+            }
+            localDifference = std::max ( localDifference, std::abs ( values1[ j ] - values2[ j ] ) );
+        }
+    }
+
+    Real difference ( 0. );
+    epetra1.Comm().MaxAll ( &localDifference, &difference, 1 );
+    return difference;
+}
+
+} // anonymous namespace
+
+int
+main ( int argc, char** argv )
+{
+#ifdef HAVE_MPI
+    MPI_Init ( &argc, &argv );
+    boost::shared_ptr<Epetra_Comm> comm ( new Epetra_MpiComm ( MPI_COMM_WORLD ) );
+#else
+    boost::shared_ptr<Epetra_Comm> comm ( new Epetra_SerialComm );
+#endif
+
+    const bool verbose ( comm->MyPID() == 0 );
+    const Real coefficient ( 3. );
+
+    MapEpetra map ( numRows, 0, comm );
+
+    // Constrained rows of this process: mostly owned by the others, some
+    // repeated; the data only depend on the row, as for a Dirichlet datum
+    std::vector<UInt> rows;
+    std::vector<Real> data;
+    for ( Int k = 0; k < 8; ++k )
+    {
+        const UInt row ( ( 13 * comm->MyPID() + 7 * k + 3 ) % ( numRows - offset ) );
+        rows.push_back ( row );
+        data.push_back ( 1. + 0.1 * row );
+    }
+
+    // Plan based elimination
+    matrixPtr_Type matrix ( buildMatrix ( map ) );
+    vector_Type rhs ( buildRhs ( map ) );
+    matrix->diagonalize ( rows, coefficient, rhs, data, offset );
+
+    matrixPtr_Type matrixNoRhs ( buildMatrix ( map ) );
+    matrixNoRhs->diagonalize ( rows, coefficient, offset );
+
+    // Reference: every process applies the rows of all the processes one by one
+    matrixPtr_Type matrixReference ( buildMatrix ( map ) );
+    vector_Type rhsReference ( buildRhs ( map ) );
+    matrixPtr_Type matrixNoRhsReference ( buildMatrix ( map ) );
+    for ( Int p = 0; p < comm->NumProc(); ++p )
+    {
+        Int numRowsOfP ( rows.size() );
+        comm->Broadcast ( &numRowsOfP, 1, p );
+
+        std::vector<Int> rowsOfP ( rows.begin(), rows.end() );
+        std::vector<Real> dataOfP ( data );
+        rowsOfP.resize ( numRowsOfP );
+        dataOfP.resize ( numRowsOfP );
+        comm->Broadcast ( &rowsOfP[ 0 ], numRowsOfP, p );
+        comm->Broadcast ( &dataOfP[ 0 ], numRowsOfP, p );
+
+        for ( Int i = 0; i < numRowsOfP; ++i )
+        {
+            matrixReference->diagonalize ( rowsOfP[ i ], coefficient, rhsReference, dataOfP[ i ], offset );
+            matrixNoRhsReference->diagonalize ( rowsOfP[ i ], coefficient, offset );
+        }
+    }
+
+    const Real matrixError ( matrixDifference ( *matrix, *matrixReference ) );
+    const Real matrixNoRhsError ( matrixDifference ( *matrixNoRhs, *matrixNoRhsReference ) );
+    vector_Type rhsDifference ( rhs );
+    rhsDifference -= rhsReference;
+    const Real rhsError ( rhsDifference.normInf() );
+
+    if ( verbose )
+    {
+        std::cout << "matrix difference          : " << matrixError << std::endl;
+        std::cout << "matrix difference (no rhs) : " << matrixNoRhsError << std::endl;
+        std::cout << "rhs difference             : " << rhsError << std::endl;
+    }
+
+#ifdef HAVE_MPI
+    MPI_Finalize();
+#endif
+
+    if ( matrixError > 0. || matrixNoRhsError > 0. || rhsError > 0. )
+    {
+        return ( EXIT_FAILURE );
+    }
+
+    if ( verbose )
+    {
+        std::cout << "End Result: TEST PASSED" << std::endl;
+    }
+    return ( EXIT_SUCCESS );
+}
@@ -65,6 +65,44 @@ typedef FESpace<mesh_Type, MapEpetra> feSpace_Type;
 typedef boost::shared_ptr<feSpace_Type> feSpacePtr_Type;
 typedef MeshPartitionTool<mesh_Type> meshCutter_Type;
 
+// Check the local numbering of the vertices of a mesh part against the one
+// given by a map, as the builder did before using sorted tables: vertices are
+// numbered in the order in which they are first visited by the local elements
+bool checkLocalVertices (const mesh_Type& meshPart)
+{
+    std::map<ID, ID> globalToLocal;
+    for (UInt iElement = 0; iElement < meshPart.numElements(); ++iElement)
+    {
+        for (UInt iVertex = 0; iVertex < mesh_Type::element_Type::S_numVertices; ++iVertex)
+        {
+            const mesh_Type::point_Type& point = meshPart.element (iElement).point (iVertex);
+            std::map<ID, ID>::const_iterator it = globalToLocal.find (point.id() );
+            if (it == globalToLocal.end() )
+            {
+                it = globalToLocal.insert (std::make_pair (point.id(), static_cast<ID> (globalToLocal.size() ) ) ).first;
+            }
+            if (point.localId() != it->second)
+            {
+                return false;
+            }
+        }
+    }
+
+    if (globalToLocal.size() != meshPart.numVertices() )
+    {
+        return false;
+    }
+    for (UInt iPoint = 0; iPoint < meshPart.numVertices(); ++iPoint)
+    {
+        if (meshPart.point (iPoint).localId() != iPoint
+                || globalToLocal[meshPart.point (iPoint).id()] != iPoint)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
 int main ( int argc, char** argv )
 {
 
@@ -128,6 +166,21 @@ int main ( int argc, char** argv )
         std::cout << " done ! " << std::endl;
     }
 
+    // Check the local numbering of the vertices on all the processes
+    {
+        Int localCheck (checkLocalVertices (*meshPart) ? 1 : 0);
+        Int globalCheck (0);
+        Comm->MinAll (&localCheck, &globalCheck, 1);
+        if (! globalCheck)
+        {
+            if (verbose)
+            {
+                std::cout << " <!> Local vertex numbering has changed !!! <!> " << std::endl;
+            }
+            return EXIT_FAILURE;
+        }
+    }
+
     if (verbose)
     {
         std::cout << " -- Freeing the global mesh ... " << std::flush;
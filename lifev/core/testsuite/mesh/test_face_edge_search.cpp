@@ -0,0 +1,262 @@
+//@HEADER
+/*
+*******************************************************************************
+
+    Copyright (C) 2004, 2005, 2007 EPFL, Politecnico di Milano, INRIA
+    Copyright (C) 2010 EPFL, Politecnico di Milano, Emory University
+
+    This file is part of LifeV.
+
+    LifeV is free software; you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    LifeV is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with LifeV.  If not, see <http://www.gnu.org/licenses/>.
+
+*******************************************************************************
+*/
+
+/*!
+    @file
+    @brief Test of the face and edge search of MeshUtility
+
+    @date 19-10-2026
+
+    findFaces, findBoundaryEdges and findInternalEdges deduplicate the bare
+    entities with a sort. Their output is compared with the one of the map
+    based search they replaced, kept here as reference, on a tetrahedral and
+    on a hexahedral mesh.
+ */
+
+// ===================================================
+//! Includes
+// ===================================================
+
+#include <Epetra_ConfigDefs.h>
+#ifdef HAVE_MPI
+#include <mpi.h>
+#include <Epetra_MpiComm.h>
+#else
+#include <Epetra_SerialComm.h>
+#endif
+
+
+#include <lifev/core/LifeV.hpp>
+
+#include <lifev/core/mesh/RegionMesh.hpp>
+#include <lifev/core/mesh/RegionMesh3DStructured.hpp>
+#include <lifev/core/mesh/MeshData.hpp>
+#include <lifev/core/mesh/MeshUtility.hpp>
+
+using namespace LifeV;
+using namespace LifeV::MeshUtility;
+
+// put all local stuff in a local namespace
+namespace
+{
+
+// Map based search, as it was before the sort based one
+template <typename MeshType>
+UInt findFacesReference ( const MeshType& mesh, temporaryFaceContainer_Type& boundaryFaceContainer,
+                          UInt& numInternalFaces, temporaryFaceContainer_Type& internalFaces )
+{
+    typename MeshType::elementShape_Type volumeShape;
+    temporaryFaceContainer_Type::iterator faceContainerIterator;
+
+    boundaryFaceContainer.clear();
+    internalFaces.clear();
+    numInternalFaces = 0;
+
+    for ( typename MeshType::volumes_Type::const_iterator volume = mesh.volumeList.begin();
+            volume != mesh.volumeList.end(); ++volume )
+    {
+        for ( ID jFaceLocalId = 0; jFaceLocalId < mesh.numLocalFaces(); ++jFaceLocalId )
+        {
+            const UInt point1Id ( volume->point ( volumeShape.faceToPoint ( jFaceLocalId, 0 ) ).localId() );
+            const UInt point2Id ( volume->point ( volumeShape.faceToPoint ( jFaceLocalId, 1 ) ).localId() );
+            const UInt point3Id ( volume->point ( volumeShape.faceToPoint ( jFaceLocalId, 2 ) ).localId() );
+            BareFace bareFace;
+            if ( MeshType::facetShape_Type::S_numVertices == 4 )
+            {
+                const UInt point4Id ( volume->point ( volumeShape.faceToPoint ( jFaceLocalId, 3 ) ).localId() );
+                bareFace = ( makeBareFace ( point1Id, point2Id, point3Id, point4Id ) ).first;
+            }
+            else
+            {
+                bareFace = ( makeBareFace ( point1Id, point2Id, point3Id ) ).first;
+            }
+
+            if ( ( faceContainerIterator = boundaryFaceContainer.find ( bareFace ) ) == boundaryFaceContainer.end() )
+            {
+                boundaryFaceContainer.insert ( std::make_pair ( bareFace, std::make_pair ( volume->localId(), jFaceLocalId ) ) );
+            }
+            else
+            {
+                if ( point1Id > point2Id )
+                {
+                    internalFaces.insert ( std::make_pair ( bareFace, std::make_pair ( volume->localId(), jFaceLocalId ) ) );
+                }
+                boundaryFaceContainer.erase ( faceContainerIterator );
+                ++numInternalFaces;
+            }
+        }
+    }
+    return boundaryFaceContainer.size();
+}
+
+template <typename MeshType>
+UInt findBoundaryEdgesReference ( const MeshType& mesh, temporaryEdgeContainer_Type& boundaryEdgeContainer )
+{
+    typedef typename MeshType::facetShape_Type facetShape_Type;
+
+    boundaryEdgeContainer.clear();
+
+    for ( typename MeshType::faces_Type::const_iterator face = mesh.faceList.begin();
+            face != mesh.faceList.begin() + mesh.numBFaces(); ++face )
+    {
+        for ( ID jEdgeLocalId = 0; jEdgeLocalId < mesh.numLocalEdgesOfFace(); ++jEdgeLocalId )
+        {
+            const UInt point1Id ( face->point ( facetShape_Type::edgeToPoint ( jEdgeLocalId, 0 ) ).localId() );
+            const UInt point2Id ( face->point ( facetShape_Type::edgeToPoint ( jEdgeLocalId, 1 ) ).localId() );
+            boundaryEdgeContainer.insert ( std::make_pair ( makeBareEdge ( point1Id, point2Id ).first,
+                                                            std::make_pair ( face->localId(), jEdgeLocalId ) ) );
+        }
+    }
+    return boundaryEdgeContainer.size();
+}
+
+template <typename MeshType>
+UInt findInternalEdgesReference ( const MeshType& mesh,
+                                  const temporaryEdgeContainer_Type& boundaryEdgeContainer,
+                                  temporaryEdgeContainer_Type& internalEdgeContainer )
+{
+    typedef typename MeshType::elementShape_Type volumeShape_Type;
+
+    internalEdgeContainer.clear();
+
+    for ( typename MeshType::volumes_Type::const_iterator volume = mesh.volumeList.begin();
+            volume != mesh.volumeList.end(); ++volume )
+    {
+        for ( ID jEdgeLocalId = 0; jEdgeLocalId < mesh.numLocalEdges(); ++jEdgeLocalId )
+        {
+            const UInt point1Id ( volume->point ( volumeShape_Type::edgeToPoint ( jEdgeLocalId, 0 ) ).localId() );
+            const UInt point2Id ( volume->point ( volumeShape_Type::edgeToPoint ( jEdgeLocalId, 1 ) ).localId() );
+            const BareEdge bareEdge ( makeBareEdge ( point1Id, point2Id ).first );
+            if ( boundaryEdgeContainer.find ( bareEdge ) == boundaryEdgeContainer.end() )
+            {
+                internalEdgeContainer.insert ( std::make_pair ( bareEdge, std::make_pair ( volume->localId(), jEdgeLocalId ) ) );
+            }
+        }
+    }
+    return internalEdgeContainer.size();
+}
+
+// Compare the searches on a mesh, returns the number of differences
+template <typename MeshType>
+UInt compareSearches ( const MeshType& mesh, const std::string& name, const bool verbose )
+{
+    UInt errors ( 0 );
+
+    temporaryFaceContainer_Type boundaryFaces, internalFaces;
+    temporaryFaceContainer_Type boundaryFacesReference, internalFacesReference;
+    UInt numInternalFaces ( 0 ), numInternalFacesReference ( 0 );
+
+    findFaces ( mesh, boundaryFaces, numInternalFaces, internalFaces, true );
+    findFacesReference ( mesh, boundaryFacesReference, numInternalFacesReference, internalFacesReference );
+
+    if ( boundaryFaces != boundaryFacesReference )
+    {
+        ++errors;
+        std::cerr << name << ": the boundary faces differ" << std::endl;
+    }
+    if ( internalFaces != internalFacesReference || numInternalFaces != numInternalFacesReference )
+    {
+        ++errors;
+        std::cerr << name << ": the internal faces differ" << std::endl;
+    }
+
+    temporaryEdgeContainer_Type boundaryEdges, internalEdges;
+    temporaryEdgeContainer_Type boundaryEdgesReference, internalEdgesReference;
+
+    findBoundaryEdges ( mesh, boundaryEdges );
+    findBoundaryEdgesReference ( mesh, boundaryEdgesReference );
+    if ( boundaryEdges != boundaryEdgesReference )
+    {
+        ++errors;
+        std::cerr << name << ": the boundary edges differ" << std::endl;
+    }
+
+    findInternalEdges ( mesh, boundaryEdges, internalEdges );
+    findInternalEdgesReference ( mesh, boundaryEdgesReference, internalEdgesReference );
+    if ( internalEdges != internalEdgesReference )
+    {
+        ++errors;
+        std::cerr << name << ": the internal edges differ" << std::endl;
+    }
+
+    if ( verbose )
+    {
+        std::cout << name << ": " << boundaryFaces.size() << " boundary faces, "
+                  << numInternalFaces << " internal faces, "
+                  << boundaryEdges.size() << " boundary edges, "
+                  << internalEdges.size() << " internal edges" << std::endl;
+    }
+
+    return errors;
+}
+
+} // anonymous namespace
+
+int main ( int argc, char** argv )
+{
+    // verbosity
+    bool verbose = 1;
+
+    // communicator
+#ifdef HAVE_MPI
+    MPI_Init (&argc, &argv);
+    boost::shared_ptr<Epetra_Comm> comm ( new Epetra_MpiComm ( MPI_COMM_WORLD ) );
+    verbose = comm->MyPID() == 0;
+#else
+    boost::shared_ptr<Epetra_Comm> comm ( new Epetra_SerialComm );
+#endif
+
+    UInt errors ( 0 );
+
+    // structured tetrahedral mesh of the unit cube
+    RegionMesh<LinearTetra> tetraMesh ( comm );
+    regularMesh3D ( tetraMesh, 1, 6, 5, 4 );
+    errors += compareSearches ( tetraMesh, "tetrahedra", verbose );
+
+    // hexahedral mesh
+    RegionMesh<LinearHexa> hexaMesh ( comm );
+    MeshData meshData;
+    meshData.setMeshDir ( "./" );
+    meshData.setMeshFile ( "hexahexa_4x4x4.mesh" );
+    meshData.setMeshType ( ".mesh" );
+    meshData.setVerbose ( false );
+    readMesh ( hexaMesh, meshData );
+    errors += compareSearches ( hexaMesh, "hexahedra", verbose );
+
+#ifdef HAVE_MPI
+    MPI_Finalize();
+#endif
+
+    if ( errors > 0 )
+    {
+        return EXIT_FAILURE;
+    }
+
+    if ( verbose )
+    {
+        std::cout << "End Result: TEST PASSED" << std::endl;
+    }
+    return EXIT_SUCCESS;
+}
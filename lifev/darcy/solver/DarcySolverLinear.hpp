@@ -40,6 +40,9 @@
 #define _DARCYSOLVERLINEAR_HPP_ 1
 
 
+#include <algorithm>
+#include <vector>
+
 #include <Epetra_LAPACK.h>
 #include <Epetra_BLAS.h>
 
@@ -235,6 +238,10 @@ namespace LifeV
     \f]
     @note In the code we do not use the matrix \f$ H \f$ and the vector \f$ G \f$, because all the boundary
     conditions are imposed via BCHandler class.
+    @note The factorized local matrices computed during the static condensation are stored for each element
+    and used again to recover the primal and dual variables. If the local matrices do not change among
+    different calls of buildSystem (e.g. a transient problem with fixed permeability and time step) they
+    can be reused also for the next systems, see setReuseLocalMatrices.
     @note Example of usage can be found in darcy_nonlinear and darcy_linear.
     Coupled with an hyperbolic solver in impes.
     @todo Insert any scientific publications that use this solver.
@@ -337,7 +344,10 @@ public:
     //@{
 
     //! Constructor for the class.
-    DarcySolverLinear () {};
+    DarcySolverLinear () :
+        M_localFactorsUpdated ( false ),
+        M_reuseLocalMatrices ( false )
+    {};
 
     //! Virtual destructor.
     virtual ~DarcySolverLinear () {};
@@ -411,6 +421,7 @@ public:
     virtual void setInversePermeability ( const matrixFctPtr_Type& invPermFct )
     {
         M_inversePermeabilityFct = invPermFct;
+        M_localFactorsUpdated = false;
     }
 
     //! Set the coefficient for the reaction term.
@@ -421,6 +432,22 @@ public:
     void setReactionTerm ( const scalarFctPtr_Type& reactionTermFct )
     {
         M_reactionTermFct = reactionTermFct;
+        M_localFactorsUpdated = false;
+    }
+
+    //! Reuse the local matrices among different calls of buildSystem.
+    /*!
+      By default the local matrices are computed and factorized at each call of buildSystem.
+      If they do not depend on time or on the solution, e.g. for a transient problem with
+      fixed permeability, reaction term and time step, the factorization computed in the
+      first call can be reused, so only the local vectors are computed.
+      @param reuse True to reuse the factorized local matrices.
+      @note The factorization is computed again if the inverse of the permeability or
+      the reaction term are changed.
+    */
+    void setReuseLocalMatrices ( const bool reuse )
+    {
+        M_reuseLocalMatrices = reuse;
     }
 
     //! Set the hybrid field vector.
@@ -666,34 +693,47 @@ protected:
     virtual void localVectorComputation ( const UInt& iElem,
                                           VectorElemental& elvecMix );
 
+    //! Factorize the local matrices
+    /*!
+      Compute the Cholesky factorizations and the products needed by the static
+      condensation and by the recovery of the primal and dual variables, and the
+      local hybrid matrix. All of them are stored, one after the other, in localFactors.
+      @param localFactors The storage of the factorized matrices of the current element,
+      of size localFactorsSize().
+      @param elmatMix The local matrix in mixed form.
+      @param elmatReactionTerm The local matrix for the reaction term.
+    */
+    void localMatrixFactorization ( Real* localFactors,
+                                    MatrixElemental& elmatMix,
+                                    MatrixElemental& elmatReactionTerm );
+
     //! Performs static condensation
     /*!
       Locally eliminate pressure and velocity DOFs, create the local
       hybrid matrix and local hybrid right hand side.
       @param localMatrixHybrid The matrix which will store the hybrid local matrix.
       @param localVectorHybrid The vector which will store the hybrid local vector.
-      @param elmatMix The local matrix in mixed form.
-      @param elmatReactionTerm The local matrix for the reaction term.
+      @param localFactors The factorized local matrices, see localMatrixFactorization.
       @param elvecMix The local vector in mixed form.
     */
     void staticCondensation ( MatrixElemental& localMatrixHybrid,
                               VectorElemental& localVectorHybrid,
-                              MatrixElemental& elmatMix,
-                              MatrixElemental& elmatReactionTerm,
+                              const Real* localFactors,
                               VectorElemental& elvecMix );
 
     //! Compute locally, as a post process, the primal and dual variable given the hybrid.
     /*!
       @param localSolution A vector which stores the dual, primal and hybrid local solution.
-      @param elmatMix The local matrix in mixed form.
-      @param elmatReactionTerm The local matrix for the reaction term.
+      @param localFactors The factorized local matrices, see localMatrixFactorization.
       @param elvecMix The local vector in mixed form.
     */
     void localComputePrimalAndDual ( VectorElemental& localSolution,
-                                     MatrixElemental& elmatMix,
-                                     MatrixElemental& elmatReactionTerm,
+                                     const Real* localFactors,
                                      VectorElemental& elvecMix );
 
+    //! Number of reals needed to store the factorized local matrices of one element.
+    UInt localFactorsSize () const;
+
     //! Do some computation after the calculation of the primal and dual variable.
     /*!
       The function is empty while it is useful in derived classes, i.e. DarcySolverTransient.
@@ -795,6 +835,21 @@ protected:
 
     //@}
 
+    // Local matrices stuff.
+    //! @name Local matrices stuff
+    //@{
+
+    //! Factorized local matrices of all the elements, see localMatrixFactorization.
+    std::vector<Real> M_localFactors;
+
+    //! True if M_localFactors stores the factorization of the current local matrices.
+    bool M_localFactorsUpdated;
+
+    //! True if the local matrices are reused among different calls of buildSystem.
+    bool M_reuseLocalMatrices;
+
+    //@}
+
 }; // class DarcySolverLinear
 
 //
@@ -865,6 +920,14 @@ buildSystem ()
     // Prepare all the stuff before the loop on all the volume elements.
     preLoopElementsComputation ();
 
+    // Compute and factorize again the local matrices only if they cannot be reused.
+    const bool updateLocalFactors = !M_reuseLocalMatrices || !M_localFactorsUpdated;
+    const UInt localSize = localFactorsSize ();
+    if ( updateLocalFactors )
+    {
+        M_localFactors.resize ( meshNumberOfElements * localSize );
+    }
+
     //! Loop on all the volume elements.
     for ( UInt iElem (0); iElem < meshNumberOfElements; ++iElem )
     {
@@ -873,15 +936,23 @@ buildSystem ()
         localMatrixHybrid.zero();
         localVectorHybrid.zero();
 
-        // Compute the Hdiv mass matrix as a local matrix depending on the current element.
-        localMatrixComputation ( iElem, elmatMix, elmatReactionTerm );
+        // The factorized local matrices of the current element.
+        Real* const localFactors = &M_localFactors[ iElem * localSize ];
+
+        if ( updateLocalFactors )
+        {
+            // Compute the Hdiv mass matrix as a local matrix depending on the current element.
+            localMatrixComputation ( iElem, elmatMix, elmatReactionTerm );
+
+            // Factorize the local matrices and store them for the post process.
+            localMatrixFactorization ( localFactors, elmatMix, elmatReactionTerm );
+        }
 
         // Compute the source vectors as a local vectors depending on the current element.
         localVectorComputation ( iElem, elvecMix );
 
         // Perform the static condensation to compute the local hybrid matrix and the local hybrid right hand side.
-        staticCondensation ( localMatrixHybrid, localVectorHybrid,
-                             elmatMix, elmatReactionTerm, elvecMix );
+        staticCondensation ( localMatrixHybrid, localVectorHybrid, localFactors, elvecMix );
 
         /* Assemble the global hybrid matrix.
            M_primal_FESpace is used instead of M_hybridField_FESpace for currentLocalId,
@@ -904,6 +975,8 @@ buildSystem ()
     }
     //! End of loop volume operation.
 
+    M_localFactorsUpdated = true;
+
     chronoStaticCondensation.stop();
     M_displayer->leaderPrintMax ( " done in " , chronoStaticCondensation.diff() );
 
@@ -1029,8 +1102,17 @@ computePrimalAndDual ()
     // Elemental matrix for the reaction term.
     MatrixElemental elmatReactionTerm ( primalNbDof, 1, 1 );
 
-    // Compute all the constant matrices, e.g. the matrix B and C
-    computeConstantMatrices ( elmatMix );
+    /* The factorized local matrices are usually stored by buildSystem,
+       otherwise compute them here. */
+    const bool updateLocalFactors = !M_localFactorsUpdated;
+    const UInt localSize = localFactorsSize ();
+    if ( updateLocalFactors )
+    {
+        // Compute all the constant matrices, e.g. the matrix B and C
+        computeConstantMatrices ( elmatMix );
+
+        M_localFactors.resize ( meshNumberOfElements * localSize );
+    }
 
     // Element vector stores the local solution: (dual, primal, hybrid).
     VectorElemental localSolution ( dualNbDof, 1,
@@ -1043,8 +1125,17 @@ computePrimalAndDual ()
         // Clear the local solution vector.
         localSolution.zero();
 
-        // Compute the Hdiv mass matrix as a local matrix depending on the current element.
-        localMatrixComputation ( iElem,  elmatMix, elmatReactionTerm );
+        // The factorized local matrices of the current element.
+        Real* const localFactors = &M_localFactors[ iElem * localSize ];
+
+        if ( updateLocalFactors )
+        {
+            // Compute the Hdiv mass matrix as a local matrix depending on the current element.
+            localMatrixComputation ( iElem,  elmatMix, elmatReactionTerm );
+
+            // Factorize the local matrices.
+            localMatrixFactorization ( localFactors, elmatMix, elmatReactionTerm );
+        }
 
         // Compute the source vectors as local vector depending on the current element.
         localVectorComputation ( iElem, elvecMix );
@@ -1057,7 +1148,7 @@ computePrimalAndDual ()
                       M_primalField->getFESpace().fe().currentLocalId (), 2 );
 
         // Given the local hybrid variable, computes locally the primal and dual variable.
-        localComputePrimalAndDual ( localSolution, elmatMix, elmatReactionTerm, elvecMix );
+        localComputePrimalAndDual ( localSolution, localFactors, elvecMix );
 
         // Put the primal variable of the current finite element in the global vector M_primalField.
         assembleVector ( M_primalField->getVector (),
@@ -1085,6 +1176,8 @@ computePrimalAndDual ()
     }
     //! End of loop on the volume elements.
 
+    M_localFactorsUpdated = true;
+
     // Assemble the primal variable.
     M_primalField->getVector().globalAssemble ();
 
@@ -1261,15 +1354,13 @@ localVectorComputation ( const UInt& iElem, VectorElemental& elvecMix )
 
 } // localVectorComputation
 
-// Perform the static condensation for the local hybrid matrix.
+// Factorize the local matrices for the static condensation and the post process.
 template < typename MeshType >
 void
 DarcySolverLinear < MeshType >::
-staticCondensation ( MatrixElemental& localMatrixHybrid,
-                     VectorElemental& localVectorHybrid,
-                     MatrixElemental& elmatMix,
-                     MatrixElemental& elmatReactionTerm,
-                     VectorElemental& elvecMix  )
+localMatrixFactorization ( Real* localFactors,
+                           MatrixElemental& elmatMix,
+                           MatrixElemental& elmatReactionTerm )
 {
 
     // LAPACK wrapper of Epetra.
@@ -1281,8 +1372,6 @@ staticCondensation ( MatrixElemental& localMatrixHybrid,
     // Flags for the BLAS and LAPACK routine.
     Int INFO[1] = {0};
 
-    // Number of columns of the right hand side := 1.
-    const Int NBRHS = 1;
     // Primal variable degrees of freedom.
     const Int primalNbDof = M_primalField->getFESpace().refFE().nbDof();
     // Dual variable degrees of freedom.
@@ -1304,24 +1393,22 @@ staticCondensation ( MatrixElemental& localMatrixHybrid,
     // Parameter that indicates whether the matrix has diagonal unit ('N' means no).
     const char NODIAG = 'N';
 
-    // Create and assign the local matrices A, B and C.
-    MatrixElemental::matrix_type A = elmatMix.block ( 0, 0 );
-    MatrixElemental::matrix_type B = elmatMix.block ( 0, 1 );
-    MatrixElemental::matrix_type C = elmatMix.block ( 0, 2 );
-
-    // Create and assign the local vectors fv and fp.
-    VectorElemental::super fv = elvecMix.block ( 0 );
-    VectorElemental::super fp = elvecMix.block ( 1 );
+    // The local matrices are stored one after the other, in column major order.
+    Real* A   = localFactors;
+    Real* B   = A + dualNbDof * dualNbDof;
+    Real* C   = B + dualNbDof * primalNbDof;
+    Real* BtB = C + dualNbDof * hybridNbDof;
+    Real* BtC = BtB + primalNbDof * primalNbDof;
+    Real* CtC = BtC + primalNbDof * hybridNbDof;
 
-    // Create local matrices.
-    MatrixElemental::matrix_type BtB ( primalNbDof, primalNbDof );
-    MatrixElemental::matrix_type CtC ( hybridNbDof, hybridNbDof );
-    MatrixElemental::matrix_type BtC ( primalNbDof, hybridNbDof );
+    // Copy the local matrices A, B and C.
+    const MatrixElemental::matrix_type localA = elmatMix.block ( 0, 0 );
+    const MatrixElemental::matrix_type localB = elmatMix.block ( 0, 1 );
+    const MatrixElemental::matrix_type localC = elmatMix.block ( 0, 2 );
 
-    // Clean the local matrices.
-    BtB *= 0.;
-    CtC *= 0.;
-    BtC *= 0.;
+    std::copy ( static_cast<Real*> ( localA ), static_cast<Real*> ( localA ) + dualNbDof * dualNbDof, A );
+    std::copy ( static_cast<Real*> ( localB ), static_cast<Real*> ( localB ) + dualNbDof * primalNbDof, B );
+    std::copy ( static_cast<Real*> ( localC ), static_cast<Real*> ( localC ) + dualNbDof * hybridNbDof, C );
 
     //! Matrix operations.
     /* Put in A the matrix L and L^T, where L and L^T is the Cholesky factorization of A.
@@ -1336,7 +1423,7 @@ staticCondensation ( MatrixElemental& localMatrixHybrid,
 
     /* Put in C the matrix L^{-1} * C, solving a triangular system.
        For more details see http://www.netlib.org/lapack/lapack-3.1.1/SRC/dtrtrs.f */
-    lapack.TRTRS ( UPLO, NOTRANS, NODIAG, dualNbDof, hybridNbDof, A, dualNbDof, C, hybridNbDof, INFO );
+    lapack.TRTRS ( UPLO, NOTRANS, NODIAG, dualNbDof, hybridNbDof, A, dualNbDof, C, dualNbDof, INFO );
     ASSERT_PRE ( !INFO[0], "Lapack Computation C = L^{-1} C  is not achieved." );
 
     /* Put in BtB the matrix  B^T * L^{-T} * L^{-1} * B = B^T * A^{-1} * B
@@ -1345,9 +1432,15 @@ staticCondensation ( MatrixElemental& localMatrixHybrid,
     blas.SYRK ( UPLO, TRANS, primalNbDof, dualNbDof, ONE, B, dualNbDof, ZERO, BtB, primalNbDof );
 
     /* Put in BtB the matrix
-       BtB + M_elmatReactionTerm = B^T * A^{-1} * B + elmatReactionTerm
+       BtB + elmatReactionTerm = B^T * A^{-1} * B + elmatReactionTerm
        BtB stored only on lower part. */
-    BtB += elmatReactionTerm.mat();
+    for ( Int j ( 0 ); j < primalNbDof; ++j )
+    {
+        for ( Int i ( j ); i < primalNbDof; ++i )
+        {
+            BtB [ i + j * primalNbDof ] += elmatReactionTerm.mat() ( i, j );
+        }
+    }
 
     /* Put in CtC the matrix C^T * L^{-T} * L^{-1} * C = C^T * A^{-1} * C
        CtC stored only on lower part.
@@ -1377,6 +1470,17 @@ staticCondensation ( MatrixElemental& localMatrixHybrid,
        For more details see http://www.netlib.org/slatec/lin/dsyrk.f  */
     blas.SYRK ( UPLO, TRANS, hybridNbDof, primalNbDof, ONE, BtC, primalNbDof, MINUSONE, CtC, hybridNbDof );
 
+    /* Previously the matrix CtC is stored only in the lower part, but at the moment there is not
+       a function assembleMatrix that store a lower triangular sparse matrix.
+       Remind to correct these line in the future. */
+    for ( Int i ( 0 ); i < hybridNbDof; ++i )
+    {
+        for ( Int j ( i + 1 ); j < hybridNbDof; ++j )
+        {
+            CtC [ i + j * hybridNbDof ] = CtC [ j + i * hybridNbDof ];
+        }
+    }
+
     //! End of matrix operations.
 
     /*
@@ -1384,11 +1488,67 @@ staticCondensation ( MatrixElemental& localMatrixHybrid,
        A stores L and L^T where L and L^T is the Cholesky factorization of A
        B stores L^{-1} * B
        C stores L^{-1} * C
-       B^T stores LB and LB^T where LB and LB^T is the factorization of B^T * A^{-1} * B + elmatReactionTerm
+       BtB stores LB and LB^T where LB and LB^T is the factorization of B^T * A^{-1} * B + elmatReactionTerm
        BtC stores LB^{-1} * B^T * A^{-1} * C
        CtC stores -C^T * A^{-1} * C + C^T * A^{-t} * B * ( B^T * A^{-1} * B + elmatReactionTerm )^{-1} * B^T * A^{-1} * C
     */
 
+} // localMatrixFactorization
+
+// Perform the static condensation for the local hybrid matrix.
+template < typename MeshType >
+void
+DarcySolverLinear < MeshType >::
+staticCondensation ( MatrixElemental& localMatrixHybrid,
+                     VectorElemental& localVectorHybrid,
+                     const Real* localFactors,
+                     VectorElemental& elvecMix  )
+{
+
+    // LAPACK wrapper of Epetra.
+    Epetra_LAPACK lapack;
+
+    // BLAS wrapper of Epetra.
+    Epetra_BLAS blas;
+
+    // Flags for the BLAS and LAPACK routine.
+    Int INFO[1] = {0};
+
+    // Number of columns of the right hand side := 1.
+    const Int NBRHS = 1;
+    // Primal variable degrees of freedom.
+    const Int primalNbDof = M_primalField->getFESpace().refFE().nbDof();
+    // Dual variable degrees of freedom.
+    const Int dualNbDof = M_dualField->getFESpace().refFE().nbDof();
+    // Hybrid variable degree of freedom.
+    const Int hybridNbDof = M_hybridField->getFESpace().refFE().nbDof();
+
+    const Real ONE = 1.0;
+    const Real MINUSONE = -1.0;
+    const Real ZERO = 0.0;
+
+    // Parameter that indicate the Lower storage of matrices.
+    const char UPLO = 'L';
+
+    // Paramater that indicate the Transpose of matrices.
+    const char TRANS = 'T';
+    const char NOTRANS = 'N';
+
+    // Parameter that indicates whether the matrix has diagonal unit ('N' means no).
+    const char NODIAG = 'N';
+
+    // The factorized local matrices, see localMatrixFactorization.
+    const Real* A   = localFactors;
+    const Real* B   = A + dualNbDof * dualNbDof;
+    const Real* C   = B + dualNbDof * primalNbDof;
+    const Real* BtB = C + dualNbDof * hybridNbDof;
+    const Real* BtC = BtB + primalNbDof * primalNbDof;
+    const Real* CtC = BtC + primalNbDof * hybridNbDof;
+
+    // Create and assign the local vectors fv and fp.
+    VectorElemental::super fv = elvecMix.block ( 0 );
+    VectorElemental::super fp = elvecMix.block ( 1 );
+
     //! Vector operations.
 
     /* Put in fp the vector LB^{-1} * fp = LB^{-1} Fp
@@ -1412,7 +1572,7 @@ staticCondensation ( MatrixElemental& localMatrixHybrid,
        = C^T * A^{-1} * ( B^T * ( B^T * A^{-1} * B + elmatReactionTerm )^{-1} * Fp - Fv )
        localVectorHybrid is fully stored.
        For more details see http://www.netlib.org/blas/dgemm.f */
-    blas.GEMM ( TRANS, NOTRANS, hybridNbDof, NBRHS, hybridNbDof, MINUSONE, C, hybridNbDof, fv, dualNbDof,
+    blas.GEMM ( TRANS, NOTRANS, hybridNbDof, NBRHS, dualNbDof, MINUSONE, C, dualNbDof, fv, dualNbDof,
                 ONE, localVectorHybrid, hybridNbDof );
 
     /* Put in fp the vector B^T * L^{-T} * fv =  B^T * A^{-1} * Fv
@@ -1434,13 +1594,14 @@ staticCondensation ( MatrixElemental& localMatrixHybrid,
 
     //! End of vector operations.
 
-    /* Previously the matrix CtC is stored only in the lower part, but at the moment there is not
-       a function assembleMatrix that store a lower triangular sparse matrix.
-       Remind to correct these line in the future. */
-    symmetrizeMatrix ( hybridNbDof, CtC );
-
     // Update the hybrid element matrix.
-    localMatrixHybrid.block (0, 0) = CtC;
+    for ( Int j ( 0 ); j < hybridNbDof; ++j )
+    {
+        for ( Int i ( 0 ); i < hybridNbDof; ++i )
+        {
+            localMatrixHybrid.mat() ( i, j ) = CtC [ i + j * hybridNbDof ];
+        }
+    }
 
 } // staticCondensation
 
@@ -1449,8 +1610,7 @@ template < typename MeshType >
 void
 DarcySolverLinear < MeshType >::
 localComputePrimalAndDual ( VectorElemental& localSolution,
-                            MatrixElemental& elmatMix,
-                            MatrixElemental& elmatReactionTerm,
+                            const Real* localFactors,
                             VectorElemental& elvecMix )
 {
 
@@ -1475,7 +1635,6 @@ localComputePrimalAndDual ( VectorElemental& localSolution,
 
     const Real ONE = 1.0;
     const Real MINUSONE = -1.0;
-    const Real ZERO = 0.0;
 
     // Parameter that indicate the Lower storage of matrices.
     const char UPLO = 'L';
@@ -1485,71 +1644,7 @@ localComputePrimalAndDual ( VectorElemental& localSolution,
     // Parameter that indicates whether the matrix has diagonal unit ('N' means no)
     const char NODIAG = 'N';
 
-    // No need for CtC in this part, and last dsyrk, the only differences.
-    MatrixElemental::matrix_type A = elmatMix.block ( 0, 0 );
-    MatrixElemental::matrix_type B = elmatMix.block ( 0, 1 );
-    MatrixElemental::matrix_type C = elmatMix.block ( 0, 2 );
-
-    VectorElemental::super fv = elvecMix.block ( 0 );
-    VectorElemental::super fp = elvecMix.block ( 1 );
-
-    // Matrix Operations
-
-    // Create local matrices.
-    MatrixElemental::matrix_type BtB ( primalNbDof, primalNbDof );
-    MatrixElemental::matrix_type BtC ( primalNbDof, hybridNbDof );
-
-    // Clean the local matrices.
-    BtB *= 0.;
-    BtC *= 0.;
-
-    // Matrix Operations
-
-    /* Put in A the matrix L and L^T, where L and L^T is the Cholesky factorization of A.
-       For more details see http://www.netlib.org/lapack/double/dpotrf.f */
-    lapack.POTRF ( UPLO, dualNbDof, A, dualNbDof, INFO );
-    ASSERT_PRE ( !INFO[0], "Lapack factorization of A is not achieved." );
-
-    /* Put in B the matrix L^{-1} * B, solving a triangular system.
-       For more details see http://www.netlib.org/lapack/lapack-3.1.1/SRC/dtrtrs.f */
-    lapack.TRTRS ( UPLO, NOTRANS, NODIAG, dualNbDof, primalNbDof, A, dualNbDof, B, dualNbDof, INFO );
-    ASSERT_PRE ( !INFO[0], "Lapack Computation B = L^{-1} B  is not achieved." );
-
-    /* Put in C the matrix L^{-1} * C, solving a triangular system.
-       For more details see http://www.netlib.org/lapack/lapack-3.1.1/SRC/dtrtrs.f */
-    lapack.TRTRS ( UPLO, NOTRANS, NODIAG, dualNbDof, hybridNbDof, A, dualNbDof, C, dualNbDof, INFO );
-    ASSERT_PRE ( !INFO[0], "Lapack Computation C = L^{-1} C  is not achieved." );
-
-    /* Put in BtB the matrix  B^T * L^{-T} * L^{-1} * B = B^T * A^{-1} * B
-       BtB stored only on lower part.
-       For more details see http://www.netlib.org/slatec/lin/dsyrk.f */
-    blas.SYRK ( UPLO, TRANS, primalNbDof, dualNbDof, ONE, B, dualNbDof, ZERO, BtB, primalNbDof );
-
-    /* Put in BtB the matrix
-       BtB + elmatReactionTerm = B^T * A^{-1} * B + elmatReactionTerm
-       BtB stored only on lower part. */
-    BtB += elmatReactionTerm.mat();
-
-    /* Put in BtC the matrix B^T * L^{-T} * L^{-1} * C = B^T * A^{-1} * C
-       BtC fully stored.
-       For more details see http://www.netlib.org/blas/dgemm.f */
-    blas.GEMM ( TRANS, NOTRANS, primalNbDof, hybridNbDof, dualNbDof, ONE, B, dualNbDof, C,
-                dualNbDof, ZERO, BtC, primalNbDof );
-
-    /* Put in BtB the matrix LB and LB^T where LB and LB^T is the cholesky
-       factorization of B^T * A^{-1} * B + elmatReactionTerm.
-       For more details see http://www.netlib.org/lapack/double/dpotrf.f */
-    lapack.POTRF ( UPLO, primalNbDof, BtB, primalNbDof, INFO );
-    ASSERT_PRE ( !INFO[0], "Lapack factorization of BtB is not achieved." );
-
-    /* Put in BtC the matrix LB^{-1} * BtC = LB^{-1} * B^T * A^{-1} * C.
-       For more details see http://www.netlib.org/lapack/lapack-3.1.1/SRC/dtrtrs.f */
-    lapack.TRTRS ( UPLO, NOTRANS, NODIAG, primalNbDof, hybridNbDof, BtB, primalNbDof, BtC, primalNbDof, INFO );
-    ASSERT_PRE ( !INFO[0], "Lapack Computation BtC = LB^{-1} BtC is not achieved." );
-
-    //! End of matrix operations.
-
-    /* Sum up of the previews steps
+    /* The factorized local matrices, computed in the static condensation, see localMatrixFactorization.
        A stores L and L^T where L and L^T is the Cholesky factorization of A
        B stores L^{-1} * B
        C stores L^{-1} * C
@@ -1557,6 +1652,14 @@ localComputePrimalAndDual ( VectorElemental& localSolution,
              B^T * A^{-1} * B + elmatReactionTerm
        BtC stores LB^{-1} * B^T * A^{-1} * C
      */
+    const Real* A   = localFactors;
+    const Real* B   = A + dualNbDof * dualNbDof;
+    const Real* C   = B + dualNbDof * primalNbDof;
+    const Real* BtB = C + dualNbDof * hybridNbDof;
+    const Real* BtC = BtB + primalNbDof * primalNbDof;
+
+    VectorElemental::super fv = elvecMix.block ( 0 );
+    VectorElemental::super fp = elvecMix.block ( 1 );
 
     //! Vector operations, computation of primal and dual variable.
 
@@ -1610,7 +1713,7 @@ localComputePrimalAndDual ( VectorElemental& localSolution,
     /* Put in localDual the vector - C * localHybrid - localDual =
        = - L^{-1} * ( C * lambda_K + B^T * primal_K - fv )
        For more details see http://www.netlib.org/slatec/lin/dgemv.f */
-    blas.GEMV ( NOTRANS, dualNbDof, hybridNbDof, MINUSONE, C, hybridNbDof, localSolution.block ( 2 ),
+    blas.GEMV ( NOTRANS, dualNbDof, hybridNbDof, MINUSONE, C, dualNbDof, localSolution.block ( 2 ),
                 MINUSONE, localSolution.block ( 0 ) );
 
     /* Put in localDual the vector L^{-T} * localDual =
@@ -1623,6 +1726,23 @@ localComputePrimalAndDual ( VectorElemental& localSolution,
 
 } // localComputePrimalAndDual
 
+// Number of reals needed to store the factorized local matrices of one element.
+template < typename MeshType >
+UInt
+DarcySolverLinear < MeshType >::
+localFactorsSize () const
+{
+    const UInt primalNbDof = M_primalField->getFESpace().refFE().nbDof();
+    const UInt dualNbDof   = M_dualField->getFESpace().refFE().nbDof();
+    const UInt hybridNbDof = M_hybridField->getFESpace().refFE().nbDof();
+
+    // A, B, C, BtB, BtC and CtC.
+    return dualNbDof * ( dualNbDof + primalNbDof + hybridNbDof )
+           + primalNbDof * ( primalNbDof + hybridNbDof )
+           + hybridNbDof * hybridNbDof;
+
+} // localFactorsSize
+
 // Update all the variables of the problem.
 template < typename MeshType >
 void
@@ -575,6 +575,9 @@ setMass ( const scalarFctPtr_Type& massFct )
     // Save the mass function.
     M_massFct = massFct;
 
+    // The local matrices depend on the mass term.
+    this->M_localFactorsUpdated = false;
+
     // The total number of elements in the mesh.
     const UInt meshNumberOfElements = this->M_primalField->getFESpace().mesh()->numElements();
 
@@ -1927,7 +1927,7 @@ void ElectroETAMonodomainSolver<Mesh>::solveOneReactionStepRL (
     * (M_globalSolution.at (0) ) = * (M_globalSolution.at (0) )
                                    + ( (M_timeStep) / subiterations / M_ionicModelPtr -> membraneCapacitance() ) * (* (M_globalRhs.at (0) ) );
 
-    M_ionicModelPtr->superIonicModel::computeGatingVariablesWithRushLarsen (
+    M_ionicModelPtr->computeGatingVariablesWithRushLarsen (
         M_globalSolution, M_timeStep / subiterations);
     int offset = M_ionicModelPtr->numberOfGatingVariables() + 1;
     for (int i = offset; i < M_ionicModelPtr->Size(); i++)
@@ -2037,8 +2037,8 @@ void ElectroETAMonodomainSolver<Mesh>::solveSplitting (
 template<typename Mesh>
 void ElectroETAMonodomainSolver<Mesh>::solveOneStepGatingVariablesFE()
 {
-    M_ionicModelPtr->superIonicModel::computeGatingRhs (M_globalSolution,
-                                                        M_globalRhs);
+    M_ionicModelPtr->computeGatingRhs (M_globalSolution,
+                                       M_globalRhs);
 
     for (int i = 1; i < M_ionicModelPtr->Size(); i++)
     {
@@ -2050,7 +2050,7 @@ template<typename Mesh>
 void ElectroETAMonodomainSolver<Mesh>::solveOneStepGatingVariablesRL()
 {
 
-    M_ionicModelPtr->superIonicModel::computeGatingVariablesWithRushLarsen (
+    M_ionicModelPtr->computeGatingVariablesWithRushLarsen (
         M_globalSolution, M_timeStep);
     M_ionicModelPtr->superIonicModel::computeNonGatingRhs (M_globalSolution,
                                                            M_globalRhs);
@@ -317,6 +317,14 @@ void ElectroIonicModel::computeRhs (   const std::vector<vectorPtr_Type>& v,
 void ElectroIonicModel::computePotentialRhsICI (   const std::vector<vectorPtr_Type>& v,
                                                    std::vector<vectorPtr_Type>& rhs,
                                                    matrix_Type&                    massMatrix  )
+{
+    computePotentialRhsICI ( v, rhs );
+
+    ( * ( rhs.at (0) ) ) = massMatrix * ( * ( rhs.at (0) ) );
+}
+
+void ElectroIonicModel::computePotentialRhsICI (   const std::vector<vectorPtr_Type>& v,
+                                                   std::vector<vectorPtr_Type>& rhs )
 {
     int nodes = ( * (v.at (0) ) ).epetraVector().MyLength();
 
@@ -347,9 +355,6 @@ void ElectroIonicModel::computePotentialRhsICI (   const std::vector<vectorPtr_T
         ( * ( rhs.at (0) ) ) [j] =  computeLocalPotentialRhs ( localVec ) + M_appliedCurrent;
 
     }
-
-    ( * ( rhs.at (0) ) ) = massMatrix * ( * ( rhs.at (0) ) );
-
 }
 
 
@@ -422,6 +422,16 @@ public:
                                           std::vector<vectorPtr_Type>&        rhs,
                                           matrix_Type&                        massMatrix );
 
+    //! Compute the nodal values of the ionic currents in the right hand side of the voltage equation
+    /*!
+     * Same as above, but the currents are not multiplied by the mass matrix
+     * (e.g. when the mass matrix is applied matrix free).
+     * @param v vector of pointers to the  state variables vectors
+     * @param rhs vector of right hand side state variables
+     */
+    virtual void computePotentialRhsICI ( const std::vector<vectorPtr_Type>& v,
+                                          std::vector<vectorPtr_Type>&        rhs );
+
     //! Compute the right hand side of the voltage equation using SVI
     /*!
      * @param v vector of pointers to the  state variables vectors
@@ -119,21 +119,44 @@ void IonicHodgkinHuxley::computeGatingRhs ( const   std::vector<Real>&  v,
                                             std::vector<Real>& rhs )
 {
 
-    Real V = v[0];
-    Real M = v[1];
-    Real N = v[2];
-    Real H = v[3];
-
-    Real alpham = 0.1 * (25. - V) / (std::exp ( (25. - V) / 10.) - 1.);
-    Real betam = 4.*std::exp (-V / 18.0);
-    Real alphah = 0.07 * std::exp (-V / 20.);
-    Real betah = 1.0 / (std::exp ( (30. - V) / 10.) + 1.);
-    Real alphan = 0.01 * (10. - V) / (std::exp ( (10. - V) / 10.) - 1.);
-    Real betan = 0.125 * std::exp (-V / 80.0);
+    Real alpha[3];
+    Real beta[3];
+    computeRates (v[0], alpha, beta);
+
+    for ( UInt i = 0; i < 3; ++i )
+    {
+        rhs[i] = alpha[i] * (1 - v[i + 1]) - beta[i] * v[i + 1];
+    }
+}
 
-    rhs[0] = alpham * (1 - M) - betam * M;
-    rhs[1] = alphan * (1 - N) - betan * N;
-    rhs[2] = alphah * (1 - H) - betah * H;
+void IonicHodgkinHuxley::computeGatingRhs ( const std::vector<vectorPtr_Type>& v,
+                                            std::vector<vectorPtr_Type>& rhs )
+{
+    const Int nodes ( v.at (1)->epetraVector().MyLength() );
+
+    const Real* V ( v.at (0)->epetraVector() [0] );
+    const Real* gates[3] = { v.at (1)->epetraVector() [0],
+                             v.at (2)->epetraVector() [0],
+                             v.at (3)->epetraVector() [0]
+                           };
+    Real* gatesRhs[3] = { rhs.at (1)->epetraVector() [0],
+                          rhs.at (2)->epetraVector() [0],
+                          rhs.at (3)->epetraVector() [0]
+                        };
+
+    //Each node writes only its own entries: the loop can be shared among threads
+    #pragma omp parallel for
+    for ( Int k = 0; k < nodes; ++k )
+    {
+        Real alpha[3];
+        Real beta[3];
+        computeRates (V[k], alpha, beta);
+
+        for ( UInt i = 0; i < 3; ++i )
+        {
+            gatesRhs[i][k] = alpha[i] * (1 - gates[i][k]) - beta[i] * gates[i][k];
+        }
+    }
 }
 
 void IonicHodgkinHuxley::computeRhs ( const   std::vector<Real>&  v,
@@ -165,30 +188,43 @@ Real IonicHodgkinHuxley::computeLocalPotentialRhs ( const std::vector<Real>& v )
 
 void IonicHodgkinHuxley::computeGatingVariablesWithRushLarsen ( std::vector<Real>& v, const Real dt )
 {
-    Real V = v[0];
-    Real M = v[1];
-    Real N = v[2];
-    Real H = v[3];
-
-    Real alpham = 0.1 * (25. - V) / (std::exp ( (25. - V) / 10.) - 1.);
-    Real betam = 4.*std::exp (-V / 18.0);
-    Real alphah = 0.07 * std::exp (-V / 20.);
-    Real betah = 1.0 / (std::exp ( (30. - V) / 10.) + 1.);
-    Real alphan = 0.01 * (10. - V) / (std::exp ( (10. - V) / 10.) - 1.);
-    Real betan = 0.125 * std::exp (-V / 80.0);
-
-    Real taum = alpham + betam;
-    Real taun = alphan + betan;
-    Real tauh = alphah + betah;
-
-    Real mInf = alpham / (taum);
-    Real nInf = alphan / (taun);
-    Real hInf = alphah / (tauh);
-
-    v[1] = mInf + (M - mInf) * std::exp (-dt * taum);
-    v[2] = nInf + (N - nInf) * std::exp (-dt * taun);
-    v[3] = hInf + (H - hInf) * std::exp (-dt * tauh);
+    Real alpha[3];
+    Real beta[3];
+    computeRates (v[0], alpha, beta);
+
+    for ( UInt i = 0; i < 3; ++i )
+    {
+        const Real tau ( alpha[i] + beta[i] );
+        const Real gateInf ( alpha[i] / tau );
+        v[i + 1] = gateInf + (v[i + 1] - gateInf) * std::exp (-dt * tau);
+    }
+}
 
+void IonicHodgkinHuxley::computeGatingVariablesWithRushLarsen ( std::vector<vectorPtr_Type>& v, const Real dt )
+{
+    const Int nodes ( v.at (0)->epetraVector().MyLength() );
+
+    const Real* V ( v.at (0)->epetraVector() [0] );
+    Real* gates[3] = { v.at (1)->epetraVector() [0],
+                       v.at (2)->epetraVector() [0],
+                       v.at (3)->epetraVector() [0]
+                     };
+
+    //Each node writes only its own entries: the loop can be shared among threads
+    #pragma omp parallel for
+    for ( Int k = 0; k < nodes; ++k )
+    {
+        Real alpha[3];
+        Real beta[3];
+        computeRates (V[k], alpha, beta);
+
+        for ( UInt i = 0; i < 3; ++i )
+        {
+            const Real tau ( alpha[i] + beta[i] );
+            const Real gateInf ( alpha[i] / tau );
+            gates[i][k] = gateInf + (gates[i][k] - gateInf) * std::exp (-dt * tau);
+        }
+    }
 }
 
 void IonicHodgkinHuxley::showMe()
@@ -50,6 +50,8 @@
 
 #include <Teuchos_ParameterList.hpp>
 
+#include <cmath>
+
 namespace LifeV
 {
 //! IonicModel - This class implements the Hodgkin-Huxley model.
@@ -193,12 +195,40 @@ public:
      */
     void computeGatingVariablesWithRushLarsen ( std::vector<Real>& v, const Real dt );
 
+    //! Compute the rhs of the gating variables on all the nodes of the 3D problem
+    /*!
+     * The local entries of the vectors are visited directly, and the nodes are shared among threads
+     * @param v vector of pointers to the state variables vectors (V, M, N, H)
+     * @param rhs vector of pointers to the right hand side vectors of each variable
+     */
+    void computeGatingRhs ( const std::vector<vectorPtr_Type>& v, std::vector<vectorPtr_Type>& rhs );
+
+    //! Compute the gating variables with the RushLarsen scheme on all the nodes of the 3D problem
+    /*!
+     * The local entries of the vectors are visited directly, and the nodes are shared among threads
+     * @param v vector of pointers to the state variables vectors (V, M, N, H)
+     * @param dt timestep
+     */
+    void computeGatingVariablesWithRushLarsen ( std::vector<vectorPtr_Type>& v, const Real dt );
+
     //! Display information about the model
     void showMe();
 
     //@}
 
 private:
+
+    //! Opening (alpha) and closing (beta) rates of the gates M, N and H for the potential V
+    static inline void computeRates ( const Real V, Real alpha[3], Real beta[3] )
+    {
+        alpha[0] = 0.1 * (25. - V) / (std::exp ( (25. - V) / 10.) - 1.);
+        beta[0] = 4.*std::exp (-V / 18.0);
+        alpha[1] = 0.01 * (10. - V) / (std::exp ( (10. - V) / 10.) - 1.);
+        beta[1] = 0.125 * std::exp (-V / 80.0);
+        alpha[2] = 0.07 * std::exp (-V / 20.);
+        beta[2] = 1.0 / (std::exp ( (30. - V) / 10.) + 1.);
+    }
+
     //! Model Parameters
 
     //! Chemical kinetics parameters
@@ -0,0 +1,174 @@
+//@HEADER
+/*
+*******************************************************************************
+
+    Copyright (C) 2004, 2005, 2007 EPFL, Politecnico di Milano, INRIA
+    Copyright (C) 2010 EPFL, Politecnico di Milano, Emory University
+
+    This file is part of LifeV.
+
+    LifeV is free software; you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    LifeV is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with LifeV.  If not, see <http://www.gnu.org/licenses/>.
+
+*******************************************************************************
+*/
+
+/*!
+    @file
+    @brief Test of the whole-vector kernels of the Hodgkin Huxley model
+
+    The gating rhs and the Rush-Larsen update computed by IonicHodgkinHuxley
+    on all the local entries at once are compared with the node by node
+    versions of ElectroIonicModel, which gather the state of each node in a
+    std::vector and call the single node methods of the model.
+
+    @date 10 - 2026
+ */
+
+// Tell the compiler to ignore specific kind of warnings:
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+
+#include <Epetra_ConfigDefs.h>
+#ifdef EPETRA_MPI
+#include <mpi.h>
+#include <Epetra_MpiComm.h>
+#else
+#include <Epetra_SerialComm.h>
+#endif
+
+//Tell the compiler to restore the warning previously silented
+#pragma GCC diagnostic warning "-Wunused-variable"
+#pragma GCC diagnostic warning "-Wunused-parameter"
+
+#include <algorithm>
+#include <cmath>
+
+#include <lifev/electrophysiology/solver/IonicModels/IonicHodgkinHuxley.hpp>
+#include <lifev/core/LifeV.hpp>
+#include <lifev/core/array/MapEpetra.hpp>
+#include <lifev/core/array/VectorEpetra.hpp>
+
+using namespace LifeV;
+
+typedef ElectroIonicModel::vectorPtr_Type vectorPtr_Type;
+
+//Largest difference between the entries of the variables from 1 to size - 1
+Real maxDifference ( const std::vector<vectorPtr_Type>& a, const std::vector<vectorPtr_Type>& b )
+{
+    Real difference (0.0);
+    for ( UInt i = 1; i < a.size(); ++i )
+    {
+        VectorEpetra error ( *a[i] );
+        error -= *b[i];
+        difference = std::max ( difference, error.normInf() );
+    }
+    return difference;
+}
+
+Int main ( Int argc, char** argv )
+{
+#ifdef HAVE_MPI
+    MPI_Init ( &argc, &argv );
+    boost::shared_ptr<Epetra_Comm> comm ( new Epetra_MpiComm ( MPI_COMM_WORLD ) );
+#else
+    boost::shared_ptr<Epetra_Comm> comm ( new Epetra_SerialComm );
+#endif
+
+    const bool verbose ( comm->MyPID() == 0 );
+
+    IonicHodgkinHuxley ionicModel;
+    const UInt size ( ionicModel.Size() );
+
+    //********************************************//
+    // Distributed states covering the range of   //
+    // the action potential, away from the        //
+    // removable singularities of the rates       //
+    //********************************************//
+    const Int numberOfNodes (500);
+    MapEpetra map ( numberOfNodes, comm );
+
+    std::vector<vectorPtr_Type> states ( size );
+    std::vector<vectorPtr_Type> statesReference ( size );
+    std::vector<vectorPtr_Type> rhs ( size );
+    std::vector<vectorPtr_Type> rhsReference ( size );
+    for ( UInt i = 0; i < size; ++i )
+    {
+        states[i].reset ( new VectorEpetra ( map ) );
+        rhs[i].reset ( new VectorEpetra ( map ) );
+        rhsReference[i].reset ( new VectorEpetra ( map ) );
+    }
+
+    const Int nodes ( states[0]->epetraVector().MyLength() );
+    for ( Int k = 0; k < nodes; ++k )
+    {
+        const Int j ( states[0]->blockMap().GID (k) );
+        const Real s ( static_cast<Real> (j) / numberOfNodes );
+        ( *states[0] ) [j] = -20.0 + 137.3 * s;
+        ( *states[1] ) [j] = 0.01 + 0.98 * s;
+        ( *states[2] ) [j] = 0.99 - 0.97 * s;
+        ( *states[3] ) [j] = 0.5 + 0.45 * std::sin ( 7.0 * s );
+    }
+    for ( UInt i = 0; i < size; ++i )
+    {
+        statesReference[i].reset ( new VectorEpetra ( *states[i] ) );
+    }
+
+    const Real tolerance (1e-12);
+    Real error (0.0);
+
+    //********************************************//
+    // Gating rhs                                 //
+    //********************************************//
+    ionicModel.computeGatingRhs ( states, rhs );
+    ionicModel.ElectroIonicModel::computeGatingRhs ( states, rhsReference );
+    const Real rhsError ( maxDifference ( rhs, rhsReference ) );
+    error = std::max ( error, rhsError );
+
+    //********************************************//
+    // Rush-Larsen steps                          //
+    //********************************************//
+    const Real dt (0.01);
+    for ( UInt step = 0; step < 10; ++step )
+    {
+        ionicModel.computeGatingVariablesWithRushLarsen ( states, dt );
+        ionicModel.ElectroIonicModel::computeGatingVariablesWithRushLarsen ( statesReference, dt );
+    }
+    const Real rushLarsenError ( maxDifference ( states, statesReference ) );
+    error = std::max ( error, rushLarsenError );
+
+    if ( verbose )
+    {
+        std::cout << "Gating rhs difference: " << rhsError << std::endl;
+        std::cout << "Rush-Larsen difference: " << rushLarsenError << std::endl;
+    }
+
+#ifdef HAVE_MPI
+    MPI_Finalize();
+#endif
+
+    if ( error > tolerance )
+    {
+        if ( verbose )
+        {
+            std::cout << "\nTest Failed!\n";
+        }
+        return ( EXIT_FAILURE );
+    }
+
+    if ( verbose )
+    {
+        std::cout << "End Result: TEST PASSED" << std::endl;
+    }
+    return ( EXIT_SUCCESS );
+}
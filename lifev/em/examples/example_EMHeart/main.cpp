@@ -396,9 +396,64 @@ int main (int argc, char** argv)
     // Load restart file
     //============================================
     std::string restartInput = command_line.follow ("noRestart", 2, "-r", "--restart");
-    const bool restart ( restartInput != "noRestart" );
+    std::string checkpointInput = command_line.follow ("noCheckpoint", 2, "-cr", "--checkpointRestart");
+    const bool checkpointRestart ( checkpointInput != "noCheckpoint" );
+    const bool restart ( restartInput != "noRestart" || checkpointRestart );
+
+    // Binary checkpoint of the full state (fields, circulation and coupling history)
+    const Real dt_checkpoint = dataFile ( "exporter/checkpoint", 0. );
+    EMCheckpoint checkpoint ( problemFolder, "checkpoint", comm );
+    heartSolver.setupCheckpoint ( checkpoint );
+    
+    boost::shared_ptr<VectorEpetra> dispPrePtr ( new VectorEpetra ( disp ) );
+    checkpoint.addVector ( "Previous Displacement", dispPrePtr );
+    
+    // Reduced in-situ output (probes, region averages, volumes and pressures)
+    const Real dt_insitu = dataFile ( "exporter/insitu/save", 0. );
+    boost::shared_ptr<EMInSituOutput<mesh_Type> > insituOutput;
+    if ( dt_insitu > 0. )
+    {
+        // On restart the history is kept and the new records are appended
+        insituOutput.reset ( new EMInSituOutput<mesh_Type> ( problemFolder + "insitu.dat", comm, 100, restart ) );
+        heartSolver.setupInSituOutput ( *insituOutput, dataFile );
+    }
+    
+    auto toStd = [] (const VectorSmall<2>& v) { return std::vector<Real> { v(0), v(1) }; };
+    auto fromStd = [] (const std::vector<Real>& v) { VectorSmall<2> r; r(0) = v[0]; r(1) = v[1]; return r; };
 
-    if ( restart )
+    if ( checkpointRestart )
+    {
+        LifeChrono chronoRestart;
+        chronoRestart.start();
+        
+        heartSolver.restartFromCheckpoint ( checkpoint, std::stoi(checkpointInput), t );
+        
+        bcValues = checkpoint.data ( "bcValues" );
+        bcValuesPre = checkpoint.data ( "bcValuesPre" );
+        bcValues4thOAB = checkpoint.data ( "bcValues4thOAB" );
+        AvgWorkVent = fromStd ( checkpoint.data ( "AvgWorkVent" ) );
+        
+        const std::vector<Real>& JFeData ( checkpoint.data ( "JFe" ) );
+        JFe(0,0) = JFeData[0]; JFe(0,1) = JFeData[1]; JFe(1,0) = JFeData[2]; JFe(1,1) = JFeData[3];
+        
+        // Continue the export from the frame at the checkpoint time
+        heartSolver.exporter()->setTimeIndex( static_cast<UInt>( t / dt_save + 1.5 ) );
+        solver.structuralOperatorPtr() -> data() -> dataTime() -> setTime(t);
+        heartSolver.postProcess(t);
+        
+        // The mechanical state is restored: only set the boundary conditions
+        patchHandler.modifyPatchBC(solver, t);
+        modifyPressureBC(bcValues);
+        solver.bcInterfacePtr() -> updatePhysicalSolverVariables();
+
+        if ( 0 == comm->MyPID() )
+        {
+            std::cout << "\n*****************************************************************";
+            std::cout << "\nCheckpoint data imported in " << chronoRestart.diff() << " s";
+            std::cout << "\n*****************************************************************\n";
+        }
+    }
+    else if ( restart )
     {
         LifeChrono chronoRestart;
         chronoRestart.start();
@@ -630,8 +685,15 @@ int main (int argc, char** argv)
     VFe[1] = RV.volume(disp, dETFESpace, 1);
     VCirc = VFe;
     
+    if ( checkpointRestart )
+    {
+        VCirc = fromStd ( checkpoint.data ( "VCirc" ) );
+        VFe = fromStd ( checkpoint.data ( "VFe" ) );
+    }
+    
     VectorEpetra dispCurrent ( disp );
-    VectorEpetra dispPre ( disp );
+    VectorEpetra& dispPre ( *dispPrePtr );
+    if ( ! checkpointRestart ) dispPre = disp;
 
     ID bdPowerFlag  =  dataFile ( ("solid/boundary_conditions/LVEndo/flag") , 0 );
     
@@ -924,6 +986,31 @@ int main (int argc, char** argv)
             
             dispPre = disp;
             
+            
+            //============================================
+            // Write checkpoint
+            //============================================
+            if ( dt_checkpoint > 0. && std::abs(std::remainder(t, dt_checkpoint)) < 0.01 )
+            {
+                checkpoint.setData ( "bcValues", bcValues );
+                checkpoint.setData ( "bcValuesPre", bcValuesPre );
+                checkpoint.setData ( "bcValues4thOAB", bcValues4thOAB );
+                checkpoint.setData ( "VCirc", toStd ( VCirc ) );
+                checkpoint.setData ( "VFe", toStd ( VFe ) );
+                checkpoint.setData ( "AvgWorkVent", toStd ( AvgWorkVent ) );
+                checkpoint.setData ( "JFe", std::vector<Real> { JFe(0,0), JFe(0,1), JFe(1,0), JFe(1,1) } );
+                heartSolver.writeCheckpoint ( checkpoint, static_cast<UInt>( t / dt_checkpoint + 0.5 ), t );
+            }
+            
+        }
+        
+        
+        //============================================
+        // Reduced in-situ output
+        //============================================
+        if ( insituOutput && std::abs(std::remainder(t, dt_insitu)) < 0.01 )
+        {
+            heartSolver.writeInSituOutput ( *insituOutput, t, VFe, std::vector<Real> { p("lv"), p("rv") } );
         }
         
         
@@ -956,6 +1043,8 @@ int main (int argc, char** argv)
     //============================================
     solver.closeExporters();
     heartSolver.exporter()->closeFile();
+    checkpoint.wait();
+    if ( insituOutput ) insituOutput->flush();
     
 
 #ifdef HAVE_MPI
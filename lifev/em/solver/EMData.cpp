@@ -198,6 +198,12 @@ EMData::setupElectrophysiologyParameters(GetPot& dataFile, const std::string& se
     bool LumpedMass = dataFile ( ( section + "/discretization/LumpedMass" ).data(), false);
     M_electroParametersList.set ("LumpedMass", LumpedMass);
 
+    bool MatrixFree = dataFile ( ( section + "/discretization/MatrixFree" ).data(), false);
+    M_electroParametersList.set ("MatrixFree", MatrixFree);
+
+    int MatrixFreeLag = dataFile ( ( section + "/discretization/MatrixFreeLag" ).data(), 10);
+    M_electroParametersList.set ("MatrixFreeLag", MatrixFreeLag);
+
 
 }
 
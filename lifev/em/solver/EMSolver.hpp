@@ -508,6 +508,9 @@ public:
     
     vectorPtr_Type                       M_activationTimePtr;
 
+    //! Measure of the patches of the ZZ gradient recovery (the reference mesh does not move)
+    vectorPtr_Type                       M_patchMeasurePtr;
+
     bool                                 M_oneWayCoupling;
     
     WallTensionEstimator<RegionMesh<LinearTetra> > M_wteTotal;
@@ -536,6 +539,7 @@ EMSolver<Mesh, ElectroSolver>::EMSolver(commPtr_Type comm) :
     M_localMeshPtr      ( ),
     M_fullMeshPtr      ( ),
     M_activationTimePtr     ( ),
+    M_patchMeasurePtr       ( ),
     M_oneWayCoupling     (true),
     M_wteTotal ( ),
 //    M_wtePassive ( ),
@@ -560,6 +564,7 @@ EMSolver<Mesh, ElectroSolver>::EMSolver (const EMSolver& solver) :
     M_localMeshPtr      ( solver.M_localMeshPtr),
     M_fullMeshPtr      ( solver.M_fullMeshPtr),
     M_activationTimePtr     ( solver.M_activationTimePtr),
+    M_patchMeasurePtr       ( solver.M_patchMeasurePtr),
     M_oneWayCoupling     ( solver.M_oneWayCoupling),
     M_wteTotal                   (solver.M_wteTotal),
 //    M_wtePassive                   (solver.M_wtePassive),
@@ -1013,13 +1018,12 @@ template<typename Mesh , typename ElectroSolver>
 void
 EMSolver<Mesh, ElectroSolver>::computeI4f (VectorEpetra& i4f, VectorEpetra& f0_, VectorEpetra& disp, solidFESpacePtr_Type feSpacePtr)
 {
-    VectorEpetra dUdx (disp);
-    VectorEpetra dUdy (disp);
-    VectorEpetra dUdz (disp);
-    
-    dUdx = GradientRecovery::ZZGradient (feSpacePtr, disp, 0);
-    dUdy = GradientRecovery::ZZGradient (feSpacePtr, disp, 1);
-    dUdz = GradientRecovery::ZZGradient (feSpacePtr, disp, 2);
+    std::vector<vectorPtr_Type> gradientPtr;
+    GradientRecovery::ZZFullGradient (feSpacePtr, disp, gradientPtr, M_patchMeasurePtr);
+
+    const VectorEpetra& dUdx (*gradientPtr[0]);
+    const VectorEpetra& dUdy (*gradientPtr[1]);
+    const VectorEpetra& dUdz (*gradientPtr[2]);
     
     int n = i4f.epetraVector().MyLength();
     int i (0); int j (0); int k (0);
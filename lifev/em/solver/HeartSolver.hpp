@@ -15,6 +15,8 @@
 #include <lifev/em/solver/circulation/Circulation.hpp>
 
 #include <lifev/em/solver/HeartData.hpp>
+#include <lifev/em/util/EMCheckpoint.hpp>
+#include <lifev/em/util/EMInSituOutput.hpp>
 
 
 namespace LifeV
@@ -154,6 +156,98 @@ public:
     }
     
     
+    void setupCheckpoint(EMCheckpoint& checkpoint)
+    {
+        checkpoint.addVector ( "Displacement", M_emSolver.structuralOperatorPtr() -> displacementPtr() );
+        checkpoint.addVector ( "Activation", M_emSolver.activationModelPtr() -> fiberActivationPtr() );
+        if ( M_emSolver.activationTimePtr() ) checkpoint.addVector ( "Activation Time", M_emSolver.activationTimePtr() );
+        
+        for ( unsigned int i = 0; i < M_emSolver.electroSolverPtr()->globalSolution().size() ; ++i )
+        {
+            checkpoint.addVector ( "Ionic Variable " + std::to_string(i), M_emSolver.electroSolverPtr()->globalSolution().at(i) );
+        }
+    }
+    
+    
+    void writeCheckpoint(EMCheckpoint& checkpoint, const UInt& step, const Real& t)
+    {
+        std::vector<Real> ABHistory;
+        for ( unsigned int i = 0; i < m_ABdplv.size(); ++i ) ABHistory.push_back( m_ABdplv(i) );
+        for ( unsigned int i = 0; i < m_ABdprv.size(); ++i ) ABHistory.push_back( m_ABdprv(i) );
+        
+        checkpoint.setData ( "Circulation", M_circulationSolver.state() );
+        checkpoint.setData ( "Adams-Bashforth", ABHistory );
+        checkpoint.write ( step, t );
+        
+        if ( 0 == M_emSolver.comm()->MyPID() )
+        {
+            std::cout << "\nCheckpoint " << step << " at time = " << t << " written to " << checkpoint.fileName(step) << std::endl;
+        }
+    }
+    
+    
+    void restartFromCheckpoint(EMCheckpoint& checkpoint, const UInt& step, Real& t)
+    {
+        t = checkpoint.read ( step );
+        
+        M_circulationSolver.restartFromState ( checkpoint.data ( "Circulation" ) );
+        
+        const std::vector<Real>& ABHistory ( checkpoint.data ( "Adams-Bashforth" ) );
+        for ( unsigned int i = 0; i < m_ABdplv.size(); ++i ) m_ABdplv(i) = ABHistory[i];
+        for ( unsigned int i = 0; i < m_ABdprv.size(); ++i ) m_ABdprv(i) = ABHistory[m_ABdplv.size() + i];
+
+        if ( 0 == M_emSolver.comm()->MyPID() )
+        {
+            std::cout << "\nLoad from checkpoint: " << step << ",  time = " << t << std::endl;
+        }
+    }
+    
+    
+    void setupInSituOutput(EMInSituOutput<mesh_Type>& output, const GetPot& datafile)
+    {
+        // Cavity volumes and pressures
+        output.addScalar ( "V_lv" );
+        output.addScalar ( "V_rv" );
+        output.addScalar ( "p_lv" );
+        output.addScalar ( "p_rv" );
+        
+        // Point probes, given as a list of coordinates x1 y1 z1 x2 y2 z2 ...
+        const UInt nProbeCoordinates = datafile.vector_variable_size ( "exporter/insitu/probes" );
+        for ( UInt i = 0; i < nProbeCoordinates / 3; ++i )
+        {
+            Vector3D point;
+            for ( UInt j = 0; j < 3; ++j ) point(j) = datafile ( "exporter/insitu/probes", 0., 3 * i + j );
+            
+            const std::string probe ( "probe" + std::to_string(i) );
+            output.addProbe ( probe + "_potential", M_emSolver.electroSolverPtr()->potentialPtr(), M_emSolver.electroSolverPtr()->feSpacePtr(), point );
+            output.addProbe ( probe + "_activation", M_emSolver.activationModelPtr()->fiberActivationPtr(), M_emSolver.electroSolverPtr()->feSpacePtr(), point );
+            if ( M_emSolver.activationTimePtr() ) output.addProbe ( probe + "_activationTime", M_emSolver.activationTimePtr(), M_emSolver.electroSolverPtr()->feSpacePtr(), point );
+            for ( UInt j = 0; j < 3; ++j )
+            {
+                output.addProbe ( probe + "_displacement" + std::to_string(j), M_emSolver.structuralOperatorPtr()->displacementPtr(), M_emSolver.structuralOperatorPtr()->dispFESpacePtr(), point, j );
+            }
+        }
+        
+        // Average activation over the regions with the given markers
+        const UInt nRegions = datafile.vector_variable_size ( "exporter/insitu/regions" );
+        for ( UInt i = 0; i < nRegions; ++i )
+        {
+            const ID marker = datafile ( "exporter/insitu/regions", 0, i );
+            output.addRegionIntegral ( "region" + std::to_string(marker) + "_activation", M_emSolver.activationModelPtr()->fiberActivationPtr(), M_emSolver.electroSolverPtr()->feSpacePtr(), marker, 0, true );
+        }
+    }
+    
+    
+    void writeInSituOutput(EMInSituOutput<mesh_Type>& output, const Real& t, const VectorSmall<2>& volume, const std::vector<Real>& pressure)
+    {
+        output.setScalar ( "V_lv", volume[0] );
+        output.setScalar ( "V_rv", volume[1] );
+        output.setScalar ( "p_lv", pressure[0] );
+        output.setScalar ( "p_rv", pressure[1] );
+        output.record ( t );
+    }
+    
+    
     static Real Iapp (const Real& t, const Real&  X, const Real& Y, const Real& Z, const ID& /*i*/)
     {
         bool coords ( Y < -7. );
@@ -46,27 +46,39 @@ XBridge4SM::initialize( std::vector<Real>& variables )
 }
 
     
+inline void
+XBridge4SM::computeLocalRHS ( const Real* variables, Real Ca, Real* RHS ) const
+{
+    const Real TnCA   = variables[1];    // TnCA
+    const Real M      = variables[2];    // M
+    const Real CaTnCA = variables[3];    // Ca TnCA
+    const Real CaTnCAM= variables[4];    // Ca TnCA M
+    const Real TnCAM  = variables[5];    // TnCA M
+    const Real K1     = variables[6];    // K1
+    const Real Ka     = variables[7];    // Ka
+    
+    // Shared by the rates: attached x-bridges, bound and unbound calcium
+    const Real attached ( CaTnCAM + TnCAM );
+    const Real binding ( K1 * Ca * TnCA );
+    const Real attachment ( Ka * CaTnCA * M );
+    
+    RHS[0] = attached;
+    RHS[1] = - binding + M_K3 * CaTnCA + M_Kdd * TnCAM;
+    RHS[2] = M_Kdd * TnCAM - attachment + M_Kd * CaTnCAM;
+    RHS[3] = binding - M_K3 * CaTnCA - attachment + M_Kd * CaTnCAM;
+    RHS[4] = attachment + M_K2 * Ca * TnCAM - (M_Kd + M_K4) * CaTnCAM;
+    RHS[5] = M_K4 * CaTnCAM - M_Kdd * TnCAM - M_K2 * Ca *TnCAM;
+    RHS[6] = M_a1 * std::sqrt( attached ) + M_b1;
+    RHS[7] = M_aa * attached * attached + M_ba;
+}
+
+    
 void
 XBridge4SM::computeRHS ( const std::vector<Real>& variables, Real Ca, std::vector<Real>& RHS )
 {
-
-    auto XA     = variables.at (0);    // XA
-    auto TnCA   = variables.at (1);    // TnCA
-    auto M      = variables.at (2);    // M
-    auto CaTnCA = variables.at (3);    // Ca TnCA
-    auto CaTnCAM= variables.at (4);    // Ca TnCA M
-    auto TnCAM  = variables.at (5);    // TnCA M
-    auto K1     = variables.at (6);    // K1
-    auto Ka     = variables.at (7);    // Ka
-    
-    RHS.at(0) = CaTnCAM + TnCAM;
-    RHS.at(1) = - K1 * Ca * TnCA + M_K3 * CaTnCA + M_Kdd * TnCAM;
-    RHS.at(2) = M_Kdd * TnCAM - Ka * CaTnCA * M + M_Kd * CaTnCAM;
-    RHS.at(3) = K1 * Ca * TnCA - M_K3 * CaTnCA - Ka * CaTnCA * M + M_Kd * CaTnCAM;
-    RHS.at(4) = Ka * CaTnCA * M + M_K2 * Ca * TnCAM - (M_Kd + M_K4) * CaTnCAM;
-    RHS.at(5) = M_K4 * CaTnCAM - M_Kdd * TnCAM - M_K2 * Ca *TnCAM;
-    RHS.at(6) = M_a1 * std::pow( CaTnCAM + TnCAM , 0.5 ) + M_b1;
-    RHS.at(7) = M_aa * std::pow( CaTnCAM + TnCAM , 2.0 ) + M_ba;
+    if ( variables.size() != M_NVar || RHS.size() != M_NVar ) throw std::runtime_error("XBridge4SM::computeRHS: Number of variables not correct.");
+    
+    computeLocalRHS ( &variables[0], Ca, &RHS[0] );
 }
 
     
@@ -81,6 +93,42 @@ XBridge4SM::solveFE( std::vector<Real>& variables, Real Ca, Real dt)
         variables.at(i) += dt * RHS.at(i);
     }
 }
+
+    
+void
+XBridge4SM::solveFE( std::vector< std::vector<Real> >& variables, const std::vector<Real>& Ca, Real dt )
+{
+    if ( variables.size() != M_NVar ) throw std::runtime_error("XBridge4SM::solveFE: Number of variables not correct.");
+    
+    const int nodes ( Ca.size() );
+    if ( nodes == 0 ) return;
+    
+    Real* states[8];
+    for ( unsigned int i (0); i < M_NVar; ++i )
+    {
+        if ( variables[i].size() != Ca.size() ) throw std::runtime_error("XBridge4SM::solveFE: Number of nodes not correct.");
+        states[i] = &variables[i][0];
+    }
+    
+    // Each node writes only its own entries: the loop can be shared among threads
+    #pragma omp parallel for
+    for ( int k = 0; k < nodes; ++k )
+    {
+        Real local[8];
+        Real RHS[8];
+        for ( unsigned int i (0); i < 8; ++i )
+        {
+            local[i] = states[i][k];
+        }
+        
+        computeLocalRHS ( local, Ca[k], RHS );
+        
+        for ( unsigned int i (0); i < 8; ++i )
+        {
+            states[i][k] = local[i] + dt * RHS[i];
+        }
+    }
+}
     
     
 }
@@ -30,9 +30,18 @@ public:
     // Solve system with forward euler.
     void solveFE( std::vector<Real>& variables, Real Ca, Real dt );
     
+    // Solve system with forward euler on all the nodes at once.
+    // variables[i][k] is the variable i on the node k and Ca[k] the calcium
+    // on the node k: each variable is a contiguous array and the nodes are
+    // shared among threads.
+    void solveFE( std::vector< std::vector<Real> >& variables, const std::vector<Real>& Ca, Real dt );
+    
 
 private:
     
+    // Rhs of the x-bridge model on a single node.
+    inline void computeLocalRHS ( const Real* variables, Real Ca, Real* RHS ) const;
+    
     // Variables
    std::vector<Real> M_variables;
     
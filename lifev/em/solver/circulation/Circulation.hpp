@@ -19,6 +19,8 @@
 #include <string>
 #include <algorithm>
 
+#include <lifev/core/util/LifeAssert.hpp>
+
 #include "CirculationIO.hpp"
 #include "CirculationGridView.hpp"
 #include "CirculationCoupling.hpp"
@@ -258,6 +260,43 @@ public:
                                     
         M_time = u[0];
 
+        initRestart();
+    }
+    
+    // Full state (time, solution and previous solutions) for checkpointing
+    VectorStdDouble state() const
+    {
+        VectorStdDouble state ({M_time});
+        state.reserve( 1 + 3 * M_u.size() );
+        for ( const VectorEigen* u : { &M_u, &M_uPrev0, &M_uPrev1 } )
+        {
+            state.insert(state.end(), u->data(), u->data() + u->size());
+        }
+        return state;
+    }
+    
+    void restartFromState(const VectorStdDouble& state)
+    {
+        const unsigned int n ( M_u.size() );
+        if ( state.size() != 1 + 3 * n )
+        {
+            ERROR_MSG ( "Circulation: state size does not match the circulation grid" );
+        }
+        
+        M_time = state[0];
+        M_u = VectorEigen::Map( &state[1], n );
+        M_uPrev0 = VectorEigen::Map( &state[1 + n], n );
+        M_uPrev1 = VectorEigen::Map( &state[1 + 2 * n], n );
+        
+        initRestart();
+    }
+    
+
+private:
+    
+    // Pass the restored solution vectors to the elements
+    void initRestart()
+    {
         DofHandler dofh (M_gv);
         for ( auto& element : M_gv.elements() )
         {
@@ -281,9 +320,6 @@ public:
         }
     }
     
-
-private:
-    
     // Simulation time
     double M_time;
     
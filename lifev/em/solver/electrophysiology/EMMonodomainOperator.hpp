@@ -0,0 +1,335 @@
+//@HEADER
+/*
+*******************************************************************************
+
+ Copyright (C) 2004, 2005, 2007 EPFL, Politecnico di Milano, INRIA
+ Copyright (C) 2010 EPFL, Politecnico di Milano, Emory University
+
+ This file is part of LifeV.
+
+ LifeV is free software; you can redistribute it and/or modify
+ it under the terms of the GNU Lesser General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ LifeV is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ Lesser General Public License for more details.
+
+ You should have received a copy of the GNU Lesser General Public License
+ along with LifeV.  If not, see <http://www.gnu.org/licenses/>.
+
+*******************************************************************************
+*/
+//@HEADER
+
+/*!
+ @file
+ @brief Matrix free monodomain operator on a deforming domain
+
+ @date 19 - 10 - 2026
+
+ The operator applies the matrix of the monodomain system with mechanical
+ feedback,
+
+ \f[
+ A(\mathbf{F}) = \frac{C_m}{\Delta t} M(J) + \frac{1}{\chi} K(\mathbf{F}),
+ \f]
+
+ by integrating element by element with ETA, so that the matrices do not
+ have to be assembled again when the displacement changes.
+ */
+
+#ifndef _EMMONODOMAINOPERATOR_H_
+#define _EMMONODOMAINOPERATOR_H_
+
+#include <Epetra_Comm.h>
+#include <Epetra_Map.h>
+#include <Epetra_MultiVector.h>
+
+#include <lifev/core/array/MapEpetra.hpp>
+#include <lifev/core/array/MatrixSmall.hpp>
+#include <lifev/core/array/VectorSmall.hpp>
+#include <lifev/core/array/VectorEpetra.hpp>
+#include <lifev/core/fem/QuadratureRule.hpp>
+#include <lifev/core/operator/LinearOperator.hpp>
+
+#include <lifev/eta/fem/ETFESpace.hpp>
+#include <lifev/eta/expression/Integrate.hpp>
+
+namespace LifeV
+{
+
+//! EMMonodomainOperator - Matrix free operator of the monodomain system with mechanical feedback
+/*!
+ The deformation gradient \f$ \mathbf{F} = I + \nabla \mathbf{d} \f$ is
+ computed from the displacement vector at each application, hence the
+ operator always refers to the current displacement. The mass and
+ stiffness terms are the ones of
+ EMMonodomainSolver::setupMassMatrixWithMehcanicalFeedback() and
+ EMMonodomainSolver::setupStiffnessMatrixWithMehcanicalFeedback().
+
+ The operator has no inverse: it is meant to be given to an iterative
+ solver, with a preconditioner built on an assembled matrix.
+ */
+template<typename Mesh>
+class EMMonodomainOperator : public Operators::LinearOperator
+{
+public:
+
+    //! @name Type definitions
+    //@{
+
+    typedef Mesh                                                        mesh_Type;
+
+    typedef Operators::LinearOperator                                   super;
+
+    typedef super::comm_Type                                            comm_Type;
+
+    typedef super::map_Type                                             map_Type;
+
+    typedef super::vector_Type                                          vector_Type;
+
+    typedef boost::shared_ptr<VectorEpetra>                             vectorEpetraPtr_Type;
+
+    typedef ETFESpace<mesh_Type, MapEpetra, 3, 1>                       ETFESpace_Type;
+
+    typedef boost::shared_ptr<ETFESpace_Type>                           ETFESpacePtr_Type;
+
+    typedef ETFESpace<mesh_Type, MapEpetra, 3, 3>                       ETFESpaceVectorial_Type;
+
+    typedef boost::shared_ptr<ETFESpaceVectorial_Type>                  ETFESpaceVectorialPtr_Type;
+
+    typedef MatrixSmall<3, 3>                                           matrixSmall_Type;
+
+    //@}
+
+
+    //! @name Constructors & Destructor
+    //@{
+
+    //! Constructor
+    /*!
+     @param ETFESpacePtr space of the potential
+     @param displacementETFESpacePtr space of the displacement and of the fibers
+     @param quadRule quadrature rule used in the integration
+     */
+    EMMonodomainOperator ( const ETFESpacePtr_Type& ETFESpacePtr,
+                           const ETFESpaceVectorialPtr_Type& displacementETFESpacePtr,
+                           const QuadratureRule& quadRule );
+
+    //! Destructor
+    virtual ~EMMonodomainOperator() {}
+
+    //@}
+
+
+    //! @name Methods
+    //@{
+
+    //! Apply the mass matrix M(J)
+    /*!
+     @param X input vector
+     @param Y M(J) X
+     */
+    void applyMass ( const VectorEpetra& X, VectorEpetra& Y ) const;
+
+    //! Apply the operator
+    virtual int Apply ( const vector_Type& X, vector_Type& Y ) const;
+
+    //! The inverse is not available
+    virtual int ApplyInverse ( const vector_Type& /*X*/, vector_Type& /*Y*/ ) const
+    {
+        return -1;
+    }
+
+    //! The transpose is not available (the operator is symmetric anyway)
+    virtual int SetUseTranspose ( bool useTranspose )
+    {
+        return useTranspose ? -1 : 0;
+    }
+
+    //@}
+
+
+    //! @name Set Methods
+    //@{
+
+    //! Set the pointer to the displacement
+    void setDisplacementPtr ( const vectorEpetraPtr_Type& displacementPtr )
+    {
+        M_displacementPtr = displacementPtr;
+    }
+
+    //! Set the pointer to the fiber field
+    void setFiberPtr ( const vectorEpetraPtr_Type& fiberPtr )
+    {
+        M_fiberPtr = fiberPtr;
+    }
+
+    //! Set the longitudinal and transversal conductivities
+    void setDiffusion ( const Real& fiberDiffusion, const Real& transversalDiffusion )
+    {
+        M_fiberDiffusion = fiberDiffusion;
+        M_transversalDiffusion = transversalDiffusion;
+    }
+
+    //! Set the coefficients of the mass matrix (Cm / dt) and of the stiffness matrix (1 / chi)
+    void setCoefficients ( const Real& massCoefficient, const Real& stiffnessCoefficient )
+    {
+        M_massCoefficient = massCoefficient;
+        M_stiffnessCoefficient = stiffnessCoefficient;
+    }
+
+    //@}
+
+
+    //! @name Get Methods
+    //@{
+
+    virtual double NormInf() const
+    {
+        return -1.;
+    }
+
+    virtual const char* Label() const
+    {
+        return "EMMonodomainOperator";
+    }
+
+    virtual bool UseTranspose() const
+    {
+        return false;
+    }
+
+    virtual bool HasNormInf() const
+    {
+        return false;
+    }
+
+    virtual const comm_Type& Comm() const
+    {
+        return M_mapPtr->map ( Unique )->Comm();
+    }
+
+    virtual const map_Type& OperatorDomainMap() const
+    {
+        return *M_mapPtr->map ( Unique );
+    }
+
+    virtual const map_Type& OperatorRangeMap() const
+    {
+        return *M_mapPtr->map ( Unique );
+    }
+
+    //@}
+
+private:
+
+    ETFESpacePtr_Type                   M_ETFESpacePtr;
+    ETFESpaceVectorialPtr_Type          M_displacementETFESpacePtr;
+    const QuadratureRule*               M_quadRule;
+    boost::shared_ptr<MapEpetra>        M_mapPtr;
+
+    vectorEpetraPtr_Type                M_displacementPtr;
+    vectorEpetraPtr_Type                M_fiberPtr;
+
+    Real                                M_fiberDiffusion;
+    Real                                M_transversalDiffusion;
+    Real                                M_massCoefficient;
+    Real                                M_stiffnessCoefficient;
+
+    matrixSmall_Type                    M_identity;
+};
+
+// ===================================================
+// Constructors
+// ===================================================
+
+template<typename Mesh>
+EMMonodomainOperator<Mesh>::EMMonodomainOperator ( const ETFESpacePtr_Type& ETFESpacePtr,
+                                                   const ETFESpaceVectorialPtr_Type& displacementETFESpacePtr,
+                                                   const QuadratureRule& quadRule ) :
+    M_ETFESpacePtr             ( ETFESpacePtr ),
+    M_displacementETFESpacePtr ( displacementETFESpacePtr ),
+    M_quadRule                 ( &quadRule ),
+    M_mapPtr                   ( new MapEpetra ( ETFESpacePtr->map() ) ),
+    M_displacementPtr          (),
+    M_fiberPtr                 (),
+    M_fiberDiffusion           ( 0. ),
+    M_transversalDiffusion     ( 0. ),
+    M_massCoefficient          ( 1. ),
+    M_stiffnessCoefficient     ( 1. ),
+    M_identity                 ()
+{
+    M_identity (0, 0) = 1.0;
+    M_identity (1, 1) = 1.0;
+    M_identity (2, 2) = 1.0;
+}
+
+// ===================================================
+// Methods
+// ===================================================
+
+template<typename Mesh>
+void EMMonodomainOperator<Mesh>::applyMass ( const VectorEpetra& X, VectorEpetra& Y ) const
+{
+    ASSERT ( M_displacementPtr.get() != 0, "EMMonodomainOperator: the displacement is not set" );
+
+    Y *= 0.0;
+    {
+        using namespace ExpressionAssembly;
+
+        auto I = value (M_identity);
+        auto F = grad (M_displacementETFESpacePtr, *M_displacementPtr) + I;
+        auto J = det (F);
+
+        integrate ( elements (M_ETFESpacePtr->mesh() ),
+                    *M_quadRule,
+                    M_ETFESpacePtr,
+                    J * value (M_ETFESpacePtr, X) * phi_i
+                  ) >> Y;
+    }
+    Y.globalAssemble();
+}
+
+template<typename Mesh>
+int EMMonodomainOperator<Mesh>::Apply ( const vector_Type& X, vector_Type& Y ) const
+{
+    ASSERT ( M_displacementPtr.get() != 0, "EMMonodomainOperator: the displacement is not set" );
+    ASSERT ( M_fiberPtr.get() != 0, "EMMonodomainOperator: the fibers are not set" );
+    ASSERT ( X.NumVectors() == 1, "EMMonodomainOperator: only one vector can be applied at a time" );
+
+    const VectorEpetra potential ( X, M_mapPtr, Unique );
+    VectorEpetra result ( *M_mapPtr, Unique );
+
+    {
+        using namespace ExpressionAssembly;
+
+        auto I = value (M_identity);
+        auto F = grad (M_displacementETFESpacePtr, *M_displacementPtr) + I;
+        auto FmT = minusT (F);
+        auto Fm1 = transpose (FmT);
+        auto J = det (F);
+        auto f0 = value (M_displacementETFESpacePtr, *M_fiberPtr);
+        auto D = value (M_transversalDiffusion) * I
+                 + (value (M_fiberDiffusion) - value (M_transversalDiffusion) )
+                 * outerProduct (f0, f0);
+
+        integrate ( elements (M_ETFESpacePtr->mesh() ),
+                    *M_quadRule,
+                    M_ETFESpacePtr,
+                    value (M_massCoefficient) * J * value (M_ETFESpacePtr, potential) * phi_i
+                    + value (M_stiffnessCoefficient)
+                    * dot (J * Fm1 * D * FmT * grad (M_ETFESpacePtr, potential), grad (phi_i) )
+                  ) >> result;
+    }
+    result.globalAssemble();
+
+    return Y.Update ( 1.0, result.epetraVector(), 0.0 );
+}
+
+} // namespace LifeV
+
+#endif //_EMMONODOMAINOPERATOR_H_
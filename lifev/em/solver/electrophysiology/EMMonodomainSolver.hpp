@@ -48,6 +48,7 @@
 #include <lifev/electrophysiology/solver/ElectroETAMonodomainSolver.hpp>
 #include <lifev/core/fem/GradientRecovery.hpp>
 #include <lifev/em/solver/EMData.hpp>
+#include <lifev/em/solver/electrophysiology/EMMonodomainOperator.hpp>
 
 namespace LifeV
 {
@@ -160,6 +161,11 @@ public:
     typedef MatrixSmall<3, 3>                                           matrixSmall_Type;
 
     typedef ElectroETAMonodomainSolver<Mesh>              super;
+
+    //! Matrix free operator of the system with mechanical feedback
+    typedef EMMonodomainOperator<Mesh>                                  matrixFreeOperator_Type;
+
+    typedef boost::shared_ptr<matrixFreeOperator_Type>                  matrixFreeOperatorPtr_Type;
     //@}
 
     //! @name Constructors & Destructor
@@ -374,6 +380,15 @@ public:
      */
     void solveOneICIStep();
 
+    //!Solve one full step with ionic current interpolation, applying the matrices matrix free
+    /*!
+     * The system with mechanical feedback is solved with EMMonodomainOperator,
+     * which applies the mass and stiffness matrices of the current deformation
+     * without assembling them. The assembled matrices are only updated every
+     * M_matrixFreeLag steps, to build the preconditioner.
+     */
+    void solveOneICIStepMatrixFree();
+
     virtual void setup ( GetPot& dataFile, short int ionicModelSize);
     //
     //    //! solves using ionic current interpolation
@@ -413,6 +428,23 @@ public:
         M_mechanicsModifiesConductivity = modifiesConductivity;
     }
 
+    inline bool matrixFree() const
+    {
+        return M_matrixFree;
+    }
+
+    //! Use the matrix free operator when the matrices change with the deformation
+    /*!
+     @param matrixFree true to apply the matrices matrix free
+     @param lag number of steps between two assemblies of the matrix of the preconditioner
+     */
+    inline void setMatrixFree (bool matrixFree, UInt lag = 10)
+    {
+        M_matrixFree = matrixFree;
+        M_matrixFreeLag = std::max (lag, static_cast<UInt> (1) );
+        M_matrixFreeStep = 0;
+    }
+
     void setParametersFromEMData(EMData& data);
 
     //@}
@@ -428,6 +460,14 @@ private:
     //true if the mechanical feedback changes the conductivity tensor
     bool M_mechanicsModifiesConductivity;
 
+    //true if the system with mechanical feedback is solved matrix free
+    bool M_matrixFree;
+    //number of steps between two assemblies of the matrix of the preconditioner
+    UInt M_matrixFreeLag;
+    //steps solved matrix free
+    UInt M_matrixFreeStep;
+    matrixFreeOperatorPtr_Type M_matrixFreeOperatorPtr;
+
 };
 // class MonodomainSolver
 
@@ -443,7 +483,11 @@ EMMonodomainSolver<Mesh >::EMMonodomainSolver() :
     super(),
     M_displacementETFESpacePtr(),
     M_oneWayCoupling (false),
-    M_mechanicsModifiesConductivity (true)
+    M_mechanicsModifiesConductivity (true),
+    M_matrixFree (false),
+    M_matrixFreeLag (10),
+    M_matrixFreeStep (0),
+    M_matrixFreeOperatorPtr ()
 {
     //    M_oneWayCoupling = false;
     //    M_mechanicsModifiesConductivity = true;
@@ -460,7 +504,11 @@ EMMonodomainSolver<Mesh>::EMMonodomainSolver (std::string        meshName,
                                                           ionicModelPtr_Type model) :
     super                           (meshName, meshPath, dataFile, model),
     M_oneWayCoupling                (false),
-    M_mechanicsModifiesConductivity (true)
+    M_mechanicsModifiesConductivity (true),
+    M_matrixFree                    (false),
+    M_matrixFreeLag                 (10),
+    M_matrixFreeStep                (0),
+    M_matrixFreeOperatorPtr         ()
 {
     M_displacementETFESpacePtr.reset ( new ETFESpaceVectorial_Type (this->M_localMeshPtr,
                                                                     & (this->M_feSpacePtr -> refFE() ),
@@ -473,7 +521,11 @@ EMMonodomainSolver<Mesh>::EMMonodomainSolver (GetPot&            dataFile,
                                                           meshPtr_Type       meshPtr) :
     super                           (dataFile, model, meshPtr),
     M_oneWayCoupling                (false),
-    M_mechanicsModifiesConductivity (true)
+    M_mechanicsModifiesConductivity (true),
+    M_matrixFree                    (false),
+    M_matrixFreeLag                 (10),
+    M_matrixFreeStep                (0),
+    M_matrixFreeOperatorPtr         ()
 {
     M_displacementETFESpacePtr.reset ( new ETFESpaceVectorial_Type (this->M_localMeshPtr,
                                                                     & (this->M_feSpacePtr -> refFE() ),
@@ -488,7 +540,11 @@ EMMonodomainSolver<Mesh>::EMMonodomainSolver (std::string        meshName,
                                                           commPtr_Type       comm) :
     super                           (meshName, meshPath, dataFile, model, comm),
     M_oneWayCoupling                (false),
-    M_mechanicsModifiesConductivity (true)
+    M_mechanicsModifiesConductivity (true),
+    M_matrixFree                    (false),
+    M_matrixFreeLag                 (10),
+    M_matrixFreeStep                (0),
+    M_matrixFreeOperatorPtr         ()
 {
     M_displacementETFESpacePtr.reset ( new ETFESpaceVectorial_Type (this->M_localMeshPtr,
                                                                     & (this->M_feSpacePtr -> refFE() ),
@@ -510,6 +566,11 @@ EMMonodomainSolver<Mesh>::EMMonodomainSolver (
 
     M_oneWayCoupling = solver.M_oneWayCoupling;
     M_mechanicsModifiesConductivity = solver.M_mechanicsModifiesConductivity;
+    // The operator refers to the vectors of the solver, it is created again when needed
+    M_matrixFree = solver.M_matrixFree;
+    M_matrixFreeLag = solver.M_matrixFreeLag;
+    M_matrixFreeStep = 0;
+    M_matrixFreeOperatorPtr.reset();
 }
 
 //! Assignment operator
@@ -525,6 +586,11 @@ EMMonodomainSolver<Mesh>& EMMonodomainSolver < Mesh >::operator= (const EMMonodo
 
     M_oneWayCoupling = solver.M_oneWayCoupling;
     M_mechanicsModifiesConductivity = solver.M_mechanicsModifiesConductivity;
+    // The operator refers to the vectors of the solver, it is created again when needed
+    M_matrixFree = solver.M_matrixFree;
+    M_matrixFreeLag = solver.M_matrixFreeLag;
+    M_matrixFreeStep = 0;
+    M_matrixFreeOperatorPtr.reset();
 
     return *this;
 }
@@ -918,6 +984,14 @@ void EMMonodomainSolver<Mesh>::updateMatrices()
 template<typename Mesh>
 void EMMonodomainSolver<Mesh>::solveOneICIStep()
 {
+    // The matrix free operator uses the consistent mass matrix
+    if (M_matrixFree && M_displacementPtr && !M_oneWayCoupling && M_mechanicsModifiesConductivity
+            && !this->M_lumpedMassMatrix)
+    {
+        solveOneICIStepMatrixFree();
+        return;
+    }
+
     updateMatrices();
     if (M_displacementPtr  && !M_oneWayCoupling && M_mechanicsModifiesConductivity)
     {
@@ -928,6 +1002,45 @@ void EMMonodomainSolver<Mesh>::solveOneICIStep()
     this->M_linearSolverPtr->solve (this->M_potentialPtr);
 }
 
+template<typename Mesh>
+void EMMonodomainSolver<Mesh>::solveOneICIStepMatrixFree()
+{
+    const Real massCoefficient ( this->M_ionicModelPtr->membraneCapacitance() / this->M_timeStep );
+
+    if (!M_matrixFreeOperatorPtr)
+    {
+        M_matrixFreeOperatorPtr.reset ( new matrixFreeOperator_Type ( this->M_ETFESpacePtr,
+                                                                      M_displacementETFESpacePtr,
+                                                                      this->M_feSpacePtr->qr() ) );
+        M_matrixFreeStep = 0;
+    }
+    M_matrixFreeOperatorPtr->setDisplacementPtr (M_displacementPtr);
+    M_matrixFreeOperatorPtr->setFiberPtr (this->M_fiberPtr);
+    M_matrixFreeOperatorPtr->setDiffusion (this->M_diffusionTensor[0], this->M_diffusionTensor[1]);
+    M_matrixFreeOperatorPtr->setCoefficients (massCoefficient, 1.0 / this->M_surfaceVolumeRatio);
+
+    // The assembled matrix only serves to build the preconditioner, it can lag behind the deformation
+    if (M_matrixFreeStep % M_matrixFreeLag == 0)
+    {
+        updateMatrices();
+        this->M_linearSolverPtr->setBaseMatrixForPreconditioner (this->M_globalMatrixPtr);
+        this->M_linearSolverPtr->resetPreconditioner();
+    }
+    ++M_matrixFreeStep;
+
+    // rhs = M(J) ( I + Cm / dt V )
+    this->M_ionicModelPtr->superIonicModel::computePotentialRhsICI (this->M_globalSolution,
+                                                                    this->M_globalRhs);
+    vector_Type nodalRhs (* (this->M_globalRhs.at (0) ) );
+    nodalRhs += (*this->M_potentialPtr) * massCoefficient;
+    M_matrixFreeOperatorPtr->applyMass (nodalRhs, *this->M_rhsPtrUnique);
+
+    linearSolver_Type::operatorPtr_Type matrixFreeOperatorPtr (M_matrixFreeOperatorPtr);
+    this->M_linearSolverPtr->setOperator (matrixFreeOperatorPtr);
+    this->M_linearSolverPtr->setRightHandSide (this->M_rhsPtrUnique);
+    this->M_linearSolverPtr->solve (this->M_potentialPtr);
+}
+
 
 
 
@@ -943,6 +1056,8 @@ void EMMonodomainSolver<Mesh>::setParametersFromEMData ( EMData& data)
     this->M_timeStep           = data.electroParameter<Real> ("timestep");
     this->M_elementsOrder      = data.electroParameter<std::string> ("elementsOrder");
     this->M_lumpedMassMatrix   = data.electroParameter<bool>("LumpedMass");
+    setMatrixFree (data.electroParameter<bool> ("MatrixFree"),
+                   static_cast<UInt> (data.electroParameter<int> ("MatrixFreeLag") ) );
 
 }
 
@@ -0,0 +1,216 @@
+//@HEADER
+/*
+*******************************************************************************
+
+ Copyright (C) 2004, 2005, 2007 EPFL, Politecnico di Milano, INRIA
+ Copyright (C) 2010 EPFL, Politecnico di Milano, Emory University
+
+ This file is part of LifeV.
+
+ LifeV is free software; you can redistribute it and/or modify
+ it under the terms of the GNU Lesser General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ LifeV is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ Lesser General Public License for more details.
+
+ You should have received a copy of the GNU Lesser General Public License
+ along with LifeV.  If not, see <http://www.gnu.org/licenses/>.
+
+*******************************************************************************
+*/
+/*!
+ @file
+ @brief Test of the point probes of EMInSituOutput
+
+ @date 19 - 10 - 2026
+
+ A linear field on a P1 space and a quadratic vector field on a P2 space
+ are probed at points inside a partitioned cube. The recorded values must
+ match the fields evaluated at the probes, and a probe outside the mesh
+ must be rejected.
+ */
+
+// Tell the compiler to ignore specific kind of warnings:
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+
+#include <Epetra_ConfigDefs.h>
+#ifdef EPETRA_MPI
+#include <mpi.h>
+#include <Epetra_MpiComm.h>
+#else
+#include <Epetra_SerialComm.h>
+#endif
+
+//Tell the compiler to restore the warning previously silented
+#pragma GCC diagnostic warning "-Wunused-variable"
+#pragma GCC diagnostic warning "-Wunused-parameter"
+
+#include <cmath>
+#include <fstream>
+#include <sstream>
+
+#include <lifev/core/LifeV.hpp>
+
+#include <lifev/core/mesh/MeshPartitioner.hpp>
+#include <lifev/core/mesh/RegionMesh3DStructured.hpp>
+#include <lifev/core/mesh/RegionMesh.hpp>
+
+#include <lifev/em/util/EMInSituOutput.hpp>
+
+using namespace LifeV;
+
+// Interpolated exactly by P1
+Real linearField (const Real& /*t*/, const Real& x, const Real& y, const Real& z, const ID& /*i*/)
+{
+    return 1. + 2. * x - y + 3. * z;
+}
+
+// Interpolated exactly by P2
+Real quadraticField (const Real& /*t*/, const Real& x, const Real& y, const Real& z, const ID& i)
+{
+    switch (i)
+    {
+        case 0:
+            return x * y - z;
+        case 1:
+            return y * y + 0.5 * x * z;
+        case 2:
+            return 2. - x * x + y * z;
+        default:
+            return 0.;
+    }
+}
+
+int main (int argc, char** argv)
+{
+#ifdef HAVE_MPI
+    MPI_Init (&argc, &argv);
+    boost::shared_ptr<Epetra_Comm> comm (new Epetra_MpiComm (MPI_COMM_WORLD) );
+#else
+    boost::shared_ptr<Epetra_Comm> comm (new Epetra_SerialComm);
+#endif
+
+    const bool verbose (comm->MyPID() == 0);
+
+    typedef RegionMesh<LinearTetra>                         mesh_Type;
+    typedef boost::shared_ptr<mesh_Type>                    meshPtr_Type;
+    typedef FESpace<mesh_Type, MapEpetra>                   feSpace_Type;
+    typedef boost::shared_ptr<feSpace_Type>                 feSpacePtr_Type;
+    typedef boost::shared_ptr<VectorEpetra>                 vectorPtr_Type;
+
+    //********************************************//
+    // Mesh and fields                            //
+    //********************************************//
+    meshPtr_Type fullMeshPtr (new mesh_Type (comm) );
+    regularMesh3D (*fullMeshPtr, 1, 5, 5, 5, false,
+                   1.0, 1.0, 1.0,
+                   0.0, 0.0, 0.0);
+
+    meshPtr_Type localMeshPtr;
+    {
+        MeshPartitioner<mesh_Type> meshPart (fullMeshPtr, comm);
+        localMeshPtr = meshPart.meshPartition();
+    }
+    fullMeshPtr.reset();
+
+    feSpacePtr_Type scalarSpace (new feSpace_Type (localMeshPtr, "P1", 1, comm) );
+    vectorPtr_Type scalar (new VectorEpetra (scalarSpace->map() ) );
+    scalarSpace->interpolate (static_cast<feSpace_Type::function_Type> (linearField), *scalar, 0.0);
+
+    feSpacePtr_Type vectorSpace (new feSpace_Type (localMeshPtr, "P2", 3, comm) );
+    vectorPtr_Type vector (new VectorEpetra (vectorSpace->map() ) );
+    vectorSpace->interpolate (static_cast<feSpace_Type::function_Type> (quadraticField), *vector, 0.0);
+
+    //********************************************//
+    // Probes                                     //
+    //********************************************//
+    std::vector<Vector3D> points;
+    points.push_back (Vector3D (0.31, 0.57, 0.72) );
+    points.push_back (Vector3D (0.8, 0.4, 0.2) );    // on a face of the structured mesh
+    points.push_back (Vector3D (1.0, 1.0, 0.0) );    // a corner of the cube
+
+    std::vector<Real> expected;
+    const std::string fileName ("EMInSituOutput.txt");
+    bool success (true);
+    {
+        EMInSituOutput<mesh_Type> output (fileName, comm);
+        for (UInt i = 0; i < points.size(); ++i)
+        {
+            std::ostringstream name;
+            name << "probe" << i;
+
+            if (!output.addProbe (name.str() + "_scalar", scalar, scalarSpace, points[i]) )
+            {
+                success = false;
+            }
+            expected.push_back (linearField (0., points[i][0], points[i][1], points[i][2], 0) );
+
+            for (UInt j = 0; j < 3; ++j)
+            {
+                std::ostringstream component;
+                component << "_vector" << j;
+                if (!output.addProbe (name.str() + component.str(), vector, vectorSpace, points[i], j) )
+                {
+                    success = false;
+                }
+                expected.push_back (quadraticField (0., points[i][0], points[i][1], points[i][2], j) );
+            }
+        }
+
+        // Outside the cube: rejected on all the processes, no column added
+        if (output.addProbe ("outside", scalar, scalarSpace, Vector3D (1.5, 0.5, 0.5) ) )
+        {
+            success = false;
+        }
+        success = success && output.numColumns() == expected.size();
+
+        output.record (0.5);
+    }
+
+    //********************************************//
+    // Check the table                            //
+    //********************************************//
+    Int passed (success ? 1 : 0);
+    if (comm->MyPID() == 0 && success)
+    {
+        std::ifstream table (fileName.c_str() );
+        std::string header;
+        std::getline (table, header);
+
+        Real time (0.);
+        table >> time;
+        passed = table.good() && std::abs (time - 0.5) < 1e-12;
+
+        for (UInt i = 0; i < expected.size() && passed; ++i)
+        {
+            Real value (0.);
+            table >> value;
+            if (verbose)
+            {
+                std::cout << "Column " << i << ": " << value << " (expected " << expected[i] << ")" << std::endl;
+            }
+            passed = !table.fail() && std::abs (value - expected[i]) <= 1e-8 * (1. + std::abs (expected[i]) );
+        }
+    }
+    comm->Broadcast (&passed, 1, 0);
+
+#ifdef HAVE_MPI
+    MPI_Finalize();
+#endif
+
+    if (!passed)
+    {
+        return EXIT_FAILURE;
+    }
+
+    if (verbose)
+    {
+        std::cout << "End Result: TEST PASSED" << std::endl;
+    }
+    return EXIT_SUCCESS;
+}
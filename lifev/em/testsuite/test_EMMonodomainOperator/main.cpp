@@ -0,0 +1,210 @@
+//@HEADER
+/*
+*******************************************************************************
+
+ Copyright (C) 2004, 2005, 2007 EPFL, Politecnico di Milano, INRIA
+ Copyright (C) 2010 EPFL, Politecnico di Milano, Emory University
+
+ This file is part of LifeV.
+
+ LifeV is free software; you can redistribute it and/or modify
+ it under the terms of the GNU Lesser General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ LifeV is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ Lesser General Public License for more details.
+
+ You should have received a copy of the GNU Lesser General Public License
+ along with LifeV.  If not, see <http://www.gnu.org/licenses/>.
+
+*******************************************************************************
+*/
+
+/*!
+ @file
+ @brief Test of the matrix free monodomain operator with mechanical feedback
+
+ @date 19 - 10 - 2026
+
+ On a deformed cube, EMMonodomainOperator::Apply is compared with the
+ global matrix assembled by EMMonodomainSolver::updateMatrices(), and
+ EMMonodomainOperator::applyMass with the assembled mass matrix.
+ */
+
+// Tell the compiler to ignore specific kind of warnings:
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+
+#include <Epetra_ConfigDefs.h>
+#ifdef EPETRA_MPI
+#include <mpi.h>
+#include <Epetra_MpiComm.h>
+#else
+#include <Epetra_SerialComm.h>
+#endif
+
+//Tell the compiler to restore the warning previously silented
+#pragma GCC diagnostic warning "-Wunused-variable"
+#pragma GCC diagnostic warning "-Wunused-parameter"
+
+#include <cmath>
+
+#include <lifev/core/LifeV.hpp>
+
+#include <lifev/core/mesh/MeshPartitioner.hpp>
+#include <lifev/core/mesh/RegionMesh3DStructured.hpp>
+#include <lifev/core/mesh/RegionMesh.hpp>
+
+#include <lifev/electrophysiology/solver/IonicModels/IonicAlievPanfilov.hpp>
+
+#include <lifev/em/solver/electrophysiology/EMMonodomainSolver.hpp>
+#include <lifev/em/solver/electrophysiology/EMMonodomainOperator.hpp>
+
+using namespace LifeV;
+
+// Displacement of the cube [0,1]^3: a shear, a stretch and a twist
+Real displacement (const Real& /*t*/, const Real& x, const Real& y, const Real& z, const ID& i)
+{
+    switch (i)
+    {
+        case 0:
+            return 0.1 * x * y + 0.05 * z;
+        case 1:
+            return 0.08 * y * y - 0.03 * x * z;
+        case 2:
+            return -0.06 * x + 0.04 * y * z;
+        default:
+            return 0.;
+    }
+}
+
+// Potential to which the operators are applied
+Real potential (const Real& /*t*/, const Real& x, const Real& y, const Real& z, const ID& /*i*/)
+{
+    return std::sin (2. * x) + x * y - 0.5 * z * z;
+}
+
+// Relative difference between two vectors
+Real relativeDifference (const VectorEpetra& reference, const VectorEpetra& result)
+{
+    VectorEpetra difference (reference);
+    difference -= result;
+    return difference.normInf() / reference.normInf();
+}
+
+int main (int argc, char** argv)
+{
+#ifdef HAVE_MPI
+    MPI_Init (&argc, &argv);
+    boost::shared_ptr<Epetra_Comm> comm (new Epetra_MpiComm (MPI_COMM_WORLD) );
+#else
+    boost::shared_ptr<Epetra_Comm> comm (new Epetra_SerialComm);
+#endif
+
+    const bool verbose (comm->MyPID() == 0);
+
+    typedef RegionMesh<LinearTetra>                         mesh_Type;
+    typedef boost::shared_ptr<mesh_Type>                    meshPtr_Type;
+    typedef EMMonodomainSolver<mesh_Type>                   monodomainSolver_Type;
+    typedef EMMonodomainOperator<mesh_Type>                 operator_Type;
+    typedef FESpace<mesh_Type, MapEpetra>                   feSpace_Type;
+    typedef boost::shared_ptr<VectorEpetra>                 vectorPtr_Type;
+
+    //********************************************//
+    // Mesh and monodomain solver                 //
+    //********************************************//
+    meshPtr_Type fullMeshPtr (new mesh_Type (comm) );
+    regularMesh3D (*fullMeshPtr, 1, 6, 6, 6, false,
+                   1.0, 1.0, 1.0,
+                   0.0, 0.0, 0.0);
+
+    meshPtr_Type localMeshPtr;
+    {
+        MeshPartitioner<mesh_Type> meshPart (fullMeshPtr, comm);
+        localMeshPtr = meshPart.meshPartition();
+    }
+    fullMeshPtr.reset();
+
+    GetPot dataFile (argc, argv);
+    boost::shared_ptr<IonicAlievPanfilov> model (new IonicAlievPanfilov() );
+    monodomainSolver_Type monodomain (dataFile, model, localMeshPtr);
+
+    VectorSmall<3> diffusion;
+    diffusion[0] = 1.3;
+    diffusion[1] = 0.4;
+    diffusion[2] = 0.4;
+    monodomain.setDiffusionTensor (diffusion);
+    monodomain.setSurfaceVolumeRatio (1400.0);
+    monodomain.setTimeStep (0.05);
+
+    VectorSmall<3> fibers;
+    fibers[0] = 0.6;
+    fibers[1] = 0.0;
+    fibers[2] = 0.8;
+    monodomain.setupFibers (fibers);
+
+    //********************************************//
+    // Non trivial displacement                   //
+    //********************************************//
+    boost::shared_ptr<feSpace_Type> displacementSpace (new feSpace_Type (localMeshPtr, "P1", 3, comm) );
+    vectorPtr_Type displacementPtr (new VectorEpetra (displacementSpace->map() ) );
+    displacementSpace->interpolate (static_cast<feSpace_Type::function_Type> (displacement), *displacementPtr, 0.0);
+    monodomain.setDisplacementPtr (displacementPtr);
+
+    // Mass, stiffness and global matrices with mechanical feedback
+    monodomain.updateMatrices();
+
+    //********************************************//
+    // Matrix free operator                       //
+    //********************************************//
+    operator_Type matrixFreeOperator (monodomain.ETFESpacePtr(),
+                                      monodomain.displacementETFESpacePtr(),
+                                      monodomain.feSpacePtr()->qr() );
+    matrixFreeOperator.setDisplacementPtr (displacementPtr);
+    matrixFreeOperator.setFiberPtr (monodomain.fiberPtr() );
+    matrixFreeOperator.setDiffusion (diffusion[0], diffusion[1]);
+    matrixFreeOperator.setCoefficients (model->membraneCapacitance() / monodomain.timeStep(),
+                                        1.0 / monodomain.surfaceVolumeRatio() );
+
+    VectorEpetra X (monodomain.ETFESpacePtr()->map() );
+    monodomain.feSpacePtr()->interpolate (static_cast<feSpace_Type::function_Type> (potential), X, 0.0);
+
+    // Global operator
+    VectorEpetra assembledResult (monodomain.ETFESpacePtr()->map() );
+    VectorEpetra matrixFreeResult (monodomain.ETFESpacePtr()->map() );
+    monodomain.globalMatrixPtr()->multiply (false, X, assembledResult);
+    matrixFreeOperator.Apply (X.epetraVector(), matrixFreeResult.epetraVector() );
+    const Real operatorError (relativeDifference (assembledResult, matrixFreeResult) );
+
+    // Mass matrix
+    VectorEpetra assembledMass (monodomain.ETFESpacePtr()->map() );
+    VectorEpetra matrixFreeMass (monodomain.ETFESpacePtr()->map() );
+    monodomain.massMatrixPtr()->multiply (false, X, assembledMass);
+    matrixFreeOperator.applyMass (X, matrixFreeMass);
+    const Real massError (relativeDifference (assembledMass, matrixFreeMass) );
+
+    if (verbose)
+    {
+        std::cout << "Relative difference of the operator: " << operatorError << std::endl;
+        std::cout << "Relative difference of the mass matrix: " << massError << std::endl;
+    }
+
+#ifdef HAVE_MPI
+    MPI_Finalize();
+#endif
+
+    const Real tolerance (1e-10);
+    if (operatorError > tolerance || massError > tolerance)
+    {
+        return EXIT_FAILURE;
+    }
+
+    if (verbose)
+    {
+        std::cout << "End Result: TEST PASSED" << std::endl;
+    }
+    return EXIT_SUCCESS;
+}
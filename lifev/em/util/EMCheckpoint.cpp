@@ -0,0 +1,395 @@
+//@HEADER
+/*
+ *******************************************************************************
+
+    Copyright (C) 2004, 2005, 2007 EPFL, Politecnico di Milano, INRIA
+    Copyright (C) 2010 EPFL, Politecnico di Milano, Emory University
+
+    This file is part of LifeV.
+
+    LifeV is free software; you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    LifeV is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with LifeV.  If not, see <http://www.gnu.org/licenses/>.
+
+ *******************************************************************************
+ */
+//@HEADER
+
+/*!
+    @file
+    @brief Binary checkpoint of the electromechanical state
+ */
+
+#include <lifev/em/util/EMCheckpoint.hpp>
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <sstream>
+#include <iomanip>
+#include <set>
+
+namespace LifeV
+{
+
+namespace
+{
+// File layout version, to be increased whenever the layout changes
+const char  S_magic[ 8 ] = { 'L', 'I', 'F', 'E', 'V', 'C', 'K', 'P' };
+const Int   S_version    = 1;
+
+template <typename T>
+void writeValue ( std::ofstream& file, const T& value )
+{
+    file.write ( reinterpret_cast<const char*> ( &value ), sizeof ( T ) );
+}
+
+template <typename T>
+void readValue ( std::ifstream& file, T& value )
+{
+    file.read ( reinterpret_cast<char*> ( &value ), sizeof ( T ) );
+}
+
+void writeString ( std::ofstream& file, const std::string& value )
+{
+    writeValue ( file, static_cast<UInt> ( value.size() ) );
+    file.write ( value.data(), value.size() );
+}
+
+std::string readString ( std::ifstream& file )
+{
+    UInt size ( 0 );
+    readValue ( file, size );
+    std::string value ( size, ' ' );
+    if ( size > 0 )
+    {
+        file.read ( &value[ 0 ], size );
+    }
+    return value;
+}
+
+void writeArray ( std::ofstream& file, const std::vector<Real>& values )
+{
+    writeValue ( file, static_cast<uint64_type> ( values.size() ) );
+    if ( !values.empty() )
+    {
+        file.write ( reinterpret_cast<const char*> ( &values[ 0 ] ), values.size() * sizeof ( Real ) );
+    }
+}
+
+void readArray ( std::ifstream& file, std::vector<Real>& values )
+{
+    uint64_type size ( 0 );
+    readValue ( file, size );
+    values.resize ( size );
+    if ( size > 0 )
+    {
+        file.read ( reinterpret_cast<char*> ( &values[ 0 ] ), size * sizeof ( Real ) );
+    }
+}
+} // anonymous namespace
+
+// ===================================================
+// Constructors & Destructor
+// ===================================================
+EMCheckpoint::EMCheckpoint ( const std::string& folder,
+                             const std::string& prefix,
+                             const commPtr_Type& comm,
+                             const bool asynchronous ) :
+    M_folder       ( folder ),
+    M_prefix       ( prefix ),
+    M_comm         ( comm ),
+    M_asynchronous ( asynchronous ),
+    M_vectors      (),
+    M_data         (),
+    M_snapshot     (),
+    M_writer       (),
+    M_pending      ( false ),
+    M_written      ( false )
+{
+}
+
+EMCheckpoint::~EMCheckpoint()
+{
+    wait();
+}
+
+// ===================================================
+// Methods
+// ===================================================
+void
+EMCheckpoint::addVector ( const std::string& name, const vectorPtr_Type& vector )
+{
+    M_vectors[ name ] = vector;
+}
+
+void
+EMCheckpoint::setData ( const std::string& name, const data_Type& data )
+{
+    M_data[ name ] = data;
+}
+
+const EMCheckpoint::data_Type&
+EMCheckpoint::data ( const std::string& name ) const
+{
+    dataContainer_Type::const_iterator it = M_data.find ( name );
+    if ( it == M_data.end() )
+    {
+        ERROR_MSG ( "EMCheckpoint: no data named " + name );
+    }
+    return it->second;
+}
+
+bool
+EMCheckpoint::hasData ( const std::string& name ) const
+{
+    return M_data.find ( name ) != M_data.end();
+}
+
+void
+EMCheckpoint::write ( const UInt step, const Real time )
+{
+    // The previous snapshot is still in use by the writer
+    wait();
+
+    M_snapshot.step = step;
+    M_snapshot.time = time;
+    M_snapshot.names.clear();
+    M_snapshot.globalLengths.clear();
+    M_snapshot.gidChecksums.clear();
+    M_snapshot.values.resize ( M_vectors.size() );
+    M_snapshot.data = M_data;
+
+    UInt iVector ( 0 );
+    for ( vectorContainer_Type::const_iterator it = M_vectors.begin(); it != M_vectors.end(); ++it, ++iVector )
+    {
+        const Epetra_MultiVector& epetraVector ( it->second->epetraVector() );
+        const Int myLength ( epetraVector.MyLength() );
+
+        M_snapshot.names.push_back ( it->first );
+        M_snapshot.globalLengths.push_back ( epetraVector.GlobalLength() );
+        M_snapshot.gidChecksums.push_back ( gidChecksum ( *it->second ) );
+        M_snapshot.values[ iVector ].assign ( epetraVector[ 0 ], epetraVector[ 0 ] + myLength );
+    }
+
+    const std::string file ( fileName ( step ) );
+    M_pending = true;
+    M_written = false;
+    if ( M_asynchronous )
+    {
+        M_writer = std::thread ( &EMCheckpoint::writeSnapshot, file, std::cref ( M_snapshot ),
+                                 M_comm->NumProc(), M_comm->MyPID(), std::ref ( M_written ) );
+    }
+    else
+    {
+        writeSnapshot ( file, M_snapshot, M_comm->NumProc(), M_comm->MyPID(), M_written );
+        wait();
+    }
+}
+
+Real
+EMCheckpoint::read ( const UInt step )
+{
+    wait();
+
+    const std::string file ( fileName ( step ) );
+    std::ifstream input ( file.c_str(), std::ios::in | std::ios::binary );
+
+    // All processes must find their file
+    Int localFound ( input.good() ? 1 : 0 );
+    Int globalFound ( 0 );
+    M_comm->MinAll ( &localFound, &globalFound, 1 );
+    if ( !globalFound )
+    {
+        ERROR_MSG ( "EMCheckpoint: missing checkpoint file " + file );
+    }
+
+    char magic[ 8 ];
+    input.read ( magic, 8 );
+    Int version ( 0 ), numProcs ( 0 ), pid ( 0 );
+    readValue ( input, version );
+    readValue ( input, numProcs );
+    readValue ( input, pid );
+    if ( std::memcmp ( magic, S_magic, 8 ) != 0 || version != S_version )
+    {
+        ERROR_MSG ( "EMCheckpoint: " + file + " is not a valid checkpoint file" );
+    }
+    if ( numProcs != M_comm->NumProc() || pid != M_comm->MyPID() )
+    {
+        ERROR_MSG ( "EMCheckpoint: " + file + " was written with a different number of processes" );
+    }
+
+    UInt fileStep ( 0 );
+    Real time ( 0. );
+    readValue ( input, fileStep );
+    readValue ( input, time );
+
+    UInt numVectors ( 0 );
+    readValue ( input, numVectors );
+    data_Type values;
+    std::set<std::string> restored;
+    for ( UInt iVector = 0; iVector < numVectors; ++iVector )
+    {
+        const std::string name ( readString ( input ) );
+        Int globalLength ( 0 );
+        uint64_type checksum ( 0 );
+        readValue ( input, globalLength );
+        readValue ( input, checksum );
+        readArray ( input, values );
+
+        vectorContainer_Type::iterator it = M_vectors.find ( name );
+        if ( it == M_vectors.end() )
+        {
+            continue;
+        }
+
+        Epetra_MultiVector& epetraVector ( it->second->epetraVector() );
+        if ( globalLength != epetraVector.GlobalLength()
+                || static_cast<Int> ( values.size() ) != epetraVector.MyLength()
+                || checksum != gidChecksum ( *it->second ) )
+        {
+            ERROR_MSG ( "EMCheckpoint: vector " + name + " does not match the current partition" );
+        }
+        std::copy ( values.begin(), values.end(), epetraVector[ 0 ] );
+        restored.insert ( name );
+    }
+
+    // Restarting with a registered vector left at its current value would mix two states
+    for ( vectorContainer_Type::const_iterator it = M_vectors.begin(); it != M_vectors.end(); ++it )
+    {
+        if ( restored.find ( it->first ) == restored.end() )
+        {
+            ERROR_MSG ( "EMCheckpoint: vector " + it->first + " is missing from " + file );
+        }
+    }
+
+    UInt numData ( 0 );
+    readValue ( input, numData );
+    for ( UInt iData = 0; iData < numData; ++iData )
+    {
+        const std::string name ( readString ( input ) );
+        readArray ( input, M_data[ name ] );
+    }
+
+    if ( !input.good() )
+    {
+        ERROR_MSG ( "EMCheckpoint: " + file + " is truncated" );
+    }
+
+    return time;
+}
+
+void
+EMCheckpoint::wait()
+{
+    if ( M_writer.joinable() )
+    {
+        M_writer.join();
+    }
+
+    if ( !M_pending )
+    {
+        return;
+    }
+    M_pending = false;
+
+    // The checkpoint is valid only if all the processes have written their file
+    Int localWritten ( M_written ? 1 : 0 );
+    Int globalWritten ( 0 );
+    M_comm->MinAll ( &localWritten, &globalWritten, 1 );
+
+    const std::string file ( fileName ( M_snapshot.step ) );
+    const std::string temporaryName ( file + ".tmp" );
+    if ( globalWritten )
+    {
+        std::rename ( temporaryName.c_str(), file.c_str() );
+    }
+    else
+    {
+        std::remove ( temporaryName.c_str() );
+        if ( M_comm->MyPID() == 0 )
+        {
+            std::cerr << "EMCheckpoint: checkpoint " << M_snapshot.step << " could not be written" << std::endl;
+        }
+    }
+}
+
+std::string
+EMCheckpoint::fileName ( const UInt step ) const
+{
+    std::ostringstream name;
+    name << M_folder << M_prefix << "." << std::setw ( 5 ) << std::setfill ( '0' ) << step
+         << "." << M_comm->MyPID() << ".ckp";
+    return name.str();
+}
+
+// ===================================================
+// Private Methods
+// ===================================================
+uint64_type
+EMCheckpoint::gidChecksum ( const vector_Type& vector )
+{
+    const Epetra_BlockMap& map ( vector.epetraVector().Map() );
+    uint64_type checksum ( 0 );
+    for ( Int i = 0; i < map.NumMyElements(); ++i )
+    {
+        checksum = checksum * 31 + static_cast<uint64_type> ( map.GID ( i ) );
+    }
+    return checksum;
+}
+
+void
+EMCheckpoint::writeSnapshot ( const std::string& fileName, const snapshot_Type& snapshot,
+                              const Int numProcs, const Int pid, bool& written )
+{
+    // Write to a temporary file, renamed by wait(), so that an interrupted
+    // write never leaves a corrupted checkpoint behind
+    const std::string temporaryName ( fileName + ".tmp" );
+    written = false;
+    {
+        std::ofstream output ( temporaryName.c_str(), std::ios::out | std::ios::binary | std::ios::trunc );
+
+        output.write ( S_magic, 8 );
+        writeValue ( output, S_version );
+        writeValue ( output, numProcs );
+        writeValue ( output, pid );
+        writeValue ( output, snapshot.step );
+        writeValue ( output, snapshot.time );
+
+        writeValue ( output, static_cast<UInt> ( snapshot.names.size() ) );
+        for ( UInt iVector = 0; iVector < snapshot.names.size(); ++iVector )
+        {
+            writeString ( output, snapshot.names[ iVector ] );
+            writeValue ( output, snapshot.globalLengths[ iVector ] );
+            writeValue ( output, snapshot.gidChecksums[ iVector ] );
+            writeArray ( output, snapshot.values[ iVector ] );
+        }
+
+        writeValue ( output, static_cast<UInt> ( snapshot.data.size() ) );
+        for ( dataContainer_Type::const_iterator it = snapshot.data.begin(); it != snapshot.data.end(); ++it )
+        {
+            writeString ( output, it->first );
+            writeArray ( output, it->second );
+        }
+
+        output.close();
+        if ( !output.good() )
+        {
+            std::cerr << "EMCheckpoint: error writing " << temporaryName << std::endl;
+            return;
+        }
+    }
+    written = true;
+}
+
+} // namespace LifeV
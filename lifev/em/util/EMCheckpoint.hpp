@@ -0,0 +1,176 @@
+//@HEADER
+/*
+ *******************************************************************************
+
+    Copyright (C) 2004, 2005, 2007 EPFL, Politecnico di Milano, INRIA
+    Copyright (C) 2010 EPFL, Politecnico di Milano, Emory University
+
+    This file is part of LifeV.
+
+    LifeV is free software; you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    LifeV is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with LifeV.  If not, see <http://www.gnu.org/licenses/>.
+
+ *******************************************************************************
+ */
+//@HEADER
+
+/*!
+    @file
+    @brief Binary checkpoint of the electromechanical state
+
+    Each process writes its own file containing the local entries of the
+    registered vectors and a set of named scalar arrays (circulation state,
+    coupling history, ...). Files are written by a background thread from a
+    snapshot of the state, so that the time loop is not blocked by I/O, and
+    they are read back in a single pass. A checkpoint can only be read with
+    the same number of processes and the same mesh partition it was written
+    with; this is checked when reading.
+ */
+
+#ifndef EMCHECKPOINT_H
+#define EMCHECKPOINT_H
+
+#include <string>
+#include <vector>
+#include <map>
+#include <thread>
+
+#include <boost/shared_ptr.hpp>
+
+#include <Epetra_Comm.h>
+
+#include <lifev/core/LifeV.hpp>
+#include <lifev/core/array/VectorEpetra.hpp>
+
+namespace LifeV
+{
+
+//! EMCheckpoint - Per-process binary checkpoint/restart of the EM state
+/*!
+ *  Usage:
+ *  <ol>
+ *  <li> register all the distributed vectors of the state with addVector();</li>
+ *  <li> before each write set the small replicated data with setData();</li>
+ *  <li> write ( step, time ) returns as soon as the state has been copied;</li>
+ *  <li> read ( step ) restores the registered vectors and the data, which
+ *       can then be retrieved with data().</li>
+ *  </ol>
+ */
+class EMCheckpoint
+{
+public:
+
+    typedef VectorEpetra                              vector_Type;
+    typedef boost::shared_ptr<vector_Type>            vectorPtr_Type;
+    typedef boost::shared_ptr<Epetra_Comm>            commPtr_Type;
+    typedef std::vector<Real>                         data_Type;
+
+    //! Constructor
+    /*!
+     * @param folder folder containing the checkpoint files
+     * @param prefix prefix of the checkpoint files
+     * @param comm communicator
+     * @param asynchronous if true the files are written by a background thread
+     */
+    EMCheckpoint ( const std::string& folder,
+                   const std::string& prefix,
+                   const commPtr_Type& comm,
+                   const bool asynchronous = true );
+
+    //! Destructor, waits for a pending write (see wait())
+    virtual ~EMCheckpoint();
+
+    //! Register a distributed vector of the state
+    void addVector ( const std::string& name, const vectorPtr_Type& vector );
+
+    //! Set a named array of (replicated) data to be written with the next checkpoint
+    void setData ( const std::string& name, const data_Type& data );
+
+    //! Named array of data, as set or as read from the last checkpoint
+    const data_Type& data ( const std::string& name ) const;
+
+    //! True if a named array of data is available
+    bool hasData ( const std::string& name ) const;
+
+    //! Write the state
+    /*!
+     * The state is copied and the method returns; the file is written in
+     * background if the checkpoint is asynchronous. A pending write is
+     * completed first. The file is written under a temporary name and
+     * renamed by wait() (at once if the checkpoint is not asynchronous),
+     * once all the processes have written theirs.
+     * Collective call.
+     * @param step index of the checkpoint
+     * @param time time of the checkpoint
+     */
+    void write ( const UInt step, const Real time );
+
+    //! Read the state
+    /*!
+     * Restores all the registered vectors and the named data.
+     * A registered vector missing from the checkpoint is an error.
+     * @param step index of the checkpoint
+     * @return the time of the checkpoint
+     */
+    Real read ( const UInt step );
+
+    //! Wait for a pending write to complete
+    /*!
+     * If all the processes have written their file, the temporary files are
+     * renamed, otherwise they are removed and the previous checkpoints are
+     * left untouched. Collective call when a write is pending: it must be
+     * called before MPI_Finalize if the destructor runs after it.
+     */
+    void wait();
+
+    //! Name of the file of this process for a given step
+    std::string fileName ( const UInt step ) const;
+
+private:
+
+    typedef std::map<std::string, vectorPtr_Type>     vectorContainer_Type;
+    typedef std::map<std::string, data_Type>          dataContainer_Type;
+
+    struct snapshot_Type
+    {
+        UInt                         step;
+        Real                         time;
+        std::vector<std::string>     names;
+        std::vector<Int>             globalLengths;
+        std::vector<uint64_type>     gidChecksums;
+        std::vector<data_Type>       values;
+        dataContainer_Type           data;
+    };
+
+    static uint64_type gidChecksum ( const vector_Type& vector );
+
+    static void writeSnapshot ( const std::string& fileName, const snapshot_Type& snapshot,
+                                const Int numProcs, const Int pid, bool& written );
+
+    std::string                  M_folder;
+    std::string                  M_prefix;
+    commPtr_Type                 M_comm;
+    bool                         M_asynchronous;
+
+    vectorContainer_Type         M_vectors;
+    dataContainer_Type           M_data;
+
+    snapshot_Type                M_snapshot;
+    std::thread                  M_writer;
+    bool                         M_pending;
+    bool                         M_written;
+};
+
+} // namespace LifeV
+
+#endif /* EMCHECKPOINT_H */
@@ -0,0 +1,607 @@
+//@HEADER
+/*
+ *******************************************************************************
+
+    Copyright (C) 2004, 2005, 2007 EPFL, Politecnico di Milano, INRIA
+    Copyright (C) 2010 EPFL, Politecnico di Milano, Emory University
+
+    This file is part of LifeV.
+
+    LifeV is free software; you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    LifeV is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with LifeV.  If not, see <http://www.gnu.org/licenses/>.
+
+ *******************************************************************************
+ */
+//@HEADER
+
+/*!
+    @file
+    @brief Reduced in-situ output of the electromechanical state
+
+    Instead of the full 3D fields, a set of reduced quantities is recorded at
+    every output time: point probes of a field, integrals (or averages) of a
+    field over the elements with a given marker and replicated scalars such as
+    the cavity volumes and pressures. All the quantities of a time are written
+    as a single line of an ASCII table by the leader process.
+
+    The expensive parts are precomputed when the quantities are registered:
+    the element containing a probe and the values of the basis functions at
+    the probe, and the weights of the region integrals. Recording a time then
+    costs one small import per probed field, one dot product per region and a
+    single reduction.
+ */
+
+#ifndef EMINSITUOUTPUT_H
+#define EMINSITUOUTPUT_H
+
+#include <string>
+#include <vector>
+#include <map>
+#include <fstream>
+#include <sstream>
+#include <iomanip>
+#include <cmath>
+
+#include <boost/shared_ptr.hpp>
+
+#include <Epetra_Comm.h>
+#include <Epetra_Map.h>
+#include <Epetra_Import.h>
+#include <Epetra_MultiVector.h>
+
+#include <lifev/core/LifeV.hpp>
+#include <lifev/core/util/LifeAssert.hpp>
+#include <lifev/core/array/VectorEpetra.hpp>
+#include <lifev/core/array/VectorSmall.hpp>
+#include <lifev/core/fem/FESpace.hpp>
+#include <lifev/core/fem/CurrentFE.hpp>
+
+namespace LifeV
+{
+
+//! EMInSituOutput - Time series of probes, region integrals and scalars
+/*!
+ *  Usage:
+ *  <ol>
+ *  <li> register the quantities with addProbe(), addRegionIntegral() and addScalar(),
+ *       always in the same order on all the processes;</li>
+ *  <li> at each output time set the scalars with setScalar() and call record ( time );</li>
+ *  <li> the table is written every flushEvery records and when the object is destroyed.</li>
+ *  </ol>
+ *  A new table is started at the first record, unless the object is built in
+ *  append mode (e.g. after a restart) and the table already exists: then the
+ *  records are added at its end.
+ *  All the quantities must be registered before the first record.
+ */
+template <typename Mesh>
+class EMInSituOutput
+{
+public:
+
+    typedef Mesh                                      mesh_Type;
+    typedef VectorEpetra                              vector_Type;
+    typedef boost::shared_ptr<vector_Type>            vectorPtr_Type;
+    typedef FESpace<mesh_Type, MapEpetra>             feSpace_Type;
+    typedef boost::shared_ptr<feSpace_Type>           feSpacePtr_Type;
+    typedef boost::shared_ptr<Epetra_Comm>            commPtr_Type;
+
+    //! Constructor
+    /*!
+     * @param fileName name of the output table
+     * @param comm communicator
+     * @param flushEvery number of records kept in memory before writing them
+     * @param append if true the records are added to an existing table
+     */
+    EMInSituOutput ( const std::string& fileName,
+                     const commPtr_Type& comm,
+                     const UInt flushEvery = 100,
+                     const bool append = false );
+
+    //! Destructor, writes the pending records
+    virtual ~EMInSituOutput();
+
+    //! Register a point probe
+    /*!
+     * The value of one component of the field is interpolated at the point
+     * with the basis functions of the element containing it. The element is
+     * located through the affine map of its vertices, hence only meshes of
+     * linear tetrahedra are supported: other meshes raise an error.
+     * @param name name of the column
+     * @param field field to be probed, it must not be reallocated afterwards
+     * @param feSpace finite element space of the field
+     * @param point coordinates of the probe
+     * @param component component of the field
+     * @return false if the point is outside the mesh; in this case the probe is not added
+     */
+    bool addProbe ( const std::string& name,
+                    const vectorPtr_Type& field,
+                    const feSpacePtr_Type& feSpace,
+                    const Vector3D& point,
+                    const UInt component = 0 );
+
+    //! Register the integral of a field over the elements with a given marker
+    /*!
+     * @param name name of the column
+     * @param field field to be integrated (unique map), it must not be reallocated afterwards
+     * @param feSpace finite element space of the field
+     * @param marker marker of the elements of the region
+     * @param component component of the field
+     * @param average if true the integral is divided by the measure of the region
+     */
+    void addRegionIntegral ( const std::string& name,
+                             const vectorPtr_Type& field,
+                             const feSpacePtr_Type& feSpace,
+                             const ID marker,
+                             const UInt component = 0,
+                             const bool average = false );
+
+    //! Register a replicated scalar, to be set with setScalar() before each record
+    void addScalar ( const std::string& name );
+
+    //! Set the value of a scalar
+    void setScalar ( const std::string& name, const Real value );
+
+    //! Record all the quantities at the given time
+    void record ( const Real time );
+
+    //! Write the pending records
+    void flush();
+
+    //! Number of recorded quantities (the time excluded)
+    UInt numColumns() const
+    {
+        return M_columnNames.size();
+    }
+
+private:
+
+    //! Entries of a field needed by the probes of this process
+    struct fieldSampler_Type
+    {
+        vectorPtr_Type                           field;
+        std::vector<Int>                         gids;
+        std::map<Int, UInt>                      positions;
+        boost::shared_ptr<Epetra_Map>            map;
+        boost::shared_ptr<Epetra_Import>         importer;
+        boost::shared_ptr<Epetra_MultiVector>    values;
+    };
+
+    //! Interpolation weights of a probe (only on the process which owns it)
+    struct probe_Type
+    {
+        UInt                                     sampler;
+        UInt                                     column;
+        std::vector<UInt>                        positions;
+        std::vector<Real>                        weights;
+    };
+
+    struct region_Type
+    {
+        vectorPtr_Type                           field;
+        vectorPtr_Type                           weights;
+        UInt                                     column;
+    };
+
+    UInt addColumn ( const std::string& name );
+
+    UInt sampler ( const vectorPtr_Type& field );
+
+    void setupSamplers();
+
+    std::string                                  M_fileName;
+    commPtr_Type                                 M_comm;
+    UInt                                         M_flushEvery;
+    bool                                         M_append;
+
+    std::vector<std::string>                     M_columnNames;
+    std::vector<fieldSampler_Type>               M_samplers;
+    std::vector<probe_Type>                      M_probes;
+    std::vector<region_Type>                     M_regions;
+    std::map<std::string, UInt>                  M_scalarColumns;
+    std::vector<Real>                            M_scalars;
+
+    bool                                         M_started;
+    UInt                                         M_pendingRecords;
+    std::ostringstream                           M_buffer;
+};
+
+// ===================================================
+// Constructors & Destructor
+// ===================================================
+template <typename Mesh>
+EMInSituOutput<Mesh>::EMInSituOutput ( const std::string& fileName,
+                                       const commPtr_Type& comm,
+                                       const UInt flushEvery,
+                                       const bool append ) :
+    M_fileName       ( fileName ),
+    M_comm           ( comm ),
+    M_flushEvery     ( flushEvery > 0 ? flushEvery : 1 ),
+    M_append         ( append ),
+    M_columnNames    (),
+    M_samplers       (),
+    M_probes         (),
+    M_regions        (),
+    M_scalarColumns  (),
+    M_scalars        (),
+    M_started        ( false ),
+    M_pendingRecords ( 0 ),
+    M_buffer         ()
+{
+    M_buffer << std::setprecision ( 10 );
+}
+
+template <typename Mesh>
+EMInSituOutput<Mesh>::~EMInSituOutput()
+{
+    flush();
+}
+
+// ===================================================
+// Methods
+// ===================================================
+template <typename Mesh>
+bool
+EMInSituOutput<Mesh>::addProbe ( const std::string& name,
+                                 const vectorPtr_Type& field,
+                                 const feSpacePtr_Type& feSpace,
+                                 const Vector3D& point,
+                                 const UInt component )
+{
+    ASSERT ( !M_started, "EMInSituOutput: probes must be added before the first record" );
+
+    // The reference coordinates below are exact only for affine tetrahedra
+    if ( mesh_Type::elementShape_Type::S_shape != TETRA
+            || mesh_Type::elementShape_Type::S_numPoints != LinearTetra::S_numPoints
+            || feSpace->refFE().shape() != TETRA )
+    {
+        ERROR_MSG ( "EMInSituOutput: probes are supported only on meshes of linear tetrahedra" );
+    }
+
+    const mesh_Type& mesh ( *feSpace->mesh() );
+    const Real tolerance ( 1e-10 );
+
+    // Reference coordinates of the point in the first element containing it
+    Int localElement ( -1 );
+    Real xi[ 3 ] = { 0., 0., 0. };
+    for ( UInt iElement = 0; iElement < mesh.numElements() && localElement < 0; ++iElement )
+    {
+        const typename mesh_Type::element_Type& element ( mesh.element ( iElement ) );
+
+        Real jacobian[ 3 ][ 3 ];
+        Real rhs[ 3 ];
+        for ( UInt i = 0; i < 3; ++i )
+        {
+            for ( UInt j = 0; j < 3; ++j )
+            {
+                jacobian[ i ][ j ] = element.point ( j + 1 ).coordinate ( i ) - element.point ( 0 ).coordinate ( i );
+            }
+            rhs[ i ] = point ( i ) - element.point ( 0 ).coordinate ( i );
+        }
+
+        const Real determinant ( jacobian[ 0 ][ 0 ] * ( jacobian[ 1 ][ 1 ] * jacobian[ 2 ][ 2 ] - jacobian[ 1 ][ 2 ] * jacobian[ 2 ][ 1 ] )
+                                 - jacobian[ 0 ][ 1 ] * ( jacobian[ 1 ][ 0 ] * jacobian[ 2 ][ 2 ] - jacobian[ 1 ][ 2 ] * jacobian[ 2 ][ 0 ] )
+                                 + jacobian[ 0 ][ 2 ] * ( jacobian[ 1 ][ 0 ] * jacobian[ 2 ][ 1 ] - jacobian[ 1 ][ 1 ] * jacobian[ 2 ][ 0 ] ) );
+        if ( std::abs ( determinant ) < tolerance * tolerance )
+        {
+            continue;
+        }
+
+        // Cramer's rule, column by column
+        Real candidate[ 3 ];
+        for ( UInt k = 0; k < 3; ++k )
+        {
+            Real matrix[ 3 ][ 3 ];
+            for ( UInt i = 0; i < 3; ++i )
+            {
+                for ( UInt j = 0; j < 3; ++j )
+                {
+                    matrix[ i ][ j ] = ( j == k ) ? rhs[ i ] : jacobian[ i ][ j ];
+                }
+            }
+            candidate[ k ] = ( matrix[ 0 ][ 0 ] * ( matrix[ 1 ][ 1 ] * matrix[ 2 ][ 2 ] - matrix[ 1 ][ 2 ] * matrix[ 2 ][ 1 ] )
+                               - matrix[ 0 ][ 1 ] * ( matrix[ 1 ][ 0 ] * matrix[ 2 ][ 2 ] - matrix[ 1 ][ 2 ] * matrix[ 2 ][ 0 ] )
+                               + matrix[ 0 ][ 2 ] * ( matrix[ 1 ][ 0 ] * matrix[ 2 ][ 1 ] - matrix[ 1 ][ 1 ] * matrix[ 2 ][ 0 ] ) ) / determinant;
+        }
+
+        if ( candidate[ 0 ] >= -tolerance && candidate[ 1 ] >= -tolerance && candidate[ 2 ] >= -tolerance
+                && candidate[ 0 ] + candidate[ 1 ] + candidate[ 2 ] <= 1. + tolerance )
+        {
+            localElement = iElement;
+            xi[ 0 ] = candidate[ 0 ];
+            xi[ 1 ] = candidate[ 1 ];
+            xi[ 2 ] = candidate[ 2 ];
+        }
+    }
+
+    // The first process containing the point owns the probe
+    const Int myPID ( M_comm->MyPID() );
+    Int candidateOwner ( localElement >= 0 ? myPID : M_comm->NumProc() );
+    Int owner ( 0 );
+    M_comm->MinAll ( &candidateOwner, &owner, 1 );
+    if ( owner == M_comm->NumProc() )
+    {
+        if ( myPID == 0 )
+        {
+            std::cerr << "EMInSituOutput: probe " << name << " is outside the mesh and is ignored" << std::endl;
+        }
+        return false;
+    }
+
+    const UInt column ( addColumn ( name ) );
+    const UInt samplerIndex ( sampler ( field ) );
+
+    if ( owner == myPID )
+    {
+        fieldSampler_Type& fieldSampler ( M_samplers[ samplerIndex ] );
+        const ReferenceFE& refFE ( feSpace->refFE() );
+
+        probe_Type probe;
+        probe.sampler = samplerIndex;
+        probe.column = column;
+        for ( UInt iDof = 0; iDof < refFE.nbDof(); ++iDof )
+        {
+            const Int gid ( feSpace->dof().localToGlobalMap ( localElement, iDof )
+                            + component * feSpace->dof().numTotalDof() );
+
+            typename std::map<Int, UInt>::const_iterator it = fieldSampler.positions.find ( gid );
+            if ( it == fieldSampler.positions.end() )
+            {
+                it = fieldSampler.positions.insert ( std::make_pair ( gid, static_cast<UInt> ( fieldSampler.gids.size() ) ) ).first;
+                fieldSampler.gids.push_back ( gid );
+            }
+            probe.positions.push_back ( it->second );
+            probe.weights.push_back ( refFE.phi ( iDof, xi[ 0 ], xi[ 1 ], xi[ 2 ] ) );
+        }
+        M_probes.push_back ( probe );
+    }
+
+    return true;
+}
+
+template <typename Mesh>
+void
+EMInSituOutput<Mesh>::addRegionIntegral ( const std::string& name,
+                                          const vectorPtr_Type& field,
+                                          const feSpacePtr_Type& feSpace,
+                                          const ID marker,
+                                          const UInt component,
+                                          const bool average )
+{
+    ASSERT ( !M_started, "EMInSituOutput: region integrals must be added before the first record" );
+    ASSERT ( field->mapType() == Unique, "EMInSituOutput: region integrals need a field with unique map" );
+
+    const mesh_Type& mesh ( *feSpace->mesh() );
+
+    CurrentFE fe ( feSpace->refFE(), getGeometricMap ( mesh ), feSpace->qr() );
+    const UInt nbLocalDof ( feSpace->dof().numLocalDof() );
+
+    // Integrals of the basis functions over the region
+    vector_Type weights ( field->map(), Repeated );
+    weights *= 0.;
+
+    Real localMeasure ( 0. );
+    for ( UInt iElement = 0; iElement < mesh.numElements(); ++iElement )
+    {
+        if ( mesh.element ( iElement ).markerID() != marker )
+        {
+            continue;
+        }
+
+        fe.update ( mesh.element ( iElement ), UPDATE_PHI | UPDATE_WDET );
+        localMeasure += fe.measure();
+
+        for ( UInt iDof = 0; iDof < nbLocalDof; ++iDof )
+        {
+            Real integral ( 0. );
+            for ( UInt iq = 0; iq < fe.nbQuadPt(); ++iq )
+            {
+                integral += fe.phi ( iDof, iq ) * fe.wDetJacobian ( iq );
+            }
+            weights[ feSpace->dof().localToGlobalMap ( iElement, iDof ) + component * feSpace->dof().numTotalDof() ] += integral;
+        }
+    }
+
+    region_Type region;
+    region.field = field;
+    region.weights.reset ( new vector_Type ( weights, Unique, Add ) );
+    region.column = addColumn ( name );
+
+    if ( average )
+    {
+        // Elements are not repeated among the processes of the partitioned mesh
+        Real measure ( 0. );
+        M_comm->SumAll ( &localMeasure, &measure, 1 );
+        if ( measure > 0. )
+        {
+            *region.weights /= measure;
+        }
+    }
+
+    M_regions.push_back ( region );
+}
+
+template <typename Mesh>
+void
+EMInSituOutput<Mesh>::addScalar ( const std::string& name )
+{
+    ASSERT ( !M_started, "EMInSituOutput: scalars must be added before the first record" );
+
+    M_scalarColumns[ name ] = addColumn ( name );
+}
+
+template <typename Mesh>
+void
+EMInSituOutput<Mesh>::setScalar ( const std::string& name, const Real value )
+{
+    typename std::map<std::string, UInt>::const_iterator it = M_scalarColumns.find ( name );
+    if ( it == M_scalarColumns.end() )
+    {
+        ERROR_MSG ( "EMInSituOutput: no scalar named " + name );
+    }
+    M_scalars[ it->second ] = value;
+}
+
+template <typename Mesh>
+void
+EMInSituOutput<Mesh>::record ( const Real time )
+{
+    if ( !M_started )
+    {
+        setupSamplers();
+        M_started = true;
+
+        // Start a new table, unless the records are appended to an existing one
+        if ( M_comm->MyPID() == 0 && ! ( M_append && std::ifstream ( M_fileName.c_str() ).good() ) )
+        {
+            std::ofstream output ( M_fileName.c_str(), std::ios::out | std::ios::trunc );
+            output << "# time";
+            for ( UInt i = 0; i < M_columnNames.size(); ++i )
+            {
+                output << " " << M_columnNames[ i ];
+            }
+            output << "\n";
+        }
+    }
+
+    // Local contributions, reduced at once
+    std::vector<Real> localValues ( M_columnNames.size(), 0. );
+
+    for ( UInt i = 0; i < M_samplers.size(); ++i )
+    {
+        fieldSampler_Type& fieldSampler ( M_samplers[ i ] );
+        fieldSampler.values->Import ( fieldSampler.field->epetraVector(), *fieldSampler.importer, Insert );
+    }
+
+    for ( UInt i = 0; i < M_probes.size(); ++i )
+    {
+        const probe_Type& probe ( M_probes[ i ] );
+        const Real* values ( ( *M_samplers[ probe.sampler ].values ) [ 0 ] );
+
+        Real value ( 0. );
+        for ( UInt j = 0; j < probe.positions.size(); ++j )
+        {
+            value += probe.weights[ j ] * values[ probe.positions[ j ] ];
+        }
+        localValues[ probe.column ] = value;
+    }
+
+    // Region integrals and scalars are already global: they are added once
+    for ( UInt i = 0; i < M_regions.size(); ++i )
+    {
+        const Real integral ( M_regions[ i ].weights->dot ( *M_regions[ i ].field ) );
+        if ( M_comm->MyPID() == 0 )
+        {
+            localValues[ M_regions[ i ].column ] = integral;
+        }
+    }
+
+    if ( M_comm->MyPID() == 0 )
+    {
+        for ( typename std::map<std::string, UInt>::const_iterator it = M_scalarColumns.begin(); it != M_scalarColumns.end(); ++it )
+        {
+            localValues[ it->second ] = M_scalars[ it->second ];
+        }
+    }
+
+    std::vector<Real> values ( localValues.size(), 0. );
+    if ( !values.empty() )
+    {
+        M_comm->SumAll ( &localValues[ 0 ], &values[ 0 ], values.size() );
+    }
+
+    if ( M_comm->MyPID() == 0 )
+    {
+        M_buffer << time;
+        for ( UInt i = 0; i < values.size(); ++i )
+        {
+            M_buffer << " " << values[ i ];
+        }
+        M_buffer << "\n";
+    }
+
+    if ( ++M_pendingRecords >= M_flushEvery )
+    {
+        flush();
+    }
+}
+
+template <typename Mesh>
+void
+EMInSituOutput<Mesh>::flush()
+{
+    if ( M_pendingRecords == 0 )
+    {
+        return;
+    }
+
+    if ( M_comm->MyPID() == 0 )
+    {
+        std::ofstream output ( M_fileName.c_str(), std::ios::out | std::ios::app );
+        output << M_buffer.str();
+        output.flush();
+    }
+
+    M_buffer.str ( "" );
+    M_pendingRecords = 0;
+}
+
+// ===================================================
+// Private Methods
+// ===================================================
+template <typename Mesh>
+UInt
+EMInSituOutput<Mesh>::addColumn ( const std::string& name )
+{
+    M_columnNames.push_back ( name );
+    M_scalars.push_back ( 0. );
+    return M_columnNames.size() - 1;
+}
+
+template <typename Mesh>
+UInt
+EMInSituOutput<Mesh>::sampler ( const vectorPtr_Type& field )
+{
+    for ( UInt i = 0; i < M_samplers.size(); ++i )
+    {
+        if ( M_samplers[ i ].field == field )
+        {
+            return i;
+        }
+    }
+
+    M_samplers.push_back ( fieldSampler_Type() );
+    M_samplers.back().field = field;
+    return M_samplers.size() - 1;
+}
+
+template <typename Mesh>
+void
+EMInSituOutput<Mesh>::setupSamplers()
+{
+    for ( UInt i = 0; i < M_samplers.size(); ++i )
+    {
+        fieldSampler_Type& fieldSampler ( M_samplers[ i ] );
+        const Epetra_BlockMap& fieldMap ( fieldSampler.field->epetraVector().Map() );
+
+        fieldSampler.map.reset ( new Epetra_Map ( -1, fieldSampler.gids.size(),
+                                                  fieldSampler.gids.empty() ? 0 : &fieldSampler.gids[ 0 ],
+                                                  fieldMap.IndexBase(), *M_comm ) );
+        fieldSampler.importer.reset ( new Epetra_Import ( *fieldSampler.map, fieldMap ) );
+        fieldSampler.values.reset ( new Epetra_MultiVector ( *fieldSampler.map, 1 ) );
+        fieldSampler.positions.clear();
+    }
+}
+
+} // namespace LifeV
+
+#endif /* EMINSITUOUTPUT_H */
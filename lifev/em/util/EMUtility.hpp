@@ -117,11 +117,10 @@ Real FLRelationship(Real I4f);
 
 
 template<typename DispVectorPtr, typename FESpaceType>
-void computeZZGradient(VectorEpetra& displacement, std::vector<DispVectorPtr> gradientPtr, boost::shared_ptr<FESpaceType>  dFESpace)
+void computeZZGradient(VectorEpetra& displacement, std::vector<DispVectorPtr>& gradientPtr, boost::shared_ptr<FESpaceType>  dFESpace)
 {
-    gradientPtr[0].reset( &GradientRecovery::ZZGradient(dFESpace, displacement, 0) );
-    gradientPtr[1].reset( &GradientRecovery::ZZGradient(dFESpace, displacement, 1) );
-    gradientPtr[2].reset( &GradientRecovery::ZZGradient(dFESpace, displacement, 2) );
+    // All the components are recovered in a single loop over the elements
+    GradientRecovery::ZZFullGradient(dFESpace, displacement, gradientPtr);
 }
 
 
@@ -0,0 +1,208 @@
+//@HEADER
+/*
+*******************************************************************************
+
+    Copyright (C) 2004, 2005, 2007 EPFL, Politecnico di Milano, INRIA
+    Copyright (C) 2010 EPFL, Politecnico di Milano, Emory University
+
+    This file is part of LifeV.
+
+    LifeV is free software; you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    LifeV is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with LifeV.  If not, see <http://www.gnu.org/licenses/>.
+
+*******************************************************************************
+*/
+//@HEADER
+
+/*!
+ *   @file
+     @brief Sum factorised integration of a flux on hexahedral meshes
+
+     @date 19-10-2026
+ */
+
+#ifndef INTEGRATE_FLUX_TENSOR_PRODUCT_HPP
+#define INTEGRATE_FLUX_TENSOR_PRODUCT_HPP
+
+#include <lifev/core/LifeV.hpp>
+
+#include <lifev/core/array/MatrixSmall.hpp>
+#include <lifev/core/array/VectorEpetra.hpp>
+#include <lifev/core/fem/GeometricMap.hpp>
+#include <lifev/core/fem/QuadratureRule.hpp>
+
+#include <lifev/eta/fem/ETTensorProductFE.hpp>
+
+#include <boost/shared_ptr.hpp>
+
+#include <vector>
+
+namespace LifeV
+{
+
+namespace ExpressionAssembly
+{
+
+//! Integrate a flux against the gradients of the test functions with sum factorisation
+/*!
+  For an ETFESpace of tensor product Lagrange elements on hexahedra, this
+  function adds to the vector the integrals
+
+  \f[ r_{i,c} = \int_\Omega \sum_d P_{cd}(\nabla u) \frac{\partial \phi_{i,c}}{\partial x_d} \f]
+
+  where u is the finite element function of the solution vector, c is the
+  component of the field and the flux P is given by the functor. The
+  gradients of u and the integrals are computed with ETTensorProductFE, so
+  the cost per element grows as p^4 with the polynomial degree p, instead of
+  the p^6 of the interpolation in integrateElement (p^9 for the elemental
+  matrices). The same function evaluates the residual of a nonlinear problem
+  (P the nonlinear flux) and the product of its Jacobian with a vector (u the
+  direction, P the linearised flux, typically computed from values stored in
+  the quadrature nodes by a previous residual evaluation).
+
+  The functor must provide
+
+  void operator() ( const UInt iElement, const UInt iQuadPt,
+                    const MatrixSmall<FieldDim, 3>& gradient,
+                    MatrixSmall<FieldDim, 3>& flux )
+
+  where gradient(c, d) is the derivative of the component c along x_d. The
+  quadrature nodes are those of the tensor product of the 1D rule (see
+  ETTensorProductFE). As for the other integrations, the result must be
+  globally assembled afterwards (result.globalAssemble()).
+
+  @param space The ETFESpace (hexahedral mesh, tensor product Lagrange element)
+  @param refFE1D The 1D Lagrange element of the same order (e.g. feSegP1 for Q1)
+  @param quadRule1D The 1D quadrature rule (e.g. quadRuleSeg3pt)
+  @param solution The vector of the finite element function u
+  @param flux The functor computing the flux
+  @param result The vector where the integrals are added
+ */
+template <typename SpaceType, typename FluxType, typename VectorType>
+void integrateFluxTensorProduct ( const boost::shared_ptr<SpaceType>& space,
+                                  const ReferenceElement& refFE1D,
+                                  const QuadratureRule& quadRule1D,
+                                  const VectorEpetra& solution,
+                                  FluxType& flux,
+                                  VectorType& result )
+{
+    const UInt fieldDim ( SpaceType::field_dim );
+
+    ASSERT ( SpaceType::space_dim == 3, "integrateFluxTensorProduct: only hexahedral meshes are supported" );
+
+    // The geometric map is a tensor product element as well (Q1 for straight hexahedra)
+    ETTensorProductFE fe ( space->refFE(), refFE1D, quadRule1D );
+    ETTensorProductFE geometry ( space->geoMap(), geoLinearSeg, quadRule1D );
+
+    const UInt nbDof ( fe.nbDof() );
+    const UInt nbGeoDof ( geometry.nbDof() );
+    const UInt nbQuadPt ( fe.nbQuadPt() );
+    const UInt nbTotalDof ( space->dof().numTotalDof() );
+
+    const VectorEpetra solutionRepeated ( solution, Repeated );
+
+    std::vector<std::vector<Real> > nodes ( 3, std::vector<Real> ( nbGeoDof ) );
+    std::vector<std::vector<Real> > nodeGradients ( 3 );
+    std::vector<std::vector<Real> > localSolution ( fieldDim, std::vector<Real> ( nbDof ) );
+    std::vector<std::vector<Real> > solutionGradients ( fieldDim );
+    std::vector<std::vector<Real> > referenceFlux ( fieldDim, std::vector<Real> ( 3 * nbQuadPt ) );
+    std::vector<Real> localVector ( nbDof );
+
+    MatrixSmall<3, 3> jacobian;
+    MatrixSmall<3, 3> inverseJacobian;
+    MatrixSmall<SpaceType::field_dim, 3> gradient;
+    MatrixSmall<SpaceType::field_dim, 3> fluxValue;
+
+    const UInt nbElements ( space->mesh()->numElements() );
+    for ( UInt iElement ( 0 ); iElement < nbElements; ++iElement )
+    {
+        // Jacobian of the geometric map, in all the quadrature nodes
+        for ( UInt d ( 0 ); d < 3; ++d )
+        {
+            for ( UInt i ( 0 ); i < nbGeoDof; ++i )
+            {
+                nodes[ d ][ i ] = space->mesh()->element ( iElement ).point ( i ).coordinate ( d );
+            }
+            geometry.interpolateGradient ( nodes[ d ], nodeGradients[ d ] );
+        }
+
+        // Gradients of the solution in the reference coordinates
+        for ( UInt c ( 0 ); c < fieldDim; ++c )
+        {
+            for ( UInt i ( 0 ); i < nbDof; ++i )
+            {
+                localSolution[ c ][ i ] = solutionRepeated[ space->dof().localToGlobalMap ( iElement, i ) + c * nbTotalDof ];
+            }
+            fe.interpolateGradient ( localSolution[ c ], solutionGradients[ c ] );
+        }
+
+        for ( UInt q ( 0 ); q < nbQuadPt; ++q )
+        {
+            for ( UInt d ( 0 ); d < 3; ++d )
+            {
+                for ( UInt k ( 0 ); k < 3; ++k )
+                {
+                    jacobian ( d, k ) = nodeGradients[ d ][ k * nbQuadPt + q ];
+                }
+            }
+            const Real wDet ( fe.weight ( q ) * jacobian.determinant() );
+            inverseJacobian = jacobian.inverse();
+
+            // Physical gradient: grad_x u = grad_xi u J^{-1}
+            for ( UInt c ( 0 ); c < fieldDim; ++c )
+            {
+                for ( UInt d ( 0 ); d < 3; ++d )
+                {
+                    gradient ( c, d ) = 0.;
+                    for ( UInt k ( 0 ); k < 3; ++k )
+                    {
+                        gradient ( c, d ) += solutionGradients[ c ][ k * nbQuadPt + q ] * inverseJacobian ( k, d );
+                    }
+                }
+            }
+
+            flux ( iElement, q, gradient, fluxValue );
+
+            // Back to the reference coordinates: P J^{-T}, with the weight
+            for ( UInt c ( 0 ); c < fieldDim; ++c )
+            {
+                for ( UInt k ( 0 ); k < 3; ++k )
+                {
+                    Real value ( 0. );
+                    for ( UInt d ( 0 ); d < 3; ++d )
+                    {
+                        value += fluxValue ( c, d ) * inverseJacobian ( k, d );
+                    }
+                    referenceFlux[ c ][ k * nbQuadPt + q ] = wDet * value;
+                }
+            }
+        }
+
+        // Integration against the gradients of the test functions
+        for ( UInt c ( 0 ); c < fieldDim; ++c )
+        {
+            fe.integrateGradient ( referenceFlux[ c ], localVector );
+
+            for ( UInt i ( 0 ); i < nbDof; ++i )
+            {
+                result.sumIntoGlobalValues ( space->dof().localToGlobalMap ( iElement, i ) + c * nbTotalDof, localVector[ i ] );
+            }
+        }
+    }
+}
+
+} // Namespace ExpressionAssembly
+
+} // Namespace LifeV
+
+#endif
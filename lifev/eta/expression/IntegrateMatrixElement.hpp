@@ -46,6 +46,7 @@
 
 #include <lifev/core/fem/QuadratureRule.hpp>
 #include <lifev/eta/fem/ETCurrentFE.hpp>
+#include <lifev/eta/fem/ETCongruentElements.hpp>
 #include <lifev/eta/fem/MeshGeometricMap.hpp>
 #include <lifev/eta/fem/QRAdapterBase.hpp>
 
@@ -539,14 +540,13 @@ integrateElement (const UInt iElement, const UInt nbQuadPt,
 
             for (UInt iQuadPt (0); iQuadPt < nbQuadPt; ++iQuadPt)
             {
-                for (UInt i (0); i < nbTestDof; ++i)
+                const Real wDet (globalCFE.wDet (iQuadPt) );
+
+                for (UInt i (iblock * nbTestDof); i < (iblock + 1) * nbTestDof; ++i)
                 {
-                    for (UInt j (0); j < nbSolutionDof; ++j)
+                    for (UInt j (jblock * nbSolutionDof); j < (jblock + 1) * nbSolutionDof; ++j)
                     {
-                        elementalMatrix.element (i + iblock * nbTestDof, j + jblock * nbSolutionDof) +=
-                            evaluation.value_qij (iQuadPt, i + iblock * nbTestDof, j + jblock * nbSolutionDof)
-                            * globalCFE.wDet (iQuadPt);
-
+                        elementalMatrix.element (i, j) += evaluation.value_qij (iQuadPt, i, j) * wDet;
                     }
                 }
             }
@@ -581,8 +581,15 @@ addTo (MatrixType& mat)
 
 //    std::cout << "M_regionFlag is " << M_regionFlag << std::endl;
 
-    for (UInt iElement (0); iElement < nbElements; ++iElement)
+    // Visit the translated elements one after the other, so that the
+    // currentFEs can reuse their geometric quantities
+    std::vector<UInt> elementOrder;
+    orderElementsByTranslationClass (*M_mesh, elementOrder);
+
+    for (UInt iOrder (0); iOrder < nbElements; ++iOrder)
     {
+        const UInt iElement (elementOrder[iOrder]);
+
         // Extracting the marker
         UInt markerID = M_testSpace->mesh()->element ( iElement ).markerID( );
 
@@ -655,6 +662,11 @@ addToClosed (MatrixType& mat)
     UInt nbTestDof (M_testSpace->refFE().nbDof() );
     UInt nbSolutionDof (M_solutionSpace->refFE().nbDof() );
 
+    // Visit the translated elements one after the other, so that the
+    // currentFEs can reuse their geometric quantities
+    std::vector<UInt> elementOrder;
+    orderElementsByTranslationClass (*M_mesh, elementOrder);
+
     // OpenMP setup and pragmas around the loop
     M_ompParams.apply();
 
@@ -724,8 +736,10 @@ addToClosed (MatrixType& mat)
         bool isPreviousAdapted (true);
 
         #pragma omp for schedule(runtime)
-        for (UInt iElement (0); iElement < nbElements; ++iElement)
+        for (UInt iOrder = 0; iOrder < nbElements; ++iOrder)
         {
+            const UInt iElement (elementOrder[iOrder]);
+
             // Update the quadrature rule adapter
             qrAdapter.update (iElement);
 
@@ -0,0 +1,154 @@
+//@HEADER
+/*
+*******************************************************************************
+
+    Copyright (C) 2004, 2005, 2007 EPFL, Politecnico di Milano, INRIA
+    Copyright (C) 2010 EPFL, Politecnico di Milano, Emory University
+
+    This file is part of LifeV.
+
+    LifeV is free software; you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    LifeV is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with LifeV.  If not, see <http://www.gnu.org/licenses/>.
+
+*******************************************************************************
+*/
+//@HEADER
+
+/*!
+    @file
+    @brief Ordering of the elements of a mesh by translation class
+
+    @date 19-10-2026
+
+    Two elements belong to the same translation class when one is a
+    translation of the other. The geometric quantities which do not change
+    with a translation (see ET_UPDATE_TRANSLATION_INVARIANT) are then the
+    same on the two elements, and the ETCurrentFE reuses them when the
+    elements are visited one after the other. On structured (e.g. grid
+    aligned hexahedral) meshes there are few classes, and visiting the
+    elements class by class reduces the geometric work to a handful of
+    elements.
+ */
+
+#ifndef ETCONGRUENTELEMENTS_HPP
+#define ETCONGRUENTELEMENTS_HPP
+
+#include <lifev/core/LifeV.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <map>
+#include <vector>
+
+namespace LifeV
+{
+
+//! Order the elements of a mesh by translation class
+/*!
+  The elements are grouped by translation class, keeping their original
+  order inside each class. The classes are identified by the vectors joining
+  the first point of the element to the other points, rounded to a small
+  fraction of the size of the first element. If the mesh contains more than
+  maxNumClasses classes (unstructured meshes) the grouping is useless and the
+  natural order is returned.
+
+  @param mesh The mesh
+  @param elementOrder The local indices of the elements, in the order they should be visited (output)
+  @param maxNumClasses Maximum number of classes for the grouping to be used
+  @return The number of classes found, 0 if the natural order is returned
+ */
+template <typename MeshType>
+UInt orderElementsByTranslationClass (const MeshType& mesh,
+                                      std::vector<UInt>& elementOrder,
+                                      const UInt maxNumClasses = 64)
+{
+    typedef std::vector<Real> key_Type;
+
+    const UInt nbElements (mesh.numElements() );
+    const UInt nbPoints (MeshType::geoShape_Type::S_numPoints);
+    const UInt nbCoor (MeshType::S_geoDimensions);
+
+    elementOrder.resize (nbElements);
+    for (UInt iElement (0); iElement < nbElements; ++iElement)
+    {
+        elementOrder[iElement] = iElement;
+    }
+
+    if ( nbElements == 0 )
+    {
+        return 0;
+    }
+
+    // The size of the first element sets the resolution of the keys
+    Real elementSize (0.0);
+    for (UInt iPoint (1); iPoint < nbPoints; ++iPoint)
+    {
+        for (UInt iCoor (0); iCoor < nbCoor; ++iCoor)
+        {
+            elementSize = std::max (elementSize, std::fabs (mesh.element (0).point (iPoint).coordinate (iCoor)
+                                                            - mesh.element (0).point (0).coordinate (iCoor) ) );
+        }
+    }
+    const Real resolution (1e-8 * elementSize);
+    if ( resolution <= 0.0 )
+    {
+        return 0;
+    }
+
+    std::map<key_Type, UInt> classes;
+    std::vector<UInt> elementClass (nbElements);
+    key_Type key ( (nbPoints - 1) * nbCoor);
+
+    for (UInt iElement (0); iElement < nbElements; ++iElement)
+    {
+        for (UInt iPoint (1); iPoint < nbPoints; ++iPoint)
+        {
+            for (UInt iCoor (0); iCoor < nbCoor; ++iCoor)
+            {
+                const Real edge (mesh.element (iElement).point (iPoint).coordinate (iCoor)
+                                 - mesh.element (iElement).point (0).coordinate (iCoor) );
+                key[ (iPoint - 1) * nbCoor + iCoor] = std::floor (edge / resolution + 0.5);
+            }
+        }
+
+        const UInt newClass (classes.size() );
+        elementClass[iElement] = classes.insert (std::make_pair (key, newClass) ).first->second;
+
+        if ( classes.size() > maxNumClasses )
+        {
+            return 0;
+        }
+    }
+
+    // Counting sort of the elements by class (stable)
+    const UInt nbClasses (classes.size() );
+    std::vector<UInt> classStart (nbClasses + 1, 0);
+    for (UInt iElement (0); iElement < nbElements; ++iElement)
+    {
+        ++classStart[elementClass[iElement] + 1];
+    }
+    for (UInt iClass (0); iClass < nbClasses; ++iClass)
+    {
+        classStart[iClass + 1] += classStart[iClass];
+    }
+    for (UInt iElement (0); iElement < nbElements; ++iElement)
+    {
+        elementOrder[classStart[elementClass[iElement]]++] = iElement;
+    }
+
+    return nbClasses;
+}
+
+} // Namespace LifeV
+
+#endif /* ETCONGRUENTELEMENTS_HPP */
@@ -53,6 +53,8 @@
 #include <lifev/core/fem/QuadratureRule.hpp>
 
 
+#include <algorithm>
+#include <cmath>
 #include <vector>
 
 namespace LifeV
@@ -96,6 +98,41 @@ class EvaluationMeas;
 
 } // Namespace Expression Assembly
 
+//! Check if a cell is a translation of another cell
+/*!
+  The cells are compared through the vectors joining their first node
+  to the other nodes: they have to coincide up to the tolerance, relative
+  to the size of the other cell.
+
+  @param cellNode Coordinates of the nodes of the cell
+  @param otherCellNode Coordinates of the nodes of the other cell
+  @param tolerance Relative tolerance
+ */
+inline bool isTranslatedCell (const std::vector< std::vector< Real > >& cellNode,
+                              const std::vector< std::vector< Real > >& otherCellNode,
+                              const Real& tolerance = 1e-12)
+{
+    if ( cellNode.size() != otherCellNode.size() || cellNode.empty() )
+    {
+        return false;
+    }
+
+    Real cellSize (0.0);
+    Real difference (0.0);
+    for (UInt iNode (1); iNode < cellNode.size(); ++iNode)
+    {
+        for (UInt iCoor (0); iCoor < cellNode[iNode].size(); ++iCoor)
+        {
+            const Real otherEdge (otherCellNode[iNode][iCoor] - otherCellNode[0][iCoor]);
+            const Real edge (cellNode[iNode][iCoor] - cellNode[0][iCoor]);
+
+            cellSize = std::max (cellSize, std::fabs (otherEdge) );
+            difference = std::max (difference, std::fabs (edge - otherEdge) );
+        }
+    }
+    return difference <= tolerance * cellSize;
+}
+
 /*!
   ETCurrenteFE is a template class. If fieldDim the general
   case is treated as representing a vectorial FE (only the case
@@ -498,6 +535,12 @@ private:
     // Storage for the derivative of the basis functions
     array2D_vector_Type M_dphi;
 
+    // Coordinates of the nodes of the cell where the translation invariant quantities were computed
+    array2D_Type M_invariantCellNode;
+
+    // Translation invariant quantities currently stored (see ET_UPDATE_TRANSLATION_INVARIANT)
+    flag_Type M_invariantFlag;
+
 #ifdef HAVE_LIFEV_DEBUG
     // Debug informations, defined only if the code
     // is compiled in debug mode. These booleans store the
@@ -567,7 +610,9 @@ ETCurrentFE (const ReferenceFE& refFE, const GeometricMap& geoMap, const Quadrat
     M_detJacobian(),
     M_wDet(),
     M_tInverseJacobian(),
-    M_dphi()
+    M_dphi(),
+    M_invariantCellNode(),
+    M_invariantFlag (ET_UPDATE_NONE)
 
 #ifdef HAVE_LIFEV_DEBUG
     , M_isCellNodeUpdated (false),
@@ -617,7 +662,9 @@ ETCurrentFE (const ReferenceFE& refFE, const GeometricMap& geoMap)
     M_detJacobian(),
     M_wDet(),
     M_tInverseJacobian(),
-    M_dphi()
+    M_dphi(),
+    M_invariantCellNode(),
+    M_invariantFlag (ET_UPDATE_NONE)
 
 #ifdef HAVE_LIFEV_DEBUG
     , M_isCellNodeUpdated (false),
@@ -664,7 +711,9 @@ ETCurrentFE (const ETCurrentFE<spaceDim, 1>& otherFE)
     M_detJacobian (otherFE.M_detJacobian),
     M_wDet (otherFE.M_wDet),
     M_tInverseJacobian (otherFE.M_tInverseJacobian),
-    M_dphi (otherFE.M_dphi)
+    M_dphi (otherFE.M_dphi),
+    M_invariantCellNode (otherFE.M_invariantCellNode),
+    M_invariantFlag (otherFE.M_invariantFlag)
 
 #ifdef HAVE_LIFEV_DEBUG
     //Beware for the comma at the begining of this line!
@@ -727,7 +776,17 @@ update (const elementType& element, const flag_Type& flag)
     {
         updateCellNode (element);
     }
-    if ( flag & ET_UPDATE_ONLY_DIAMETER )
+
+    // The quantities which do not change with a translation of the cell are kept
+    // when the cell is a translation of the one where they were computed (e.g. in
+    // structured meshes, where many cells are congruent)
+    const flag_Type invariantFlag ( flag & ET_UPDATE_TRANSLATION_INVARIANT );
+    const bool isTranslated ( ( flag & ET_UPDATE_ONLY_CELL_NODE ) && invariantFlag
+                              && ( M_invariantFlag & invariantFlag ) == invariantFlag
+                              && isTranslatedCell ( M_cellNode, M_invariantCellNode ) );
+    const flag_Type updateFlag ( isTranslated ? ( flag & ~ET_UPDATE_TRANSLATION_INVARIANT ) : flag );
+
+    if ( updateFlag & ET_UPDATE_ONLY_DIAMETER )
     {
         updateDiameter();
     }
@@ -736,36 +795,54 @@ update (const elementType& element, const flag_Type& flag)
     for (UInt i (0); i < M_nbQuadPt; ++i)
     {
         // and update the required quantities
-        if ( flag & ET_UPDATE_ONLY_QUAD_NODE )
+        if ( updateFlag & ET_UPDATE_ONLY_QUAD_NODE )
         {
             updateQuadNode (i);
         }
-        if ( flag & ET_UPDATE_ONLY_JACOBIAN )
+        if ( updateFlag & ET_UPDATE_ONLY_JACOBIAN )
         {
             updateJacobian (i);
         }
-        if ( flag & ET_UPDATE_ONLY_DET_JACOBIAN )
+        if ( updateFlag & ET_UPDATE_ONLY_DET_JACOBIAN )
         {
             updateDetJacobian (i);
         }
-        if ( flag & ET_UPDATE_ONLY_T_INVERSE_JACOBIAN )
+        if ( updateFlag & ET_UPDATE_ONLY_T_INVERSE_JACOBIAN )
         {
             updateInverseJacobian (i);
         }
-        if ( flag & ET_UPDATE_ONLY_W_DET_JACOBIAN )
+        if ( updateFlag & ET_UPDATE_ONLY_W_DET_JACOBIAN )
         {
             updateWDet (i);
         }
-        if ( flag & ET_UPDATE_ONLY_DPHI )
+        if ( updateFlag & ET_UPDATE_ONLY_DPHI )
         {
             updateDphi (i);
         }
     }
 
-    if ( flag & ET_UPDATE_ONLY_MEASURE )
+    if ( updateFlag & ET_UPDATE_ONLY_MEASURE )
     {
         updateMeasure();
     }
+
+    if ( isTranslated )
+    {
+#ifdef HAVE_LIFEV_DEBUG
+        M_isDiameterUpdated = ( invariantFlag & ET_UPDATE_ONLY_DIAMETER );
+        M_isMeasureUpdated = ( invariantFlag & ET_UPDATE_ONLY_MEASURE );
+        M_isJacobianUpdated = ( invariantFlag & ET_UPDATE_ONLY_JACOBIAN );
+        M_isDetJacobianUpdated = ( invariantFlag & ET_UPDATE_ONLY_DET_JACOBIAN );
+        M_isInverseJacobianUpdated = ( invariantFlag & ET_UPDATE_ONLY_T_INVERSE_JACOBIAN );
+        M_isWDetUpdated = ( invariantFlag & ET_UPDATE_ONLY_W_DET_JACOBIAN );
+        M_isDphiUpdated = ( invariantFlag & ET_UPDATE_ONLY_DPHI );
+#endif
+    }
+    else if ( invariantFlag )
+    {
+        M_invariantCellNode = M_cellNode;
+        M_invariantFlag = invariantFlag;
+    }
 }
 
 
@@ -869,6 +946,9 @@ void
 ETCurrentFE<spaceDim, 1>::
 setupInternalConstants()
 {
+    // The stored quantities refer to the previous quadrature
+    M_invariantFlag = ET_UPDATE_NONE;
+
     // The first group of values can be computed as it
     // it does not depend on the current element
 
@@ -351,6 +351,12 @@ private:
     // Storage for the divergence of the basis functions
     array2D_Type M_divergence;
 
+    // Coordinates of the nodes of the cell where the translation invariant quantities were computed
+    array2D_Type M_invariantCellNode;
+
+    // Translation invariant quantities currently stored (see ET_UPDATE_TRANSLATION_INVARIANT)
+    flag_Type M_invariantFlag;
+
 #ifdef HAVE_LIFEV_DEBUG
     // Debug informations, defined only if the code
     // is compiled in debug mode. These booleans store the
@@ -410,7 +416,9 @@ ETCurrentFE (const ReferenceFE& refFE, const GeometricMap& geoMap, const Quadrat
     M_wDet(),
     M_tInverseJacobian(),
     M_dphi(),
-    M_divergence()
+    M_divergence(),
+    M_invariantCellNode(),
+    M_invariantFlag (ET_UPDATE_NONE)
 
 #ifdef HAVE_LIFEV_DEBUG
     , M_isCellNodeUpdated (false),
@@ -456,7 +464,9 @@ ETCurrentFE (const ReferenceFE& refFE, const GeometricMap& geoMap)
     M_wDet(),
     M_tInverseJacobian(),
     M_dphi(),
-    M_divergence()
+    M_divergence(),
+    M_invariantCellNode(),
+    M_invariantFlag (ET_UPDATE_NONE)
 
 #ifdef HAVE_LIFEV_DEBUG
     , M_isCellNodeUpdated (false),
@@ -501,7 +511,9 @@ ETCurrentFE (const ETCurrentFE<spaceDim, fieldDim>& otherFE)
     M_wDet (otherFE.M_wDet),
     M_tInverseJacobian (otherFE.M_tInverseJacobian),
     M_dphi (otherFE.M_dphi),
-    M_divergence (otherFE.M_divergence)
+    M_divergence (otherFE.M_divergence),
+    M_invariantCellNode (otherFE.M_invariantCellNode),
+    M_invariantFlag (otherFE.M_invariantFlag)
 
 #ifdef HAVE_LIFEV_DEBUG
     //Beware for the comma at the begining of this line!
@@ -555,39 +567,64 @@ update (const elementType& element, const flag_Type& flag)
         updateCellNode (element);
     }
 
+    // The quantities which do not change with a translation of the cell are kept
+    // when the cell is a translation of the one where they were computed
+    const flag_Type invariantFlag ( flag & ET_UPDATE_TRANSLATION_INVARIANT );
+    const bool isTranslated ( ( flag & ET_UPDATE_ONLY_CELL_NODE ) && invariantFlag
+                              && ( M_invariantFlag & invariantFlag ) == invariantFlag
+                              && isTranslatedCell ( M_cellNode, M_invariantCellNode ) );
+    const flag_Type updateFlag ( isTranslated ? ( flag & ~ET_UPDATE_TRANSLATION_INVARIANT ) : flag );
+
     // Loop over the quadrature nodes
     for (UInt i (0); i < M_nbQuadPt; ++i)
     {
         // and update the required quantities
-        if ( flag & ET_UPDATE_ONLY_QUAD_NODE )
+        if ( updateFlag & ET_UPDATE_ONLY_QUAD_NODE )
         {
             updateQuadNode (i);
         }
-        if ( flag & ET_UPDATE_ONLY_JACOBIAN )
+        if ( updateFlag & ET_UPDATE_ONLY_JACOBIAN )
         {
             updateJacobian (i);
         }
-        if ( flag & ET_UPDATE_ONLY_DET_JACOBIAN )
+        if ( updateFlag & ET_UPDATE_ONLY_DET_JACOBIAN )
         {
             updateDetJacobian (i);
         }
-        if ( flag & ET_UPDATE_ONLY_T_INVERSE_JACOBIAN )
+        if ( updateFlag & ET_UPDATE_ONLY_T_INVERSE_JACOBIAN )
         {
             updateInverseJacobian (i);
         }
-        if ( flag & ET_UPDATE_ONLY_W_DET_JACOBIAN )
+        if ( updateFlag & ET_UPDATE_ONLY_W_DET_JACOBIAN )
         {
             updateWDet (i);
         }
-        if ( flag & ET_UPDATE_ONLY_DPHI )
+        if ( updateFlag & ET_UPDATE_ONLY_DPHI )
         {
             updateDphi (i);
         }
-        if ( flag & ET_UPDATE_ONLY_DIVERGENCE )
+        if ( updateFlag & ET_UPDATE_ONLY_DIVERGENCE )
         {
             updateDivergence (i);
         }
     }
+
+    if ( isTranslated )
+    {
+#ifdef HAVE_LIFEV_DEBUG
+        M_isJacobianUpdated = ( invariantFlag & ET_UPDATE_ONLY_JACOBIAN );
+        M_isDetJacobianUpdated = ( invariantFlag & ET_UPDATE_ONLY_DET_JACOBIAN );
+        M_isInverseJacobianUpdated = ( invariantFlag & ET_UPDATE_ONLY_T_INVERSE_JACOBIAN );
+        M_isWDetUpdated = ( invariantFlag & ET_UPDATE_ONLY_W_DET_JACOBIAN );
+        M_isDphiUpdated = ( invariantFlag & ET_UPDATE_ONLY_DPHI );
+        M_isDivergenceUpdated = ( invariantFlag & ET_UPDATE_ONLY_DIVERGENCE );
+#endif
+    }
+    else if ( invariantFlag )
+    {
+        M_invariantCellNode = M_cellNode;
+        M_invariantFlag = invariantFlag;
+    }
 }
 
 template< UInt spaceDim, UInt fieldDim >
@@ -701,6 +738,9 @@ setupInternalConstants()
     // The first group of values can be computed as it
     // it does not depend on the current element
 
+    // The stored quantities refer to the previous quadrature
+    M_invariantFlag = ET_UPDATE_NONE;
+
     // PHI
     M_phi.resize ( M_nbQuadPt );
     for ( UInt q ( 0 ); q < M_nbQuadPt; ++q )
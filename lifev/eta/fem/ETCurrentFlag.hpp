@@ -220,6 +220,18 @@ const flag_Type ET_UPDATE_DIAMETER (ET_UPDATE_ONLY_CELL_NODE
 const flag_Type ET_UPDATE_MEASURE (ET_UPDATE_WDET
                                    | ET_UPDATE_ONLY_MEASURE);
 
+// Quantities which do not change when the cell is translated.
+// They are not recomputed when the cell is a translation of the
+// previous one (see ETCurrentFE::update)
+const flag_Type ET_UPDATE_TRANSLATION_INVARIANT (ET_UPDATE_ONLY_JACOBIAN
+                                                 | ET_UPDATE_ONLY_DET_JACOBIAN
+                                                 | ET_UPDATE_ONLY_T_INVERSE_JACOBIAN
+                                                 | ET_UPDATE_ONLY_W_DET_JACOBIAN
+                                                 | ET_UPDATE_ONLY_DPHI
+                                                 | ET_UPDATE_ONLY_DIVERGENCE
+                                                 | ET_UPDATE_ONLY_DIAMETER
+                                                 | ET_UPDATE_ONLY_MEASURE);
+
 
 
 } // Namespace LifeV
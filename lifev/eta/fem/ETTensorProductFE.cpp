@@ -0,0 +1,253 @@
+//@HEADER
+/*
+*******************************************************************************
+
+    Copyright (C) 2004, 2005, 2007 EPFL, Politecnico di Milano, INRIA
+    Copyright (C) 2010 EPFL, Politecnico di Milano, Emory University
+
+    This file is part of LifeV.
+
+    LifeV is free software; you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    LifeV is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with LifeV.  If not, see <http://www.gnu.org/licenses/>.
+
+*******************************************************************************
+*/
+//@HEADER
+
+/*!
+    @file
+    @brief Sum factorisation for tensor product elements on hexahedra
+
+    @date 19-10-2026
+ */
+
+#include <lifev/eta/fem/ETTensorProductFE.hpp>
+
+#include <algorithm>
+#include <cmath>
+
+namespace LifeV
+{
+
+// ===================================================
+// Constructors & Destructor
+// ===================================================
+
+ETTensorProductFE::ETTensorProductFE ( const ReferenceElement& refElement,
+                                       const ReferenceElement& refElement1D,
+                                       const QuadratureRule& quadRule1D ) :
+    M_nbDof1D ( refElement1D.nbDof() ),
+    M_nbQuadPt1D ( quadRule1D.nbQuadPt() ),
+    M_nbDof ( refElement.nbDof() ),
+    M_nbQuadPt ( M_nbQuadPt1D * M_nbQuadPt1D * M_nbQuadPt1D ),
+    M_phi1D ( M_nbQuadPt1D * M_nbDof1D ),
+    M_dphi1D ( M_nbQuadPt1D * M_nbDof1D ),
+    M_weight ( M_nbQuadPt ),
+    M_localDof ( M_nbDof, 0 ),
+    M_tensorValues ( M_nbDof ),
+    M_quadValues ( M_nbQuadPt ),
+    M_work1 (),
+    M_work2 ()
+{
+    ASSERT ( refElement.shape() == HEXA, "ETTensorProductFE: the reference element must be defined on a hexahedron" );
+    ASSERT ( refElement1D.shape() == LINE, "ETTensorProductFE: the 1D reference element must be defined on a segment" );
+    ASSERT ( quadRule1D.shape() == LINE, "ETTensorProductFE: the 1D quadrature rule must be defined on a segment" );
+    ASSERT ( M_nbDof == M_nbDof1D * M_nbDof1D * M_nbDof1D, "ETTensorProductFE: the reference elements do not match" );
+
+    // 1D matrices
+    for ( UInt q ( 0 ); q < M_nbQuadPt1D; ++q )
+    {
+        for ( UInt a ( 0 ); a < M_nbDof1D; ++a )
+        {
+            M_phi1D[ q * M_nbDof1D + a ] = refElement1D.phi ( a, quadRule1D.quadPointCoor ( q ) );
+            M_dphi1D[ q * M_nbDof1D + a ] = refElement1D.dPhi ( a, 0, quadRule1D.quadPointCoor ( q ) );
+        }
+    }
+
+    // Weights of the tensor product rule
+    for ( UInt qz ( 0 ); qz < M_nbQuadPt1D; ++qz )
+    {
+        for ( UInt qy ( 0 ); qy < M_nbQuadPt1D; ++qy )
+        {
+            for ( UInt qx ( 0 ); qx < M_nbQuadPt1D; ++qx )
+            {
+                M_weight[ qx + M_nbQuadPt1D * ( qy + M_nbQuadPt1D * qz ) ] =
+                    quadRule1D.weight ( qx ) * quadRule1D.weight ( qy ) * quadRule1D.weight ( qz );
+            }
+        }
+    }
+
+    // Each basis function is identified by its node
+    const Real tolerance ( 1e-10 );
+    for ( UInt c ( 0 ); c < M_nbDof1D; ++c )
+    {
+        for ( UInt b ( 0 ); b < M_nbDof1D; ++b )
+        {
+            for ( UInt a ( 0 ); a < M_nbDof1D; ++a )
+            {
+                bool found ( false );
+                for ( UInt i ( 0 ); i < M_nbDof && !found; ++i )
+                {
+                    if ( std::fabs ( refElement.xi ( i ) - refElement1D.xi ( a ) ) < tolerance
+                            && std::fabs ( refElement.eta ( i ) - refElement1D.xi ( b ) ) < tolerance
+                            && std::fabs ( refElement.zeta ( i ) - refElement1D.xi ( c ) ) < tolerance )
+                    {
+                        M_localDof[ a + M_nbDof1D * ( b + M_nbDof1D * c ) ] = i;
+                        found = true;
+                    }
+                }
+                ASSERT ( found, "ETTensorProductFE: the nodes of the reference element are not a tensor product" );
+            }
+        }
+    }
+}
+
+// ===================================================
+// Methods
+// ===================================================
+
+void
+ETTensorProductFE::interpolate ( const std::vector<Real>& localValues, std::vector<Real>& quadValues ) const
+{
+    ASSERT ( localValues.size() == M_nbDof, "ETTensorProductFE: wrong number of coefficients" );
+
+    for ( UInt t ( 0 ); t < M_nbDof; ++t )
+    {
+        M_tensorValues[ t ] = localValues[ M_localDof[ t ] ];
+    }
+
+    const std::vector<Real>* matrices[ 3 ] = { &M_phi1D, &M_phi1D, &M_phi1D };
+    interpolateTensor ( matrices, M_tensorValues, quadValues );
+}
+
+void
+ETTensorProductFE::interpolateGradient ( const std::vector<Real>& localValues, std::vector<Real>& quadGradients ) const
+{
+    ASSERT ( localValues.size() == M_nbDof, "ETTensorProductFE: wrong number of coefficients" );
+
+    for ( UInt t ( 0 ); t < M_nbDof; ++t )
+    {
+        M_tensorValues[ t ] = localValues[ M_localDof[ t ] ];
+    }
+
+    quadGradients.resize ( 3 * M_nbQuadPt );
+    for ( UInt d ( 0 ); d < 3; ++d )
+    {
+        const std::vector<Real>* matrices[ 3 ] = { &M_phi1D, &M_phi1D, &M_phi1D };
+        matrices[ d ] = &M_dphi1D;
+        interpolateTensor ( matrices, M_tensorValues, M_quadValues );
+        std::copy ( M_quadValues.begin(), M_quadValues.end(), quadGradients.begin() + d * M_nbQuadPt );
+    }
+}
+
+void
+ETTensorProductFE::integrate ( const std::vector<Real>& quadValues, std::vector<Real>& localValues ) const
+{
+    ASSERT ( quadValues.size() == M_nbQuadPt, "ETTensorProductFE: wrong number of values" );
+
+    const std::vector<Real>* matrices[ 3 ] = { &M_phi1D, &M_phi1D, &M_phi1D };
+    integrateTensor ( matrices, quadValues, M_tensorValues );
+
+    localValues.assign ( M_nbDof, 0. );
+    for ( UInt t ( 0 ); t < M_nbDof; ++t )
+    {
+        localValues[ M_localDof[ t ] ] += M_tensorValues[ t ];
+    }
+}
+
+void
+ETTensorProductFE::integrateGradient ( const std::vector<Real>& quadGradients, std::vector<Real>& localValues ) const
+{
+    ASSERT ( quadGradients.size() == 3 * M_nbQuadPt, "ETTensorProductFE: wrong number of values" );
+
+    localValues.assign ( M_nbDof, 0. );
+    for ( UInt d ( 0 ); d < 3; ++d )
+    {
+        const std::vector<Real>* matrices[ 3 ] = { &M_phi1D, &M_phi1D, &M_phi1D };
+        matrices[ d ] = &M_dphi1D;
+        std::copy ( quadGradients.begin() + d * M_nbQuadPt, quadGradients.begin() + ( d + 1 ) * M_nbQuadPt, M_quadValues.begin() );
+        integrateTensor ( matrices, M_quadValues, M_tensorValues );
+
+        for ( UInt t ( 0 ); t < M_nbDof; ++t )
+        {
+            localValues[ M_localDof[ t ] ] += M_tensorValues[ t ];
+        }
+    }
+}
+
+// ===================================================
+// Private Methods
+// ===================================================
+
+void
+ETTensorProductFE::applyDirection ( const std::vector<Real>& matrix, const bool transposed, const UInt direction,
+                                    UInt sizes[ 3 ], const std::vector<Real>& input, std::vector<Real>& output ) const
+{
+    const UInt nbInput ( sizes[ direction ] );
+    const UInt nbOutput ( transposed ? M_nbDof1D : M_nbQuadPt1D );
+
+    // Number of entries before and after the direction
+    UInt inner ( 1 );
+    for ( UInt d ( 0 ); d < direction; ++d )
+    {
+        inner *= sizes[ d ];
+    }
+    UInt outer ( 1 );
+    for ( UInt d ( direction + 1 ); d < 3; ++d )
+    {
+        outer *= sizes[ d ];
+    }
+
+    output.assign ( inner * nbOutput * outer, 0. );
+
+    for ( UInt o ( 0 ); o < outer; ++o )
+    {
+        for ( UInt k ( 0 ); k < nbOutput; ++k )
+        {
+            Real* out ( &output[ inner * ( k + nbOutput * o ) ] );
+            for ( UInt j ( 0 ); j < nbInput; ++j )
+            {
+                const Real coefficient ( transposed ? matrix[ j * M_nbDof1D + k ] : matrix[ k * M_nbDof1D + j ] );
+                const Real* in ( &input[ inner * ( j + nbInput * o ) ] );
+                for ( UInt i ( 0 ); i < inner; ++i )
+                {
+                    out[ i ] += coefficient * in[ i ];
+                }
+            }
+        }
+    }
+
+    sizes[ direction ] = nbOutput;
+}
+
+void
+ETTensorProductFE::interpolateTensor ( const std::vector<Real>* matrices[ 3 ], const std::vector<Real>& tensorValues,
+                                       std::vector<Real>& quadValues ) const
+{
+    UInt sizes[ 3 ] = { M_nbDof1D, M_nbDof1D, M_nbDof1D };
+    applyDirection ( *matrices[ 0 ], false, 0, sizes, tensorValues, M_work1 );
+    applyDirection ( *matrices[ 1 ], false, 1, sizes, M_work1, M_work2 );
+    applyDirection ( *matrices[ 2 ], false, 2, sizes, M_work2, quadValues );
+}
+
+void
+ETTensorProductFE::integrateTensor ( const std::vector<Real>* matrices[ 3 ], const std::vector<Real>& quadValues,
+                                     std::vector<Real>& tensorValues ) const
+{
+    UInt sizes[ 3 ] = { M_nbQuadPt1D, M_nbQuadPt1D, M_nbQuadPt1D };
+    applyDirection ( *matrices[ 0 ], true, 0, sizes, quadValues, M_work1 );
+    applyDirection ( *matrices[ 1 ], true, 1, sizes, M_work1, M_work2 );
+    applyDirection ( *matrices[ 2 ], true, 2, sizes, M_work2, tensorValues );
+}
+
+} // Namespace LifeV
@@ -0,0 +1,214 @@
+//@HEADER
+/*
+*******************************************************************************
+
+    Copyright (C) 2004, 2005, 2007 EPFL, Politecnico di Milano, INRIA
+    Copyright (C) 2010 EPFL, Politecnico di Milano, Emory University
+
+    This file is part of LifeV.
+
+    LifeV is free software; you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    LifeV is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with LifeV.  If not, see <http://www.gnu.org/licenses/>.
+
+*******************************************************************************
+*/
+//@HEADER
+
+/*!
+    @file
+    @brief Sum factorisation for tensor product elements on hexahedra
+
+    @date 19-10-2026
+ */
+
+#ifndef ETTENSORPRODUCTFE_HPP
+#define ETTENSORPRODUCTFE_HPP
+
+#include <lifev/core/LifeV.hpp>
+
+#include <lifev/core/fem/ReferenceElement.hpp>
+#include <lifev/core/fem/QuadratureRule.hpp>
+
+#include <vector>
+
+namespace LifeV
+{
+
+//! ETTensorProductFE - Sum factorisation for tensor product elements
+/*!
+  The basis functions of a Lagrange element on the hexahedron (Q1, Q2, ...)
+  are products of the 1D Lagrange basis functions of the same order,
+  phi_{abc}(x,y,z) = phi_a(x) phi_b(y) phi_c(z). With a tensor product
+  quadrature rule, the values (or the gradients) of a finite element function
+  in all the quadrature nodes are obtained by applying the 1D matrices
+  B_{qa} = phi_a(x_q) and D_{qa} = phi_a'(x_q) one direction after the
+  other, instead of summing over all the basis functions in each node. With
+  n basis functions and m quadrature nodes per direction, the cost drops
+  from O(n^3 m^3) to O(n m (n^2 + n m + m^2)) per element; the same holds
+  for the integration against the basis functions (transposed matrices).
+
+  The quadrature nodes are numbered as qx + m * (qy + m * qz), the basis
+  functions with the local numbering of the 3D reference element, which is
+  matched against the tensor product of the 1D nodes in the constructor.
+  The gradients are stored by direction: the derivative along the reference
+  direction d in the node q is at the position d * nbQuadPt() + q.
+
+  The class holds working arrays, so each thread needs its own copy.
+ */
+class ETTensorProductFE
+{
+public:
+
+    //! @name Constructors & Destructor
+    //@{
+
+    //! Constructor
+    /*!
+      @param refElement Reference element on the hexahedron (finite element or geometric map)
+      @param refElement1D Reference element on the segment of the same order
+      @param quadRule1D Quadrature rule on the segment
+     */
+    ETTensorProductFE ( const ReferenceElement& refElement,
+                        const ReferenceElement& refElement1D,
+                        const QuadratureRule& quadRule1D );
+
+    //! Destructor
+    virtual ~ETTensorProductFE() {}
+
+    //@}
+
+
+    //! @name Methods
+    //@{
+
+    //! Values of the function in the quadrature nodes
+    /*!
+      @param localValues Coefficients of the function, with the numbering of the reference element
+      @param quadValues Values in the quadrature nodes (output)
+     */
+    void interpolate ( const std::vector<Real>& localValues, std::vector<Real>& quadValues ) const;
+
+    //! Gradient of the function in the quadrature nodes, in the reference coordinates
+    /*!
+      @param localValues Coefficients of the function, with the numbering of the reference element
+      @param quadGradients Derivatives in the quadrature nodes, stored by direction (output)
+     */
+    void interpolateGradient ( const std::vector<Real>& localValues, std::vector<Real>& quadGradients ) const;
+
+    //! Integration against the basis functions
+    /*!
+      Computes localValues[i] = sum_q phi_i(x_q) quadValues[q]: the quadrature
+      weights (and the determinant of the Jacobian) must be included in quadValues.
+      The previous content of localValues is overwritten.
+      @param quadValues Values in the quadrature nodes
+      @param localValues Integrals, with the numbering of the reference element (output)
+     */
+    void integrate ( const std::vector<Real>& quadValues, std::vector<Real>& localValues ) const;
+
+    //! Integration against the gradients of the basis functions
+    /*!
+      Computes localValues[i] = sum_q sum_d dphi_i/dx_d(x_q) quadGradients[d][q]
+      with the derivatives in the reference coordinates: the quadrature weights
+      and the geometric factors must be included in quadGradients.
+      The previous content of localValues is overwritten.
+      @param quadGradients Values in the quadrature nodes, stored by direction
+      @param localValues Integrals, with the numbering of the reference element (output)
+     */
+    void integrateGradient ( const std::vector<Real>& quadGradients, std::vector<Real>& localValues ) const;
+
+    //@}
+
+
+    //! @name Get Methods
+    //@{
+
+    //! Number of basis functions
+    UInt nbDof() const
+    {
+        return M_nbDof;
+    }
+
+    //! Number of quadrature nodes
+    UInt nbQuadPt() const
+    {
+        return M_nbQuadPt;
+    }
+
+    //! Weight of the quadrature node q
+    Real weight ( const UInt q ) const
+    {
+        return M_weight[ q ];
+    }
+
+    //! Local index (in the reference element) of the basis function phi_a phi_b phi_c
+    UInt localDof ( const UInt a, const UInt b, const UInt c ) const
+    {
+        return M_localDof[ a + M_nbDof1D * ( b + M_nbDof1D * c ) ];
+    }
+
+    //@}
+
+private:
+
+    //! @name Private Methods
+    //@{
+
+    //! Apply a 1D matrix along one direction
+    /*!
+      The input has M_nbDof1D (or M_nbQuadPt1D if transposed) entries along
+      the direction, the output M_nbQuadPt1D (or M_nbDof1D).
+      @param matrix The 1D matrix (M_nbQuadPt1D x M_nbDof1D, by rows)
+      @param transposed True to apply the transposed matrix
+      @param direction Direction along which the matrix is applied
+      @param sizes Number of entries along each direction of the input (updated)
+      @param input Input values
+      @param output Output values
+     */
+    void applyDirection ( const std::vector<Real>& matrix, const bool transposed, const UInt direction,
+                          UInt sizes[ 3 ], const std::vector<Real>& input, std::vector<Real>& output ) const;
+
+    //! Sum factorised interpolation with the matrices given for each direction
+    void interpolateTensor ( const std::vector<Real>* matrices[ 3 ], const std::vector<Real>& tensorValues,
+                             std::vector<Real>& quadValues ) const;
+
+    //! Sum factorised integration with the matrices given for each direction
+    void integrateTensor ( const std::vector<Real>* matrices[ 3 ], const std::vector<Real>& quadValues,
+                           std::vector<Real>& tensorValues ) const;
+
+    //@}
+
+    UInt M_nbDof1D;
+    UInt M_nbQuadPt1D;
+    UInt M_nbDof;
+    UInt M_nbQuadPt;
+
+    //! 1D basis functions and derivatives in the 1D quadrature nodes
+    std::vector<Real> M_phi1D;
+    std::vector<Real> M_dphi1D;
+
+    //! Weights of the 3D quadrature nodes
+    std::vector<Real> M_weight;
+
+    //! Local index of the basis function of each tensor index
+    std::vector<UInt> M_localDof;
+
+    //! Working arrays
+    mutable std::vector<Real> M_tensorValues;
+    mutable std::vector<Real> M_quadValues;
+    mutable std::vector<Real> M_work1;
+    mutable std::vector<Real> M_work2;
+};
+
+} // Namespace LifeV
+
+#endif /* ETTENSORPRODUCTFE_HPP */
@@ -0,0 +1,210 @@
+//@HEADER
+/*
+*******************************************************************************
+
+    Copyright (C) 2004, 2005, 2007 EPFL, Politecnico di Milano, INRIA
+    Copyright (C) 2010 EPFL, Politecnico di Milano, Emory University
+
+    This file is part of LifeV.
+
+    LifeV is free software; you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    LifeV is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with LifeV.  If not, see <http://www.gnu.org/licenses/>.
+
+*******************************************************************************
+*/
+
+/*!
+    @file
+    @brief Test for the sum factorised integration of a flux on hexahedra
+
+    The vector computed by integrateFluxTensorProduct with the flux P = grad u
+    must be equal to the Laplace matrix (assembled with ETA) applied to u.
+
+    @date 19-10-2026
+ */
+
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+
+#include <Epetra_ConfigDefs.h>
+#ifdef EPETRA_MPI
+#include <mpi.h>
+#include <Epetra_MpiComm.h>
+#else
+#include <Epetra_SerialComm.h>
+#endif
+
+#pragma GCC diagnostic warning "-Wunused-variable"
+#pragma GCC diagnostic warning "-Wunused-parameter"
+
+#include <lifev/core/LifeV.hpp>
+#include <lifev/core/filter/GetPot.hpp>
+
+#include <lifev/core/mesh/MeshPartitioner.hpp>
+#include <lifev/core/mesh/MeshData.hpp>
+#include <lifev/core/mesh/RegionMesh.hpp>
+
+#include <lifev/core/array/MatrixEpetra.hpp>
+#include <lifev/core/array/VectorEpetra.hpp>
+
+#include <lifev/eta/fem/ETFESpace.hpp>
+
+#include <lifev/eta/expression/Integrate.hpp>
+#include <lifev/eta/expression/IntegrateFluxTensorProduct.hpp>
+
+#include <boost/shared_ptr.hpp>
+
+#include <cmath>
+#include <cstdlib>
+
+
+using namespace LifeV;
+
+typedef RegionMesh<LinearHexa> mesh_Type;
+typedef MatrixEpetra<Real> matrix_Type;
+typedef VectorEpetra vector_Type;
+
+// Linear flux of the Laplace problem: P = grad u
+struct gradientFlux
+{
+    void operator() ( const UInt /*iElement*/, const UInt /*iQuadPt*/,
+                      const MatrixSmall<1, 3>& gradient, MatrixSmall<1, 3>& flux )
+    {
+        flux = gradient;
+    }
+};
+
+int main ( int argc, char** argv )
+{
+
+#ifdef HAVE_MPI
+    MPI_Init (&argc, &argv);
+    boost::shared_ptr<Epetra_Comm> Comm (new Epetra_MpiComm (MPI_COMM_WORLD) );
+#else
+    boost::shared_ptr<Epetra_Comm> Comm (new Epetra_SerialComm);
+#endif
+
+    const bool verbose (Comm->MyPID() == 0);
+
+    GetPot dataFile ( "./data" );
+
+    if (verbose)
+    {
+        std::cout << " -- Reading and partitioning the mesh ... " << std::flush;
+    }
+
+    boost::shared_ptr< mesh_Type > fullMeshPtr (new mesh_Type ( Comm ) );
+    MeshData meshData ( dataFile, "space_discretization" );
+    readMesh ( *fullMeshPtr, meshData );
+
+    MeshPartitioner< mesh_Type > meshPart;
+    meshPart.doPartition ( fullMeshPtr, Comm );
+
+    fullMeshPtr.reset();
+
+    if (verbose)
+    {
+        std::cout << " done ! " << std::endl;
+    }
+
+    boost::shared_ptr<ETFESpace< mesh_Type, MapEpetra, 3, 1 > > uSpace
+    ( new ETFESpace< mesh_Type, MapEpetra, 3, 1 > (meshPart, &feHexaQ1, Comm) );
+
+    if (verbose)
+    {
+        std::cout << " ---> Dofs: " << uSpace->dof().numTotalDof() << std::endl;
+    }
+
+    // A smooth but otherwise arbitrary function: the identity holds for any u
+    vector_Type u ( uSpace->map(), Unique );
+    for ( Int i ( 0 ); i < u.epetraVector().MyLength(); ++i )
+    {
+        const Int gid ( u.blockMap().GID ( i ) );
+        u[ gid ] = std::sin ( 0.7 * gid ) + 0.1 * gid;
+    }
+
+    if (verbose)
+    {
+        std::cout << " -- Assembling the Laplace matrix ... " << std::flush;
+    }
+
+    // Gauss rules with 2 nodes per direction in both cases: the results
+    // coincide up to the round-off errors
+    boost::shared_ptr<matrix_Type> laplaceMatrix ( new matrix_Type ( uSpace->map() ) );
+    {
+        using namespace ExpressionAssembly;
+
+        integrate ( elements ( uSpace->mesh() ),
+                    quadRuleHexa8pt,
+                    uSpace,
+                    uSpace,
+                    dot ( grad (phi_j) , grad (phi_i) )
+                  ) >> laplaceMatrix;
+    }
+    laplaceMatrix->globalAssemble();
+
+    vector_Type laplaceTimesU ( uSpace->map(), Unique );
+    laplaceMatrix->multiply ( false, u, laplaceTimesU );
+
+    if (verbose)
+    {
+        std::cout << " done ! " << std::endl;
+        std::cout << " -- Integrating the flux with sum factorisation ... " << std::flush;
+    }
+
+    vector_Type fluxIntegral ( uSpace->map(), Repeated );
+    fluxIntegral *= 0.0;
+    {
+        using namespace ExpressionAssembly;
+
+        gradientFlux flux;
+        integrateFluxTensorProduct ( uSpace, feSegP1, quadRuleSeg2pt, u, flux, fluxIntegral );
+    }
+    fluxIntegral.globalAssemble();
+    vector_Type fluxIntegralUnique ( fluxIntegral, Unique );
+
+    if (verbose)
+    {
+        std::cout << " done ! " << std::endl;
+    }
+
+    vector_Type difference ( fluxIntegralUnique );
+    difference -= laplaceTimesU;
+
+    const Real reference ( laplaceTimesU.normInf() );
+    const Real error ( difference.normInf() / reference );
+
+    if (verbose)
+    {
+        std::cout << " Reference norm : " << reference << std::endl;
+        std::cout << " Relative error : " << error << std::endl;
+    }
+
+#ifdef HAVE_MPI
+    MPI_Finalize();
+#endif
+
+    const Real testTolerance ( dataFile ( "test/tolerance", 1e-10 ) );
+
+    if ( error > testTolerance || reference == 0. )
+    {
+        return ( EXIT_FAILURE );
+    }
+
+    if (verbose)
+    {
+        std::cout << "End Result: TEST PASSED" << std::endl;
+    }
+    return ( EXIT_SUCCESS );
+
+}
@@ -0,0 +1,220 @@
+//@HEADER
+/*
+*******************************************************************************
+
+    Copyright (C) 2004, 2005, 2007 EPFL, Politecnico di Milano, INRIA
+    Copyright (C) 2010 EPFL, Politecnico di Milano, Emory University
+
+    This file is part of LifeV.
+
+    LifeV is free software; you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    LifeV is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with LifeV.  If not, see <http://www.gnu.org/licenses/>.
+
+*******************************************************************************
+*/
+
+/*!
+    @file
+    @brief Test for the ETA matrix assembly by translation classes
+
+    On grid aligned meshes, the ETA matrix integration visits the elements
+    grouped by translation class and reuses their geometric quantities. The
+    matrices assembled in this way are compared with the ones of the classical
+    assembly, which visits the elements in their natural order and computes
+    all the quantities on each element, on a tetrahedral and on a hexahedral
+    mesh.
+
+    @date 19-10-2026
+ */
+
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+
+#include <Epetra_ConfigDefs.h>
+#ifdef EPETRA_MPI
+#include <mpi.h>
+#include <Epetra_MpiComm.h>
+#else
+#include <Epetra_SerialComm.h>
+#endif
+
+#pragma GCC diagnostic warning "-Wunused-variable"
+#pragma GCC diagnostic warning "-Wunused-parameter"
+
+#include <lifev/core/LifeV.hpp>
+
+#include <lifev/core/mesh/MeshPartitioner.hpp>
+#include <lifev/core/mesh/MeshData.hpp>
+#include <lifev/core/mesh/RegionMesh3DStructured.hpp>
+#include <lifev/core/mesh/RegionMesh.hpp>
+
+#include <lifev/core/array/MatrixEpetra.hpp>
+#include <lifev/core/array/VectorEpetra.hpp>
+
+#include <lifev/core/fem/FESpace.hpp>
+#include <lifev/core/solver/ADRAssembler.hpp>
+
+#include <lifev/eta/fem/ETFESpace.hpp>
+#include <lifev/eta/fem/ETCongruentElements.hpp>
+#include <lifev/eta/expression/Integrate.hpp>
+
+#include <boost/shared_ptr.hpp>
+
+#include <cmath>
+#include <cstdlib>
+
+
+using namespace LifeV;
+
+typedef MatrixEpetra<Real> matrix_Type;
+typedef VectorEpetra vector_Type;
+
+// Relative difference between the diffusion-mass matrices assembled with ETA and
+// with the ADRAssembler on the given partitioned mesh
+template <typename MeshType>
+Real compareAssemblies ( const boost::shared_ptr<MeshType>& meshPtr,
+                         const ReferenceFE& refFE,
+                         const QuadratureRule& quadRule,
+                         const QuadratureRule& boundaryQuadRule,
+                         boost::shared_ptr<Epetra_Comm>& Comm,
+                         const std::string& name,
+                         const bool verbose )
+{
+    // The reordering must be active, otherwise the test is meaningless
+    std::vector<UInt> elementOrder;
+    Int localClasses ( orderElementsByTranslationClass ( *meshPtr, elementOrder ) );
+    Int minClasses ( 0 );
+    Comm->MinAll ( &localClasses, &minClasses, 1 );
+    if ( minClasses == 0 )
+    {
+        if ( verbose )
+        {
+            std::cout << name << ": the elements are not grouped by translation class" << std::endl;
+        }
+        return 1.;
+    }
+
+    typedef FESpace< MeshType, MapEpetra > feSpace_Type;
+    boost::shared_ptr<feSpace_Type> uSpace
+    ( new feSpace_Type ( meshPtr, refFE, quadRule, boundaryQuadRule, 1, Comm ) );
+    boost::shared_ptr<feSpace_Type> betaSpace
+    ( new feSpace_Type ( meshPtr, refFE, quadRule, boundaryQuadRule, 3, Comm ) );
+
+    boost::shared_ptr<ETFESpace< MeshType, MapEpetra, 3, 1 > > ETuSpace
+    ( new ETFESpace< MeshType, MapEpetra, 3, 1 > ( meshPtr, & ( uSpace->refFE() ), & ( uSpace->fe().geoMap() ), Comm ) );
+
+    // Classical assembly, element by element in the natural order
+    boost::shared_ptr<matrix_Type> systemMatrix ( new matrix_Type ( uSpace->map() ) );
+    *systemMatrix *= 0.0;
+    {
+        ADRAssembler<MeshType, matrix_Type, vector_Type> adrAssembler;
+        adrAssembler.setup ( uSpace, betaSpace );
+        adrAssembler.addDiffusion ( systemMatrix, 1.0 );
+        adrAssembler.addMass ( systemMatrix, 2.0 );
+    }
+    systemMatrix->globalAssemble();
+
+    // ETA assembly, by translation classes
+    boost::shared_ptr<matrix_Type> ETsystemMatrix ( new matrix_Type ( ETuSpace->map() ) );
+    *ETsystemMatrix *= 0.0;
+    {
+        using namespace ExpressionAssembly;
+
+        integrate ( elements ( ETuSpace->mesh() ),
+                    uSpace->qr(),
+                    ETuSpace,
+                    ETuSpace,
+                    dot ( grad ( phi_i ) , grad ( phi_j ) )
+                    + value ( 2.0 ) * phi_i * phi_j
+                  ) >> ETsystemMatrix;
+    }
+    ETsystemMatrix->globalAssemble();
+
+    boost::shared_ptr<matrix_Type> checkMatrix ( new matrix_Type ( ETuSpace->map() ) );
+    *checkMatrix *= 0.0;
+    *checkMatrix += *systemMatrix;
+    *checkMatrix += ( *ETsystemMatrix ) * ( -1 );
+    checkMatrix->globalAssemble();
+
+    const Real error ( checkMatrix->normInf() / systemMatrix->normInf() );
+
+    if ( verbose )
+    {
+        std::cout << name << ": " << minClasses << " translation classes (min), relative difference "
+                  << error << std::endl;
+    }
+    return error;
+}
+
+int main ( int argc, char** argv )
+{
+
+#ifdef HAVE_MPI
+    MPI_Init (&argc, &argv);
+    boost::shared_ptr<Epetra_Comm> Comm (new Epetra_MpiComm (MPI_COMM_WORLD) );
+#else
+    boost::shared_ptr<Epetra_Comm> Comm (new Epetra_SerialComm);
+#endif
+
+    const bool verbose (Comm->MyPID() == 0);
+
+    // Structured tetrahedral mesh
+    boost::shared_ptr< RegionMesh<LinearTetra> > tetraMeshPtr;
+    {
+        boost::shared_ptr< RegionMesh<LinearTetra> > fullMeshPtr ( new RegionMesh<LinearTetra> ( Comm ) );
+        regularMesh3D ( *fullMeshPtr, 1, 6, 6, 6, false,
+                        2.0,   2.0,   2.0,
+                        -1.0,  -1.0,  -1.0 );
+
+        MeshPartitioner< RegionMesh<LinearTetra> > meshPart ( fullMeshPtr, Comm );
+        tetraMeshPtr = meshPart.meshPartition();
+    }
+
+    // Hexahedral mesh
+    boost::shared_ptr< RegionMesh<LinearHexa> > hexaMeshPtr;
+    {
+        boost::shared_ptr< RegionMesh<LinearHexa> > fullMeshPtr ( new RegionMesh<LinearHexa> ( Comm ) );
+        MeshData meshData;
+        meshData.setMeshDir ( "./" );
+        meshData.setMeshFile ( "hexahexa_4x4x4.mesh" );
+        meshData.setMeshType ( ".mesh" );
+        meshData.setVerbose ( false );
+        readMesh ( *fullMeshPtr, meshData );
+
+        MeshPartitioner< RegionMesh<LinearHexa> > meshPart ( fullMeshPtr, Comm );
+        hexaMeshPtr = meshPart.meshPartition();
+    }
+
+    const Real tetraError ( compareAssemblies ( tetraMeshPtr, feTetraP1, quadRuleTetra4pt, quadRuleTria3pt,
+                                                Comm, "tetrahedra", verbose ) );
+    const Real hexaError ( compareAssemblies ( hexaMeshPtr, feHexaQ1, quadRuleHexa8pt, quadRuleQuad4pt,
+                                               Comm, "hexahedra", verbose ) );
+
+#ifdef HAVE_MPI
+    MPI_Finalize();
+#endif
+
+    const Real testTolerance ( 1e-10 );
+
+    if ( tetraError > testTolerance || hexaError > testTolerance )
+    {
+        return ( EXIT_FAILURE );
+    }
+
+    if (verbose)
+    {
+        std::cout << "End Result: TEST PASSED" << std::endl;
+    }
+    return ( EXIT_SUCCESS );
+
+}
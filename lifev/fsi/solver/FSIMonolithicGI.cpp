@@ -25,6 +25,8 @@
 //@HEADER
 
 
+#include <algorithm>
+
 #include <lifev/core/LifeV.hpp>
 
 #include <lifev/fsi/solver/FSIMonolithicGI.hpp>
@@ -44,6 +46,7 @@ FSIMonolithicGI::FSIMonolithicGI() :
     M_uk                    (),
     M_interface             (0),
     M_meshBlock             (),
+    M_meshBlockReference    (),
     M_shapeDerivativesBlock (),
     M_solidDerBlock         ()
 {
@@ -104,6 +107,7 @@ FSIMonolithicGI::buildSystem()
 {
     super_Type::buildSystem();
     M_meshMotion->computeMatrix();
+    M_meshBlockReference.reset();
 }
 
 void
@@ -322,8 +326,9 @@ void FSIMonolithicGI::setupBlockPrec()
 
     if ( M_data->dataFluid()->useShapeDerivatives() )
     {
+        // The pattern of the shape derivatives does not change: once the block is
+        // assembled, the new values are summed into its graph
         *M_shapeDerivativesBlock *= 0.;
-        M_shapeDerivativesBlock->openCrsMatrix();
         shapeDerivatives ( M_shapeDerivativesBlock );
         M_shapeDerivativesBlock->globalAssemble();
         M_monolithicMatrix->addToGlobalMatrix ( M_shapeDerivativesBlock );
@@ -412,78 +417,66 @@ void FSIMonolithicGI::shapeDerivatives ( FSIOperator::fluid_Type::matrixPtr_Type
 
 void FSIMonolithicGI::assembleMeshBlock ( UInt /*iter*/ )
 {
-
-    M_meshBlock.reset ( new matrix_Type ( *M_monolithicMap ) );
-    M_meshMotion->addSystemMatrixTo ( M_meshBlock );
-    M_meshBlock->globalAssemble();
-    UInt offset ( M_solidAndFluidDim + nDimensions * M_interface );
-    std::map< ID, ID >::const_iterator ITrow;
-    std::map< ID, ID > locdofmap ( M_dofStructureToFluid->localDofMap() );
-
-    /******************alternative way************************/
-    //     BCFunctionBase bcf(fZero);
-    //     fluidBchandlerPtr_Type BCh(new fluidBchandler_Type() );
-    //     BCh->addBC("Interface", 1, Essential, Full,
-    //                bcf, 3);
-
-    //     BCh->setOffset(M_solidAndFluidDim + nDimensions*M_interface);
-
-    //     if ( !BCh->bcUpdateDone() )
-    //         BCh->bcUpdate( *M_mmFESpace->mesh(), M_mmFESpace->feBd(), M_mmFESpace->dof() );
-
-    //     bcManage( *M_meshBlock, *M_rhsFull, *M_mmFESpace->mesh(), M_mmFESpace->dof(), *BCh, M_mmFESpace->feBd(), 1., dataFluid()->dataTime()->time());
-    /********************************************************/
-
-    matrixPtr_Type diagFilter (new matrix_Type (*M_monolithicMap) );
-    diagFilter->insertZeroDiagonal ();
-    for ( ID dim = 0; dim < nDimensions; ++dim )
+    // The harmonic extension matrix and the interface dofs do not change along the
+    // nonlinear iterations: the block is built once, then only its values are restored
+    // (the block is modified in place by some of the preconditioners)
+    if ( !M_meshBlockReference )
     {
-        for ( ITrow = locdofmap.begin(); ITrow != locdofmap.end(); ++ITrow )
+        M_meshBlockReference.reset ( new matrix_Type ( *M_monolithicMap ) );
+        M_meshMotion->addSystemMatrixTo ( M_meshBlockReference );
+        M_meshBlockReference->globalAssemble();
+        UInt offset ( M_solidAndFluidDim + nDimensions * M_interface );
+        std::map< ID, ID >::const_iterator ITrow;
+        const std::map< ID, ID >& locdofmap ( M_dofStructureToFluid->localDofMap() );
+
+        /******************alternative way************************/
+        //     BCFunctionBase bcf(fZero);
+        //     fluidBchandlerPtr_Type BCh(new fluidBchandler_Type() );
+        //     BCh->addBC("Interface", 1, Essential, Full,
+        //                bcf, 3);
+
+        //     BCh->setOffset(M_solidAndFluidDim + nDimensions*M_interface);
+
+        //     if ( !BCh->bcUpdateDone() )
+        //         BCh->bcUpdate( *M_mmFESpace->mesh(), M_mmFESpace->feBd(), M_mmFESpace->dof() );
+
+        //     bcManage( *M_meshBlock, *M_rhsFull, *M_mmFESpace->mesh(), M_mmFESpace->dof(), *BCh, M_mmFESpace->feBd(), 1., dataFluid()->dataTime()->time());
+        /********************************************************/
+
+        // The interface rows known by this process are routed to their owners by diagonalize
+        std::vector<UInt> interfaceRows;
+        interfaceRows.reserve ( nDimensions * locdofmap.size() );
+        for ( ID dim = 0; dim < nDimensions; ++dim )
         {
-            int i = ITrow->first;
-            int iRow =  i + offset + dim * M_mmFESpace->dof().numTotalDof();
-            if ( M_meshBlock->mapPtr()->map (Unique)->MyGID (iRow) )
+            for ( ITrow = locdofmap.begin(); ITrow != locdofmap.end(); ++ITrow )
             {
-                M_meshBlock->diagonalize ( iRow, 1. );
-            }
-            else
-            {
-                double myValues[1];
-                myValues[0] = -1;
-                int myIndices[1];
-                myIndices[0] = iRow;
-                diagFilter->matrixPtr()->SumIntoGlobalValues ( iRow, 1, myValues, myIndices );
+                interfaceRows.push_back ( ITrow->first + dim * M_mmFESpace->dof().numTotalDof() );
             }
         }
+        M_meshBlockReference->diagonalize ( interfaceRows, 1., offset );
     }
 
-    diagFilter->globalAssemble();
-    // Processor informations
-    Int  numLocalEntries = diagFilter->matrixPtr()->RowMap().NumMyElements();
-    Int* globalEntries   = diagFilter->matrixPtr()->RowMap().MyGlobalElements();
-    UInt globalRowIndex (0);
-
-    // Source informations handlers
-    double* diagValue;
-    Int* indices;
-    Int srcRow (0);
-    Int controlValue (0); // This value should be one since it is a diagonal matrix
-
-    for (Int i (0); i < numLocalEntries; ++i)
+    // Copies of a matrix share its graph: if the block still has it, the values are copied row by row
+    if ( M_meshBlock && M_meshBlock->matrixPtr()->Filled()
+            && M_meshBlock->matrixPtr()->Graph().DataPtr() == M_meshBlockReference->matrixPtr()->Graph().DataPtr() )
     {
-        // Collecting the data from the source
-        globalRowIndex = globalEntries[i];
+        const Epetra_CrsMatrix& source ( *M_meshBlockReference->matrixPtr() );
+        Epetra_CrsMatrix& target ( *M_meshBlock->matrixPtr() );
 
-        // Get the data of the row
-        srcRow = diagFilter->matrixPtr()->LRID (static_cast<EpetraInt_Type> (globalRowIndex) );
-        diagFilter->matrixPtr()->ExtractMyRowView (srcRow, controlValue, diagValue, indices);
-
-        ASSERT ( controlValue == 1, "Error: The matrix should be diagonal.");
-        if (diagValue[0] < 0.0)
+        Int numEntries ( 0 );
+        Real* sourceValues ( 0 );
+        Real* targetValues ( 0 );
+        for ( Int row ( 0 ); row < source.NumMyRows(); ++row )
         {
-            M_meshBlock->diagonalize ( globalRowIndex, 1. );
+            source.ExtractMyRowView ( row, numEntries, sourceValues );
+            target.ExtractMyRowView ( row, numEntries, targetValues );
+            std::copy ( sourceValues, sourceValues + numEntries, targetValues );
         }
     }
+    else
+    {
+        M_meshBlock.reset ( new matrix_Type ( *M_meshBlockReference ) );
+    }
 }
 
 // ===================================================
@@ -220,7 +220,8 @@ private:
 
     //! assembles the mesh motion matrix.
     /*!In Particular it diagonalize the part of the matrix corresponding to the
-     Dirichlet condition expressing the coupling
+     Dirichlet condition expressing the coupling. The matrix is built at the first call
+     after buildSystem(), the following calls restore its values in place.
      \param iter: current iteration: used as flag to distinguish the first nonlinear iteration from the others
      */
     void assembleMeshBlock ( UInt iter );
@@ -237,6 +238,8 @@ private:
     vectorPtr_Type                       M_uk;
     UInt                                 M_interface;
     matrixPtr_Type                       M_meshBlock;
+    //! Mesh block with the interface rows diagonalized, built once
+    matrixPtr_Type                       M_meshBlockReference;
     FSIOperator::fluid_Type::matrixPtr_Type M_shapeDerivativesBlock;
     matrixPtr_Type                       M_solidDerBlock;
     //std::vector<fluidBchandlerPtr_Type>    M_BChsLin;
@@ -47,6 +47,10 @@
 #include <lifev/core/fem/Assembly.hpp>
 #include <lifev/core/fem/BCManage.hpp>
 #include <lifev/core/fem/FESpace.hpp>
+#include <lifev/core/array/MatrixEpetraStructured.hpp>
+
+#include <lifev/eta/fem/ETFESpace.hpp>
+#include <lifev/eta/expression/Integrate.hpp>
 
 
 namespace LifeV
@@ -64,6 +68,10 @@ namespace LifeV
   displacement is computed by calling the public method update. Finally, this extension can be recovered by
   calling method getDisplacement.
 
+  The laplacian depends only on the reference mesh: the boundary conditions are imposed on a copy of it
+  and its preconditioner is built only when the boundary conditions handler changes, so that iterate()
+  reduces to the update of the right hand side and a solve.
+
 */
 
 template < typename Mesh,
@@ -148,7 +156,7 @@ public:
     {
         if (reset)
         {
-            M_linearSolver->precReset();
+            M_linearSolver->resetPreconditioner();
         }
     }
 
@@ -156,6 +164,19 @@ public:
     void rescaleMatrix (Real& dt)
     {
         *M_matrHE *= dt;
+        resetBCCache();
+    }
+
+    //! Rebuild the matrix with the boundary conditions at the next applyBoundaryConditions()
+    /*!
+        The matrix is rebuilt automatically when the handler is not updated yet or
+        when the flags, types, modes or components of its BCs change. This method
+        covers the other changes, e.g. a handler updated again by another solver.
+     */
+    void resetBCCache()
+    {
+        M_bcHandlerImposed = 0;
+        M_bcSignatureImposed.clear();
     }
 
     //! Adds the system matrix to the argument
@@ -216,13 +237,19 @@ private:
     //! The matrix holding the values
     matrixPtr_Type                 M_matrHE;
 
+    //! The matrix with the boundary conditions imposed, used to solve the system
+    matrixPtr_Type                 M_matrHEBC;
+
+    //! The handler whose conditions are imposed in M_matrHEBC
+    const BCHandler*               M_bcHandlerImposed;
+
+    //! Flag, type, mode and number of components of each BC imposed in M_matrHEBC
+    std::vector<Int>               M_bcSignatureImposed;
+
     Displayer                      M_displayer;
     int                            M_me;
     bool                           M_verbose;
 
-    //! Elementary matrix : 3 blocks
-    MatrixElemental                        M_elmat;
-
     //! The actual extension of the displacement
     vectorPtr_Type                    M_disp;
 
@@ -250,10 +277,12 @@ HarmonicExtensionSolver ( FESpace<Mesh, MapEpetra>& mmFESpace,
     M_FESpace               ( mmFESpace ),
     M_localMap              ( M_FESpace.map() ),
     M_matrHE                ( new matrix_Type (M_localMap ) ),
+    M_matrHEBC              ( ),
+    M_bcHandlerImposed      ( 0 ),
+    M_bcSignatureImposed    ( ),
     M_displayer              ( comm ),
     M_me                    ( comm->MyPID() ),
     M_verbose               ( M_me == 0 ),
-    M_elmat                 ( M_FESpace.fe().nbFEDof(), nDimensions, nDimensions ),
     M_disp                  ( ),
     M_secondRHS             ( ),
     M_linearSolver          ( ),
@@ -271,10 +300,12 @@ HarmonicExtensionSolver ( FESpace<Mesh, MapEpetra>& mmFESpace,
     M_FESpace               ( mmFESpace ),
     M_localMap              ( localMap),
     M_matrHE                ( new matrix_Type (M_localMap ) ),
+    M_matrHEBC              ( ),
+    M_bcHandlerImposed      ( 0 ),
+    M_bcSignatureImposed    ( ),
     M_displayer              ( comm ),
     M_me                    ( comm->MyPID() ),
     M_verbose               ( M_me == 0 ),
-    M_elmat                 ( M_FESpace.fe().nbFEDof(), nDimensions, nDimensions ),
     M_secondRHS             ( ),
     M_linearSolver          ( ),
     M_diffusion             ( 1. ),
@@ -296,8 +327,12 @@ void HarmonicExtensionSolver<Mesh, SolverType>::setUp ( const GetPot& dataFile )
 
     M_diffusion = dataFile ("mesh_motion/diffusion", 1.0);
 
+    // The operator does not change: unless the data file says otherwise, its preconditioner
+    // (or factorization) is kept until the boundary conditions change. The reuse policy is
+    // the one of the data file (degradation by default)
+    M_linearSolver->setReusePreconditioner ( dataFile ( "mesh_motion/solver/reuse", true ) );
+
     computeMatrix( );
-    M_linearSolver->setMatrix ( *M_matrHE );
     M_secondRHS.reset (new vector_Type (M_FESpace.map() ) );
     M_disp.reset (new vector_Type (M_FESpace.map() ) );
 } // end setUp
@@ -319,8 +354,8 @@ HarmonicExtensionSolver<Mesh, SolverType>::iterate ( BCHandler& BCh )
     chrono.stop();
     M_displayer.leaderPrintMax ("done in " , chrono.diff() );
 
-    // solving the system. Note: setMatrix(M_matrHE) done in setUp()
-    M_linearSolver->solveSystem ( *M_secondRHS, *M_disp, M_matrHE );
+    // solving the system. Note: setMatrix(M_matrHEBC) done in applyBoundaryConditions()
+    M_linearSolver->solveSystem ( *M_secondRHS, *M_disp, M_matrHEBC );
 }
 
 template <typename Mesh, typename SolverType>
@@ -331,7 +366,8 @@ HarmonicExtensionSolver<Mesh, SolverType>::applyBoundaryConditions (vector_Type&
     // CHANGED BY S. QUINODOZ !
     // "if" exchanged
 
-    if (  ! BCh.bcUpdateDone() )
+    const bool bcUpdated ( !BCh.bcUpdateDone() );
+    if ( bcUpdated )
     {
         // BC boundary information update
         BCh.bcUpdate ( *M_FESpace.mesh(), M_FESpace.feBd(), M_FESpace.dof() );
@@ -346,7 +382,27 @@ HarmonicExtensionSolver<Mesh, SolverType>::applyBoundaryConditions (vector_Type&
         bcManageRhs (rhs, *M_FESpace.mesh(), M_FESpace.dof(), BCh, M_FESpace.feBd(), 1., 0.0);
     }
 
-    bcManageMatrix ( *M_matrHE, *M_FESpace.mesh(), M_FESpace.dof(), BCh, M_FESpace.feBd(), 1.0, 0. );
+    // The matrix is rebuilt when the handler, its update or its set of conditions change
+    std::vector<Int> bcSignature;
+    bcSignature.reserve ( 4 * BCh.size() );
+    for ( BCHandler::bcBaseConstIterator_Type it = BCh.begin(); it != BCh.end(); ++it )
+    {
+        bcSignature.push_back ( static_cast<Int> ( it->flag() ) );
+        bcSignature.push_back ( static_cast<Int> ( it->type() ) );
+        bcSignature.push_back ( static_cast<Int> ( it->mode() ) );
+        bcSignature.push_back ( static_cast<Int> ( it->numberOfComponents() ) );
+    }
+
+    if ( bcUpdated || &BCh != M_bcHandlerImposed || bcSignature != M_bcSignatureImposed )
+    {
+        M_matrHEBC.reset ( new matrix_Type ( *M_matrHE ) );
+        bcManageMatrix ( *M_matrHEBC, *M_FESpace.mesh(), M_FESpace.dof(), BCh, M_FESpace.feBd(), 1.0, 0. );
+
+        M_linearSolver->setMatrix ( *M_matrHEBC );
+        M_linearSolver->resetPreconditioner();
+        M_bcHandlerImposed = &BCh;
+        M_bcSignatureImposed.swap ( bcSignature );
+    }
 }
 
 template <typename Mesh, typename SolverType>
@@ -356,23 +412,47 @@ void HarmonicExtensionSolver<Mesh, SolverType>::computeMatrix( )
     chrono.start();
     M_displayer.leaderPrint (" HE-  Computing constant matrices ...          ");
 
-    M_matrHE.reset ( new matrix_Type (M_localMap ) );
+    using namespace ExpressionAssembly;
+
+    typedef ETFESpace<Mesh, MapEpetra, 3, 3>           ETFESpace_Type;
+    typedef MatrixEpetraStructured<Real>               matrixStructured_Type;
+
+    boost::shared_ptr<Epetra_Comm> commPtr ( comm() );
+    boost::shared_ptr<ETFESpace_Type> ETSpace ( new ETFESpace_Type ( M_FESpace.mesh(),
+                                                                     & ( M_FESpace.refFE() ),
+                                                                     & ( M_FESpace.fe().geoMap() ),
+                                                                     commPtr ) );
+
+    // The laplacian of the displacement fills the diagonal block starting at the offset
+    const UInt totalDof   = M_FESpace.dof().numTotalDof();
+    const UInt meshDof    = M_FESpace.fieldDim() * totalDof;
+    const UInt globalDof  = M_localMap.map ( Unique )->NumGlobalElements();
 
-    UInt totalDof   = M_FESpace.dof().numTotalDof();
-    // Loop on elements
-    for ( UInt i = 0; i < M_FESpace.mesh()->numVolumes(); ++i )
+    std::vector<UInt> blockNumRows;
+    if ( M_offset > 0 )
     {
-        // Updating derivatives
-        M_FESpace.fe().updateFirstDerivQuadPt ( M_FESpace.mesh()->volumeList ( i ) );
-        M_elmat.zero();
-        AssemblyElemental::stiff ( M_diffusion, M_elmat, M_FESpace.fe(), 0, 0, 3 );
-        // Assembling
-        for ( UInt j = 0; j < M_FESpace.fieldDim(); ++j )
-        {
-            assembleMatrix ( *M_matrHE, M_elmat, M_FESpace.fe(), M_FESpace.dof(), j, j, j * totalDof + M_offset, j * totalDof + M_offset );
-        }
+        blockNumRows.push_back ( M_offset );
+    }
+    const UInt meshBlock ( blockNumRows.size() );
+    blockNumRows.push_back ( meshDof );
+    if ( globalDof > M_offset + meshDof )
+    {
+        blockNumRows.push_back ( globalDof - M_offset - meshDof );
     }
 
+    boost::shared_ptr<matrixStructured_Type> matrix ( new matrixStructured_Type ( M_localMap ) );
+    matrix->setBlockStructure ( blockNumRows, blockNumRows );
+
+    integrate ( elements ( ETSpace->mesh() ),
+                M_FESpace.qr(),
+                ETSpace,
+                ETSpace,
+                value ( M_diffusion ) * dot ( grad ( phi_i ), grad ( phi_j ) )
+              ) >> matrix->block ( meshBlock, meshBlock );
+
+    M_matrHE = matrix;
+    resetBCCache();
+
     M_matrHE->globalAssemble();
 
     chrono.stop();
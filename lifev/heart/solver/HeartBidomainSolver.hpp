@@ -51,6 +51,7 @@
 #include <lifev/core/fem/SobolevNorms.hpp>
 #include <lifev/core/fem/GeometricMap.hpp>
 #include <lifev/heart/solver/HeartBidomainData.hpp>
+#include <lifev/heart/solver/PreconditionerBidomainBlock.hpp>
 #include <lifev/core/util/LifeChrono.hpp>
 #include <boost/shared_ptr.hpp>
 #include <lifev/core/fem/FESpace.hpp>
@@ -262,7 +263,12 @@ protected:
     //! Stiff matrix: D*stiff
     matrixPtr_Type                 M_matrStiff;
 
+    //! K + alpha M, with alpha = M_massCoeffNoBC
     matrixPtr_Type                 M_matrNoBC;
+    Real                           M_massCoeffNoBC;
+
+    //! Matrix with the boundary conditions, it shares the graph of M_matrNoBC
+    matrixPtr_Type                 M_matrBC;
 
     //! Right hand side for the PDE
     vector_Type                    M_rhsNoBC;
@@ -301,6 +307,9 @@ protected:
     bool                           M_reusePrec;
     bool                           M_resetPreconditioner;
 
+    //! Boolean that indicates if the precond has to be built for a new pattern instead of recomputed
+    bool                           M_buildPreconditioner;
+
     //! Integer storing the max number of solver iteration with prec recomputing
     Int                            M_maxIterSolver;
 
@@ -347,6 +356,8 @@ HeartBidomainSolver ( const data_type&          dataType,
     M_matrMass               ( ),
     M_matrStiff              ( ),
     M_matrNoBC               ( ),
+    M_massCoeffNoBC          ( 0. ),
+    M_matrBC                 ( ),
     M_rhsNoBC                ( M_localMap ),
     M_solutionIntraExtraPotential               ( M_localMap ),
     M_solutionTransmembranePotential            ( M_localMap_u ),
@@ -361,6 +372,7 @@ HeartBidomainSolver ( const data_type&          dataType,
     M_updated                ( false ),
     M_reusePrec              ( true ),
     M_resetPreconditioner              ( true ),
+    M_buildPreconditioner    ( true ),
     M_maxIterSolver          ( -1 ),
     M_recomputeMatrix        ( false ),
     M_BDFIntraExtraPotential ( M_data.BDForder() ),
@@ -420,6 +432,13 @@ void HeartBidomainSolver<Mesh, SolverType>::setup ( const GetPot& dataFile )
     M_prec.reset ( PRECFactory::instance().createObject ( precType ) );
     ASSERT (M_prec.get() != 0, "bidomainSolver : Preconditioner not set");
     M_prec->setDataFromGetPot ( dataFile, "electric/prec" );
+
+    // The block preconditioner works on the intracellular and extracellular blocks
+    PreconditionerBidomainBlock* blockPrec = dynamic_cast<PreconditionerBidomainBlock*> ( M_prec.get() );
+    if ( blockPrec )
+    {
+        blockPrec->setPotentialMap ( M_uFESpace.map() );
+    }
 }
 
 template<typename Mesh, typename SolverType>
@@ -613,6 +632,10 @@ void HeartBidomainSolver<Mesh, SolverType>::buildSystem()
     *M_matrNoBC += *M_matrStiff;
     *M_matrNoBC += *M_matrMass * massCoeff;
     M_matrNoBC->globalAssemble();
+    M_massCoeffNoBC = massCoeff;
+
+    // New pattern: the matrix with the boundary conditions is built again
+    M_matrBC.reset();
     chrono.stop();
     if (M_verbose)
     {
@@ -710,18 +733,20 @@ updatePDESystem (Real alpha, vector_Type& sourceVec)
 
     chrono.start();
 
-    M_matrNoBC.reset (new matrix_Type (M_localMap, M_matrStiff->meanNumEntries() ) );
-
-    *M_matrNoBC += *M_matrStiff;
-
-    *M_matrNoBC += *M_matrMass * alpha;
+    // The pattern of K + alpha M does not depend on alpha: the values are updated in place
+    if ( alpha != M_massCoeffNoBC )
+    {
+        *M_matrNoBC *= 0.;
+        M_matrNoBC->add ( 1., *M_matrStiff );
+        M_matrNoBC->add ( alpha, *M_matrMass );
+        M_massCoeffNoBC = alpha;
+    }
 
     chrono.stop();
     if (M_verbose) std::cout << "done in " << chrono.diff() << " s.\n"
                                  << std::flush;
 
     M_updated = true;
-    M_matrNoBC->globalAssemble();
 }
 
 template<typename Mesh, typename SolverType>
@@ -753,7 +778,18 @@ void HeartBidomainSolver<Mesh, SolverType>::PDEiterate ( bchandlerRaw_Type& bch
     Chrono chrono;
     chrono.start();
 
-    matrixPtr_Type matrFull ( new matrix_Type (*M_matrNoBC) );
+    // The boundary conditions are imposed on a matrix sharing the graph of M_matrNoBC:
+    // after the first step, only its values are restored
+    if ( !M_matrBC )
+    {
+        M_matrBC.reset ( new matrix_Type (*M_matrNoBC) );
+        M_buildPreconditioner = true;
+    }
+    else
+    {
+        *M_matrBC *= 0.;
+        M_matrBC->add ( 1., *M_matrNoBC );
+    }
     vector_Type    rhsFull = M_rhsNoBC;
 
     chrono.stop();
@@ -768,7 +804,7 @@ void HeartBidomainSolver<Mesh, SolverType>::PDEiterate ( bchandlerRaw_Type& bch
                                  << std::flush;
 
     chrono.start();
-    applyBoundaryConditions ( *matrFull, rhsFull, bch);
+    applyBoundaryConditions ( *M_matrBC, rhsFull, bch);
 
     chrono.stop();
 
@@ -780,7 +816,7 @@ void HeartBidomainSolver<Mesh, SolverType>::PDEiterate ( bchandlerRaw_Type& bch
     }
 
     //! Solving the system
-    solveSystem ( matrFull, rhsFull );
+    solveSystem ( M_matrBC, rhsFull );
 
     //    M_residual  = M_rhsNoBC;
     //    M_residual -= *M_matrNoBC*M_solutionIntraExtraPotential;
@@ -815,7 +851,16 @@ void HeartBidomainSolver<Mesh, SolverType>::solveSystem ( matrixPtr_Type  matrFu
         {
             std::cout << "  f-  Computing the precond ...                ";
         }
-        M_prec->buildPreconditioner (matrFull);
+        // With the same pattern, the preconditioner can reuse its setup (e.g. the ML hierarchy)
+        if ( M_buildPreconditioner )
+        {
+            M_prec->buildPreconditioner (matrFull);
+            M_buildPreconditioner = false;
+        }
+        else
+        {
+            M_prec->recomputePreconditioner (matrFull);
+        }
 
         Real condest = M_prec->Condest();
 
@@ -0,0 +1,276 @@
+//@HEADER
+/*
+*******************************************************************************
+
+    Copyright (C) 2004, 2005, 2007 EPFL, Politecnico di Milano, INRIA
+    Copyright (C) 2010 EPFL, Politecnico di Milano, Emory University
+
+    This file is part of LifeV.
+
+    LifeV is free software; you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    LifeV is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with LifeV.  If not, see <http://www.gnu.org/licenses/>.
+
+*******************************************************************************
+*/
+//@HEADER
+
+/*!
+    @file
+    @brief PreconditionerBidomainBlock
+
+    @date 19-10-2026
+ */
+
+#include <vector>
+
+#include <lifev/heart/solver/PreconditionerBidomainBlock.hpp>
+#include <lifev/core/algorithm/PreconditionerIfpack.hpp>
+#include <lifev/core/algorithm/PreconditionerML.hpp>
+#include <lifev/core/array/VectorBlockStructure.hpp>
+#include <lifev/core/array/MatrixEpetraStructuredUtility.hpp>
+
+namespace LifeV
+{
+
+PreconditionerBidomainBlock::PreconditionerBidomainBlock ( boost::shared_ptr<Epetra_Comm> comm ) :
+    PreconditionerComposition ( comm ),
+    M_potentialMap            (),
+    M_fullMap                 (),
+    M_blockType               ( "LowerTriangular" ),
+    M_intraPreconditioner     (),
+    M_extraPreconditioner     (),
+    M_intraBlock              (),
+    M_extraBlock              (),
+    M_couplingBlock           ()
+{
+
+}
+
+PreconditionerBidomainBlock::~PreconditionerBidomainBlock()
+{
+
+}
+
+void
+PreconditionerBidomainBlock::createParametersList ( list_Type&         list,
+                                                    const GetPot&      dataFile,
+                                                    const std::string& section,
+                                                    const std::string& subsection )
+{
+    const bool verbose ( M_comm->MyPID() == 0 );
+
+    bool displayList = dataFile ( ( section + "/displayList" ).data(), false);
+
+    std::string precType = dataFile ( ( section + "/prectype" ).data(), "BidomainBlock" );
+    list.set ( "prectype", precType );
+
+    std::string blockType = dataFile ( ( section + "/" + subsection + "/block_type" ).data(), "LowerTriangular" );
+    list.set ( "block type", blockType );
+
+    // By default the preconditioners of the blocks read their data in the same section
+    std::string intraPrec = dataFile ( ( section + "/" + subsection + "/subprecs/intra_prec" ).data(), "ML" );
+    list.set ( "subprecs: intra prec", intraPrec );
+    std::string intraPrecDataSection = dataFile ( ( section + "/" + subsection + "/subprecs/intra_prec_data_section" ).data(), section.data() );
+    list.set ( "subprecs: intra prec data section", intraPrecDataSection );
+
+    std::string extraPrec = dataFile ( ( section + "/" + subsection + "/subprecs/extra_prec" ).data(), "ML" );
+    list.set ( "subprecs: extra prec", extraPrec );
+    std::string extraPrecDataSection = dataFile ( ( section + "/" + subsection + "/subprecs/extra_prec_data_section" ).data(), section.data() );
+    list.set ( "subprecs: extra prec data section", extraPrecDataSection );
+
+    if ( displayList && verbose )
+    {
+        std::cout << "BidomainBlock parameters list:" << std::endl;
+        std::cout << "-----------------------------" << std::endl;
+        list.print ( std::cout );
+        std::cout << "-----------------------------" << std::endl;
+    }
+}
+
+Real
+PreconditionerBidomainBlock::condest()
+{
+    return 0.0;
+}
+
+int
+PreconditionerBidomainBlock::buildPreconditioner ( matrixPtr_Type& oper )
+{
+    ASSERT ( M_potentialMap.get() != 0, "PreconditionerBidomainBlock: the map of the potentials must be set" );
+
+    // Make sure that the preconditioner is reset
+    this->resetPreconditioner();
+
+    M_intraPreconditioner.reset ( PRECFactory::instance().createObject ( M_intraPrec ) );
+    ASSERT ( M_intraPreconditioner.get() != 0, "PreconditionerBidomainBlock: intracellular preconditioner not set" );
+    M_intraPreconditioner->setDataFromGetPot ( M_dataFile, M_intraDataSection );
+
+    M_extraPreconditioner.reset ( PRECFactory::instance().createObject ( M_extraPrec ) );
+    ASSERT ( M_extraPreconditioner.get() != 0, "PreconditionerBidomainBlock: extracellular preconditioner not set" );
+    M_extraPreconditioner->setDataFromGetPot ( M_dataFile, M_extraDataSection );
+
+    buildBlocks ( oper );
+
+    M_intraPreconditioner->buildPreconditioner ( M_intraBlock );
+    M_extraPreconditioner->buildPreconditioner ( M_extraBlock );
+
+    composeBlocks();
+
+    return ( EXIT_SUCCESS );
+}
+
+int
+PreconditionerBidomainBlock::recomputePreconditioner ( matrixPtr_Type& oper )
+{
+    if ( !this->M_preconditionerCreated || !M_intraPreconditioner || !M_extraPreconditioner )
+    {
+        return buildPreconditioner ( oper );
+    }
+
+    buildBlocks ( oper );
+
+    M_intraPreconditioner->recomputePreconditioner ( M_intraBlock );
+    M_extraPreconditioner->recomputePreconditioner ( M_extraBlock );
+
+    // Only the composition is rebuilt, the preconditioners of the blocks are kept
+    PreconditionerComposition::resetPreconditioner();
+    composeBlocks();
+
+    return ( EXIT_SUCCESS );
+}
+
+void
+PreconditionerBidomainBlock::resetPreconditioner()
+{
+    PreconditionerComposition::resetPreconditioner();
+
+    M_intraPreconditioner.reset();
+    M_extraPreconditioner.reset();
+    M_intraBlock.reset();
+    M_extraBlock.reset();
+    M_couplingBlock.reset();
+}
+
+void
+PreconditionerBidomainBlock::buildBlocks ( const matrixPtr_Type& oper )
+{
+    const UInt potentialBlockSize ( M_potentialMap->mapSize() );
+    ASSERT ( oper->map().mapSize() == 2 * potentialBlockSize, "PreconditionerBidomainBlock: the matrix must contain two potentials" );
+
+    std::vector<UInt> blockNumRows ( 2, potentialBlockSize );
+    std::vector<UInt> blockNumColumns ( blockNumRows );
+
+    M_fullMap.reset ( new map_Type ( oper->map() ) );
+
+    /*
+     * Getting the block structure of A
+     * / Ai  C  \
+     * \ C   Ae /
+     */
+    matrixBlockView_Type Ai, C, Ae;
+    Ai.setup ( 0, 0, blockNumRows[0], blockNumColumns[0], oper.get() );
+    C.setup ( blockNumRows[0], 0, blockNumRows[1], blockNumColumns[0], oper.get() );
+    Ae.setup ( blockNumRows[0], blockNumColumns[0], blockNumRows[1], blockNumColumns[1], oper.get() );
+
+    // The diagonal blocks are stored on the map of a single potential
+    boost::shared_ptr<matrixBlock_Type> intraBlock;
+    boost::shared_ptr<matrixBlock_Type> extraBlock;
+    MatrixEpetraStructuredUtility::createMatrixFromBlock ( Ai, intraBlock, *M_potentialMap, true );
+    MatrixEpetraStructuredUtility::createMatrixFromBlock ( Ae, extraBlock, *M_potentialMap, true );
+    M_intraBlock = intraBlock;
+    M_extraBlock = extraBlock;
+
+    /*
+     * Building the block (the block is inversed)
+     * /  I  0 \
+     * \ -C  I /
+     */
+    if ( M_blockType == "LowerTriangular" )
+    {
+        matrixBlockView_Type B11, B21, B22;
+        boost::shared_ptr<matrixBlock_Type> couplingBlock ( new matrixBlock_Type ( *M_fullMap ) );
+        couplingBlock->setBlockStructure ( blockNumRows, blockNumColumns );
+        couplingBlock->blockView ( 0, 0, B11 );
+        couplingBlock->blockView ( 1, 0, B21 );
+        couplingBlock->blockView ( 1, 1, B22 );
+        MatrixEpetraStructuredUtility::copyBlock ( C, B21 );
+        ( *couplingBlock ) *= -1;
+        MatrixEpetraStructuredUtility::createIdentityBlock ( B11 );
+        MatrixEpetraStructuredUtility::createIdentityBlock ( B22 );
+        couplingBlock->globalAssemble();
+        M_couplingBlock = couplingBlock;
+    }
+    else
+    {
+        M_couplingBlock.reset();
+    }
+}
+
+void
+PreconditionerBidomainBlock::composeBlocks()
+{
+    const bool inversed ( true );
+    const bool notInversed ( false );
+    const bool notTransposed ( false );
+    const bool alreadyBuilt ( false );
+
+    VectorBlockStructure vectorStructure;
+    vectorStructure.setBlockStructure ( std::vector<UInt> ( 2, M_potentialMap->mapSize() ) );
+
+    /*
+     * Lower triangular:
+     * / Ai 0  \^-1   / I 0     \ / I  0 \ / Ai^-1 0 \
+     * \ C  Ae /    = \ 0 Ae^-1 / \ -C I / \ 0     I /
+     */
+    this->pushBack ( M_intraBlock, M_intraPreconditioner, vectorStructure, 0, *M_fullMap, notInversed, notTransposed, alreadyBuilt );
+    if ( M_couplingBlock )
+    {
+        this->pushBack ( M_couplingBlock, inversed, notTransposed );
+    }
+    this->pushBack ( M_extraBlock, M_extraPreconditioner, vectorStructure, 1, *M_fullMap, notInversed, notTransposed, alreadyBuilt );
+
+    this->M_preconditionerCreated = true;
+}
+
+void
+PreconditionerBidomainBlock::setDataFromGetPot ( const GetPot& dataFile,
+                                                 const std::string& section )
+{
+    M_dataFile   = dataFile;
+    this->createParametersList ( M_list, dataFile, section, "BidomainBlock" );
+    this->setParameters ( M_list );
+}
+
+void
+PreconditionerBidomainBlock::setParameters ( Teuchos::ParameterList& list )
+{
+    M_precType         = list.get ( "prectype", "BidomainBlock" );
+    M_blockType        = list.get ( "block type", "LowerTriangular" );
+
+    M_intraPrec        = list.get ( "subprecs: intra prec", "ML" );
+    M_intraDataSection = list.get ( "subprecs: intra prec data section", "" );
+
+    M_extraPrec        = list.get ( "subprecs: extra prec", "ML" );
+    M_extraDataSection = list.get ( "subprecs: extra prec data section", "" );
+
+    ASSERT ( M_blockType == "LowerTriangular" || M_blockType == "Diagonal",
+             "PreconditionerBidomainBlock: the block type must be LowerTriangular or Diagonal" );
+}
+
+void
+PreconditionerBidomainBlock::setPotentialMap ( const map_Type& potentialMap )
+{
+    M_potentialMap.reset ( new map_Type ( potentialMap ) );
+}
+
+} // namespace LifeV
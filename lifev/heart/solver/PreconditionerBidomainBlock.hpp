@@ -0,0 +1,199 @@
+//@HEADER
+/*
+*******************************************************************************
+
+    Copyright (C) 2004, 2005, 2007 EPFL, Politecnico di Milano, INRIA
+    Copyright (C) 2010 EPFL, Politecnico di Milano, Emory University
+
+    This file is part of LifeV.
+
+    LifeV is free software; you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    LifeV is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with LifeV.  If not, see <http://www.gnu.org/licenses/>.
+
+*******************************************************************************
+*/
+//@HEADER
+
+/*!
+    @file
+    @brief PreconditionerBidomainBlock
+
+    @date 19-10-2026
+ */
+
+#ifndef PRECONDITIONERBIDOMAINBLOCK_HPP
+#define PRECONDITIONERBIDOMAINBLOCK_HPP 1
+
+#include <string>
+
+#include <boost/shared_ptr.hpp>
+
+#include <Teuchos_ParameterList.hpp>
+
+#include <lifev/core/filter/GetPot.hpp>
+#include <lifev/core/array/MapEpetra.hpp>
+#include <lifev/core/array/MatrixEpetra.hpp>
+#include <lifev/core/array/MatrixEpetraStructured.hpp>
+#include <lifev/core/array/MatrixEpetraStructuredView.hpp>
+#include <lifev/core/algorithm/PreconditionerComposition.hpp>
+
+namespace LifeV
+{
+
+//! PreconditionerBidomainBlock
+/*!
+ *  The PreconditionerBidomainBlock class provides a block preconditioner for the
+ *  bidomain system in the intracellular and extracellular potentials
+ *
+ *  / Ki + alpha M    -alpha M     \
+ *  \   -alpha M     Ke + alpha M  /
+ *
+ *  The two diagonal blocks are preconditioned separately (typically with ML), on
+ *  matrices of the size of a single potential. With the "LowerTriangular" type the
+ *  extracellular block is corrected with the coupling block (block Gauss-Seidel),
+ *  with the "Diagonal" type the coupling is neglected (block Jacobi).
+ *
+ *  recomputePreconditioner() keeps the preconditioners of the diagonal blocks and
+ *  updates them with the new values: with the ML reuse option enabled, the
+ *  multigrid hierarchies are reused.
+ */
+class PreconditionerBidomainBlock:
+    public PreconditionerComposition
+{
+public:
+
+    /** @name Public Types
+     */
+    //@{
+    typedef MapEpetra                               map_Type;
+    typedef boost::shared_ptr<map_Type>             mapPtr_Type;
+    typedef MatrixEpetraStructured<Real>            matrixBlock_Type;
+    typedef MatrixEpetraStructuredView<Real>        matrixBlockView_Type;
+    typedef MatrixEpetra<Real>                      matrix_Type;
+    typedef boost::shared_ptr<matrix_Type>          matrixPtr_Type;
+
+    typedef Preconditioner                          super_Type;
+    typedef boost::shared_ptr<super_Type>           superPtr_Type;
+
+    typedef Teuchos::ParameterList                  list_Type;
+    //@}
+
+
+    //! @name Constructors, destructor
+    //@{
+    //! default constructor
+#ifdef HAVE_MPI
+    PreconditionerBidomainBlock ( boost::shared_ptr<Epetra_Comm> comm = boost::shared_ptr<Epetra_Comm> ( new Epetra_MpiComm ( MPI_COMM_WORLD ) ) );
+#else
+    PreconditionerBidomainBlock ( boost::shared_ptr<Epetra_Comm> comm = boost::shared_ptr<Epetra_Comm> ( new Epetra_SerialComm ) );
+#endif
+
+    //! default destructor
+    virtual ~PreconditionerBidomainBlock();
+
+    //@}
+
+    //! @name  Methods
+    //@{
+    void createParametersList ( list_Type&         list,
+                                const GetPot&      dataFile,
+                                const std::string& section,
+                                const std::string& subsection = "BidomainBlock" );
+
+    //! Return an estimation of the conditionement number of the preconditioner
+    double condest ();
+
+    //! Build the preconditioner
+    int buildPreconditioner ( matrixPtr_Type& A );
+
+    //! Update the preconditioner for a matrix with the same pattern and new values
+    /*!
+        The preconditioners of the diagonal blocks are recomputed instead of
+        being built again.
+        @param A the matrix with the new values
+     */
+    int recomputePreconditioner ( matrixPtr_Type& A );
+
+    //! Reset the preconditioner, including the preconditioners of the diagonal blocks
+    void resetPreconditioner();
+
+    //@}
+
+    //! @name  Set Methods
+    //@{
+    //! Setter using GetPot
+    /*!
+        This method use GetPot to load data from a file and then set
+        the preconditioner.
+        @param dataFile is a GetPot dataFile
+        @param section is the section containing the data
+     */
+    void setDataFromGetPot ( const GetPot&      dataFile,
+                             const std::string& section );
+
+    //! Method to setup the solver using Teuchos::ParameterList
+    /*!
+        @param list Teuchos::ParameterList object
+     */
+    virtual void setParameters ( Teuchos::ParameterList& list );
+
+    //! Setter for the map of a single potential
+    /*!
+        The intracellular potential occupies the first block of the
+        unknowns, the extracellular one the second block.
+        @param potentialMap map of the FESpace of one potential
+     */
+    void setPotentialMap ( const map_Type& potentialMap );
+
+    //@}
+
+protected:
+
+    //! Extract the diagonal blocks and the coupling factor from A
+    void buildBlocks ( const matrixPtr_Type& A );
+
+    //! Fill the composition with the blocks
+    void composeBlocks();
+
+    mapPtr_Type     M_potentialMap;
+    mapPtr_Type     M_fullMap;
+
+    std::string     M_blockType;
+
+    //! Data of the preconditioners of the diagonal blocks
+    GetPot          M_dataFile;
+    std::string     M_intraPrec;
+    std::string     M_intraDataSection;
+    std::string     M_extraPrec;
+    std::string     M_extraDataSection;
+
+    superPtr_Type   M_intraPreconditioner;
+    superPtr_Type   M_extraPreconditioner;
+
+    matrixPtr_Type  M_intraBlock;
+    matrixPtr_Type  M_extraBlock;
+    matrixPtr_Type  M_couplingBlock;
+};
+
+inline Preconditioner* createBidomainBlock()
+{
+    return new PreconditionerBidomainBlock();
+}
+namespace
+{
+static bool registerBidomainBlock = PRECFactory::instance().registerProduct ( "BidomainBlock", &createBidomainBlock );
+}
+
+} // namespace LifeV
+
+#endif /* PRECONDITIONERBIDOMAINBLOCK_HPP */
@@ -0,0 +1,245 @@
+//@HEADER
+/*
+*******************************************************************************
+
+    Copyright (C) 2004, 2005, 2007 EPFL, Politecnico di Milano, INRIA
+    Copyright (C) 2010 EPFL, Politecnico di Milano, Emory University
+
+    This file is part of LifeV.
+
+    LifeV is free software; you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    LifeV is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with LifeV.  If not, see <http://www.gnu.org/licenses/>.
+
+*******************************************************************************
+*/
+
+/*!
+    @file
+    @brief Test of the block preconditioner of the bidomain system
+
+    The bidomain system in the intracellular and extracellular potentials
+
+    / Ki + alpha M    -alpha M             \
+    \   -alpha M     Ke + (alpha + beta) M /
+
+    is solved with ML applied to the full matrix and with the BidomainBlock
+    preconditioner (lower triangular and diagonal), and the solutions are compared.
+    The small mass term beta M grounds the extracellular potential, which is
+    otherwise defined up to a constant.
+
+    @date 19-10-2026
+ */
+
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+
+#include <Epetra_ConfigDefs.h>
+#ifdef EPETRA_MPI
+#include <mpi.h>
+#include <Epetra_MpiComm.h>
+#else
+#include <Epetra_SerialComm.h>
+#endif
+
+#pragma GCC diagnostic warning "-Wunused-variable"
+#pragma GCC diagnostic warning "-Wunused-parameter"
+
+#include <cmath>
+
+#include <lifev/core/LifeV.hpp>
+
+#include <lifev/core/algorithm/PreconditionerIfpack.hpp>
+#include <lifev/core/algorithm/PreconditionerML.hpp>
+#include <lifev/core/algorithm/SolverAztecOO.hpp>
+
+#include <lifev/core/array/MapEpetra.hpp>
+#include <lifev/core/array/MatrixEpetra.hpp>
+#include <lifev/core/array/VectorEpetra.hpp>
+
+#include <lifev/core/fem/FESpace.hpp>
+#include <lifev/core/filter/GetPot.hpp>
+
+#include <lifev/core/mesh/MeshPartitioner.hpp>
+#include <lifev/core/mesh/RegionMesh3DStructured.hpp>
+#include <lifev/core/mesh/RegionMesh.hpp>
+
+#include <lifev/core/solver/ADRAssembler.hpp>
+
+#include <lifev/heart/solver/PreconditionerBidomainBlock.hpp>
+
+using namespace LifeV;
+
+namespace
+{
+static bool regIF = (PRECFactory::instance().registerProduct ( "Ifpack", &createIfpack ) );
+static bool regML = (PRECFactory::instance().registerProduct ( "ML", &createML ) );
+}
+
+typedef RegionMesh<LinearTetra>             mesh_Type;
+typedef MatrixEpetra<Real>                  matrix_Type;
+typedef boost::shared_ptr<matrix_Type>      matrixPtr_Type;
+typedef VectorEpetra                        vector_Type;
+typedef FESpace<mesh_Type, MapEpetra>       feSpace_Type;
+typedef boost::shared_ptr<feSpace_Type>     feSpacePtr_Type;
+
+// Solve the system with the preconditioner of the given section, as HeartBidomainSolver does
+Int solveBidomain ( const GetPot& dataFile,
+                    const std::string& section,
+                    const MapEpetra& potentialMap,
+                    matrixPtr_Type& systemMatrix,
+                    const vector_Type& rhs,
+                    vector_Type& solution,
+                    boost::shared_ptr<Epetra_Comm>& Comm )
+{
+    boost::shared_ptr<Preconditioner> prec ( PRECFactory::instance().createObject ( dataFile ( ( section + "/prectype" ).data(), "ML" ) ) );
+    prec->setDataFromGetPot ( dataFile, section );
+
+    PreconditionerBidomainBlock* blockPrec = dynamic_cast<PreconditionerBidomainBlock*> ( prec.get() );
+    if ( blockPrec )
+    {
+        blockPrec->setPotentialMap ( potentialMap );
+    }
+
+    SolverAztecOO linearSolver;
+    linearSolver.setCommunicator ( Comm );
+    linearSolver.setDataFromGetPot ( dataFile, "solver" );
+    linearSolver.setMatrix ( *systemMatrix );
+
+    prec->buildPreconditioner ( systemMatrix );
+    linearSolver.setPreconditioner ( prec );
+
+    solution *= 0.;
+    return linearSolver.solve ( solution, rhs );
+}
+
+// Relative difference between two solutions
+Real relativeDifference ( const vector_Type& reference, const vector_Type& solution )
+{
+    vector_Type difference ( reference );
+    difference -= solution;
+    return difference.normInf() / reference.normInf();
+}
+
+Real exactSolution ( const Real& /*t*/, const Real& x, const Real& y, const Real& z, const ID& /*i*/ )
+{
+    return std::sin ( 2. * x ) * std::cos ( y ) + z;
+}
+
+int main ( int argc, char** argv )
+{
+
+#ifdef HAVE_MPI
+    MPI_Init (&argc, &argv);
+    boost::shared_ptr<Epetra_Comm> Comm (new Epetra_MpiComm (MPI_COMM_WORLD) );
+#else
+    boost::shared_ptr<Epetra_Comm> Comm (new Epetra_SerialComm);
+#endif
+
+    const bool verbose (Comm->MyPID() == 0);
+
+    GetPot command_line (argc, argv);
+    const std::string dataFileName = command_line.follow ("data", 2, "-f", "--file");
+    GetPot dataFile (dataFileName);
+
+    const UInt nElements = dataFile ( "bidomain/nelements", 8 );
+    const Real sigmaI = dataFile ( "bidomain/sigma_i", 3.0 );
+    const Real sigmaE = dataFile ( "bidomain/sigma_e", 2.0 );
+    const Real alpha = dataFile ( "bidomain/alpha", 10.0 );
+    const Real beta = dataFile ( "bidomain/beta", 1.e-2 );
+
+    // Mesh
+    boost::shared_ptr< mesh_Type > fullMeshPtr ( new mesh_Type ( Comm ) );
+    regularMesh3D ( *fullMeshPtr, 1, nElements, nElements, nElements, false,
+                    1.0, 1.0, 1.0,
+                    0.0, 0.0, 0.0 );
+
+    boost::shared_ptr< mesh_Type > meshPtr;
+    {
+        MeshPartitioner< mesh_Type > meshPart ( fullMeshPtr, Comm );
+        meshPtr = meshPart.meshPartition();
+    }
+    fullMeshPtr.reset();
+
+    // Spaces of one potential and of the two potentials
+    feSpacePtr_Type uFESpace ( new feSpace_Type ( meshPtr, "P1", 1, Comm ) );
+    feSpacePtr_Type betaFESpace ( new feSpace_Type ( meshPtr, "P1", 3, Comm ) );
+    const UInt offset ( uFESpace->dof().numTotalDof() );
+    const MapEpetra fullMap ( uFESpace->map() + uFESpace->map() );
+
+    // Bidomain matrix
+    matrixPtr_Type systemMatrix ( new matrix_Type ( fullMap ) );
+    {
+        ADRAssembler<mesh_Type, matrix_Type, vector_Type> adrAssembler;
+        adrAssembler.setup ( uFESpace, betaFESpace );
+
+        adrAssembler.addDiffusion ( systemMatrix, sigmaI, 0, 0 );
+        adrAssembler.addMass ( systemMatrix, alpha, 0, 0 );
+        adrAssembler.addMass ( systemMatrix, -alpha, 0, offset );
+        adrAssembler.addMass ( systemMatrix, -alpha, offset, 0 );
+        adrAssembler.addDiffusion ( systemMatrix, sigmaE, offset, offset );
+        adrAssembler.addMass ( systemMatrix, alpha + beta, offset, offset );
+    }
+    systemMatrix->globalAssemble();
+
+    // Right hand side of a known solution
+    vector_Type potential ( uFESpace->map() );
+    uFESpace->interpolate ( static_cast<feSpace_Type::function_Type> ( exactSolution ), potential, 0.0 );
+    vector_Type exact ( fullMap );
+    exact.subset ( potential, uFESpace->map(), 0, 0 );
+    potential *= 0.5;
+    exact.subset ( potential, uFESpace->map(), 0, offset );
+
+    vector_Type rhs ( fullMap );
+    systemMatrix->multiply ( false, exact, rhs );
+
+    // Solutions
+    const Int maxIterations = dataFile ( "solver/max_iter", 200 );
+
+    vector_Type solutionML ( fullMap );
+    const Int iterationsML = solveBidomain ( dataFile, "prec_ml", uFESpace->map(), systemMatrix, rhs, solutionML, Comm );
+
+    vector_Type solutionLower ( fullMap );
+    const Int iterationsLower = solveBidomain ( dataFile, "prec_lower", uFESpace->map(), systemMatrix, rhs, solutionLower, Comm );
+
+    vector_Type solutionDiagonal ( fullMap );
+    const Int iterationsDiagonal = solveBidomain ( dataFile, "prec_diagonal", uFESpace->map(), systemMatrix, rhs, solutionDiagonal, Comm );
+
+    const Real errorML ( relativeDifference ( exact, solutionML ) );
+    const Real differenceLower ( relativeDifference ( solutionML, solutionLower ) );
+    const Real differenceDiagonal ( relativeDifference ( solutionML, solutionDiagonal ) );
+
+    if ( verbose )
+    {
+        std::cout << "ML on the full matrix: " << iterationsML << " iterations, relative error " << errorML << std::endl;
+        std::cout << "Lower triangular blocks: " << iterationsLower << " iterations, relative difference " << differenceLower << std::endl;
+        std::cout << "Diagonal blocks: " << iterationsDiagonal << " iterations, relative difference " << differenceDiagonal << std::endl;
+    }
+
+#ifdef HAVE_MPI
+    MPI_Finalize();
+#endif
+
+    const Real tolerance ( dataFile ( "bidomain/tolerance", 1.e-6 ) );
+    const bool converged ( iterationsML < maxIterations && iterationsLower < maxIterations && iterationsDiagonal < maxIterations );
+
+    if ( !converged || errorML > tolerance || differenceLower > tolerance || differenceDiagonal > tolerance )
+    {
+        return ( EXIT_FAILURE );
+    }
+
+    if (verbose)
+    {
+        std::cout << "End Result: TEST PASSED" << std::endl;
+    }
+    return ( EXIT_SUCCESS );
+}
@@ -64,6 +64,10 @@
 
 #include <vector>
 #include <limits>
+#include <queue>
+#include <algorithm>
+#include <functional>
+#include <cmath>
 
 #include <boost/shared_ptr.hpp>
 
@@ -107,9 +111,18 @@ namespace LifeV
 
   <b> Reinitialization </b>
 
-  In the moment, only direct reinitialization using geometric computations
-  of all the distances is available. This makes the choice of the element
-  used for the space discretization to be restricted to the P1.
+  Two reinitialization procedures are available, both based on the geometric
+  computation of the distances to the discrete interface. This makes the choice
+  of the element used for the space discretization to be restricted to the P1.
+
+  The direct reinitialization computes the distance of every node to every
+  face of the interface. The fast marching reinitialization computes the exact
+  distance only for the nodes of the elements crossed by the interface, using
+  a bucket grid over the local faces, and then propagates the closest
+  interface point to the other nodes in increasing distance order. The
+  processes only exchange the values of the nodes they share with their
+  neighbours, until none of them changes. Its cost is almost linear in the
+  number of nodes and it can be restricted to a band around the interface.
 
   <b> Usage </b>
 
@@ -145,17 +158,15 @@ namespace LifeV
   data_level_set->dataTime()->updateTime(); // Update the time in the data
   level_set.updateSystem(...);              // Update the linear system
   level_set.iterate();                      // Solve the system
-  level_set.reinitializationDirect();       // Reinitialize if needed
+  level_set.reinitializationFastMarching(); // Reinitialize if needed
   \endcode
 
 
   <b> Futur improvements </b>
 
-  The current reinitialization is quite primitive: it is
-  not very accurate, volume is not very well conserved
-  and the computational cost is far too high (it consists
-  more or less to a broadcast of the mesh...). Better
-  reinitialization procedures should be added.
+  The current reinitializations are quite primitive: they are
+  not very accurate and volume is not very well conserved.
+  Better reinitialization procedures should be added.
 
     @author Samuel Quinodoz
     @version 1.0
@@ -226,6 +237,21 @@ public:
     //! Reinitialization via direct geometrical computations
     void reinitializationDirect();
 
+    //! Reinitialization via closest point fast marching
+    /*!
+      The exact distance is computed only for the nodes of the local elements
+      crossed by the interface; it is then propagated to the other local nodes
+      in increasing order, carrying the closest interface point along. The
+      distances and closest points of the nodes shared with the neighbour
+      processes are exchanged, and the propagation is resumed, until no
+      process improves them.
+
+      @param bandWidth width of the band around the interface where the distance
+      is computed: outside, the level set is set to +/- bandWidth. A negative
+      value (default) means the whole domain.
+     */
+    void reinitializationFastMarching (const Real& bandWidth = -1.);
+
     //@}
 
     //! @name Set Methods
@@ -269,6 +295,36 @@ private:
     typedef std::vector<Real>       point_type;
     typedef std::vector<point_type> face_type;
 
+    // Uniform grid of buckets over the faces of the interface,
+    // stored as 9 coordinates per face
+    struct interfaceGrid_type
+    {
+        std::vector<Real> faces;
+        Real origin[3];
+        Real cellSize;
+        Int numCells[3];
+        std::vector<UInt> cellStart;
+        std::vector<UInt> cellFaces;
+    };
+
+    // Nodes shared with the neighbour processes. For each neighbour (in
+    // increasing rank), the nodes it owns that are stored here (ghosts) and
+    // the nodes owned here that it stores, listed in the same order on
+    // both sides.
+    struct sharedNodes_type
+    {
+        std::vector<int> ghostProcs;
+        std::vector<UInt> ghostStart;
+        std::vector<ID> ghostNodes;
+        std::vector<int> ownedProcs;
+        std::vector<UInt> ownedStart;
+        std::vector<ID> ownedNodes;
+    };
+
+    // Nodes to process in the fast marching, by increasing distance
+    typedef std::pair<Real, ID> heapItem_type;
+    typedef std::priority_queue<heapItem_type, std::vector<heapItem_type>, std::greater<heapItem_type> > heap_type;
+
 
     //! @name Private Methods
     //@{
@@ -276,6 +332,15 @@ private:
     void updateFacesNormalsRadius();
     Real computeUnsignedDistance (const std::vector< Real >& point);
     void cleanFacesData();
+    void flattenInterfaceFaces (std::vector<Real>& faces) const;
+    void buildInterfaceGrid (interfaceGrid_type& grid) const;
+    void buildSharedNodes (sharedNodes_type& shared) const;
+    UInt exchangeSharedNodes (const sharedNodes_type& shared, const Real& band,
+                              std::vector<Real>& distance, std::vector<point_type>& closest,
+                              heap_type& heap) const;
+    Real closestInterfacePoint (const interfaceGrid_type& grid, const point_type& point,
+                                const Real& maxDistance, point_type& closest) const;
+    Real closestPointOnFace (const Real* face, const point_type& point, point_type& closest) const;
     inline Real distanceBetweenPoints (const point_type& P1, const point_type& P2) const
     {
         return std::sqrt ( (P1[0] - P2[0]) * (P1[0] - P2[0]) + (P1[1] - P2[1]) * (P1[1] - P2[1]) + (P1[2] - P2[2]) * (P1[2] - P2[2]) );
@@ -657,6 +722,190 @@ reinitializationDirect()
 
 }
 
+template<typename mesh_type, typename solver_type>
+void
+LevelSetSolver<mesh_type, solver_type>::
+reinitializationFastMarching (const Real& bandWidth)
+{
+    const UInt nVertices (mesh_type::elementShape_Type::S_numVertices);
+    ASSERT (nVertices == 4, "Fast marching reinitialization is implemented for tetrahedra only");
+
+    const Real infinity (std::numeric_limits<Real>::max() );
+    const Real band (bandWidth < 0 ? infinity : bandWidth);
+
+    // Faces of the local part of the interface
+    interfaceGrid_type grid;
+    updateFacesNormalsRadius();
+    flattenInterfaceFaces (grid.faces);
+    cleanFacesData();
+
+    // All the processes take part in the exchanges: the decision is global
+    int localFaces (grid.faces.size() / 9);
+    int globalFaces (0);
+    M_fespace->map().comm().SumAll (&localFaces, &globalFaces, 1);
+    if (globalFaces == 0)
+    {
+        // No interface: nothing to reinitialize
+        return;
+    }
+
+    if (!grid.faces.empty() )
+    {
+        buildInterfaceGrid (grid);
+    }
+
+    vector_type repSol (M_solution, Repeated);
+
+    const UInt nPt (M_fespace->mesh()->storedPoints() );
+    const UInt nEl (M_fespace->mesh()->numElements() );
+
+    // Edges (for the adjacency of the nodes) and nodes of the elements
+    // crossed by the interface
+    std::vector< std::pair<ID, ID> > edges;
+    edges.reserve (nEl * nVertices * (nVertices - 1) );
+    std::vector<bool> isSeed (nPt, false);
+
+    for (UInt iter_el (0); iter_el < nEl; ++iter_el)
+    {
+        ID vertices[4];
+        Real values[4];
+        for (UInt iter_v (0); iter_v < nVertices; ++iter_v)
+        {
+            vertices[iter_v] = M_fespace->mesh()->element (iter_el).point (iter_v).localId();
+            values[iter_v] = repSol (M_fespace->mesh()->element (iter_el).point (iter_v).id() );
+        }
+
+        bool crossed (false);
+        for (UInt iter_v1 (0); iter_v1 < nVertices; ++iter_v1)
+        {
+            for (UInt iter_v2 (iter_v1 + 1); iter_v2 < nVertices; ++iter_v2)
+            {
+                edges.push_back (std::make_pair (vertices[iter_v1], vertices[iter_v2]) );
+                edges.push_back (std::make_pair (vertices[iter_v2], vertices[iter_v1]) );
+
+                // Same criterion as in updateFacesNormalsRadius
+                if ( (values[iter_v1] * values[iter_v2] <= 0) && ( (values[iter_v1] != 0) || (values[iter_v2] != 0) ) )
+                {
+                    crossed = true;
+                }
+            }
+        }
+
+        if (crossed)
+        {
+            for (UInt iter_v (0); iter_v < nVertices; ++iter_v)
+            {
+                isSeed[vertices[iter_v]] = true;
+            }
+        }
+    }
+
+    // Compressed adjacency of the nodes
+    std::sort (edges.begin(), edges.end() );
+    edges.erase (std::unique (edges.begin(), edges.end() ), edges.end() );
+
+    std::vector<UInt> neighborStart (nPt + 1, 0);
+    for (UInt iter_e (0); iter_e < edges.size(); ++iter_e)
+    {
+        ++neighborStart[edges[iter_e].first + 1];
+    }
+    for (UInt iter_pt (0); iter_pt < nPt; ++iter_pt)
+    {
+        neighborStart[iter_pt + 1] += neighborStart[iter_pt];
+    }
+
+    // Exact distances (to the local faces) for the seeds
+    std::vector<Real> distance (nPt, infinity);
+    std::vector<point_type> closest (nPt);
+    heap_type heap;
+
+    point_type coordinates (3, 0);
+    for (UInt iter_pt (0); iter_pt < nPt && !grid.faces.empty(); ++iter_pt)
+    {
+        if (isSeed[iter_pt])
+        {
+            coordinates[0] = M_fespace->mesh()->point (iter_pt).x();
+            coordinates[1] = M_fespace->mesh()->point (iter_pt).y();
+            coordinates[2] = M_fespace->mesh()->point (iter_pt).z();
+
+            point_type seedClosest (3, 0);
+            Real seedDistance (closestInterfacePoint (grid, coordinates, band, seedClosest) );
+            if (seedDistance < infinity)
+            {
+                distance[iter_pt] = seedDistance;
+                closest[iter_pt] = seedClosest;
+                heap.push (heapItem_type (seedDistance, iter_pt) );
+            }
+        }
+    }
+
+    sharedNodes_type shared;
+    buildSharedNodes (shared);
+
+    // Propagation in increasing distance order: a node takes the distance
+    // to the closest interface point of a neighbor. The shared nodes are
+    // then exchanged, and the propagation resumes from the nodes improved
+    // by the neighbour processes, until no process changes anything.
+    int globalChanged (0);
+    do
+    {
+        while (!heap.empty() )
+        {
+            const ID current (heap.top().second);
+            const Real currentDistance (heap.top().first);
+            heap.pop();
+
+            if (currentDistance > distance[current])
+            {
+                // Outdated entry
+                continue;
+            }
+
+            for (UInt iter_n (neighborStart[current]); iter_n < neighborStart[current + 1]; ++iter_n)
+            {
+                const ID neighbor (edges[iter_n].second);
+
+                coordinates[0] = M_fespace->mesh()->point (neighbor).x();
+                coordinates[1] = M_fespace->mesh()->point (neighbor).y();
+                coordinates[2] = M_fespace->mesh()->point (neighbor).z();
+
+                const Real candidate (distanceBetweenPoints (coordinates, closest[current]) );
+                if (candidate < distance[neighbor] && candidate <= band)
+                {
+                    distance[neighbor] = candidate;
+                    closest[neighbor] = closest[current];
+                    heap.push (heapItem_type (candidate, neighbor) );
+                }
+            }
+        }
+
+        int localChanged (exchangeSharedNodes (shared, band, distance, closest, heap) );
+        M_fespace->map().comm().SumAll (&localChanged, &globalChanged, 1);
+    }
+    while (globalChanged > 0);
+
+    // Post processing: also give the sign!
+    for (UInt iter_pt (0); iter_pt < nPt; ++iter_pt)
+    {
+        Real abs_dist (std::min (distance[iter_pt], band) );
+        if (abs_dist == infinity)
+        {
+            // Not reached (no band and no path to the interface)
+            continue;
+        }
+
+        ID my_id (M_fespace->mesh()->point (iter_pt).id() );
+        int sign (1);
+        if (repSol (my_id) < 0)
+        {
+            sign = -1;
+        };
+        repSol (my_id) = abs_dist * sign;
+    }
+
+    M_solution = vector_type (repSol, Unique, Zero);
+}
+
 // ===================================================
 // Private Methods
 // ===================================================
@@ -1060,6 +1309,445 @@ computeUnsignedDistance (const std::vector< Real >& point)
     return absdist;
 }
 
+template<typename mesh_type, typename solver_type>
+void
+LevelSetSolver<mesh_type, solver_type>::
+flattenInterfaceFaces (std::vector<Real>& faces) const
+{
+    // Local faces, 9 coordinates each
+    faces.clear();
+    faces.reserve (9 * M_faces.size() );
+    for (UInt iter_face (0); iter_face < M_faces.size(); ++iter_face)
+    {
+        for (UInt iter_vertex (0); iter_vertex < 3; ++iter_vertex)
+        {
+            faces.push_back (M_faces[iter_face][iter_vertex][0]);
+            faces.push_back (M_faces[iter_face][iter_vertex][1]);
+            faces.push_back (M_faces[iter_face][iter_vertex][2]);
+        }
+    }
+}
+
+template<typename mesh_type, typename solver_type>
+void
+LevelSetSolver<mesh_type, solver_type>::
+buildSharedNodes (sharedNodes_type& shared) const
+{
+    shared = sharedNodes_type();
+    shared.ghostStart.assign (1, 0);
+    shared.ownedStart.assign (1, 0);
+
+#ifdef EPETRA_MPI
+    const Epetra_MpiComm* my_comm = dynamic_cast<Epetra_MpiComm const*> (& (M_fespace->map().comm() ) );
+
+    if (my_comm == 0 || my_comm->NumProc() == 1)
+    {
+        return;
+    }
+
+    const int nb_proc (my_comm->NumProc() );
+    const Epetra_Map& uniqueMap (*M_fespace->map().map (Unique) );
+    const UInt nPt (M_fespace->mesh()->storedPoints() );
+
+    // Nodes of the repeated map owned by another process
+    std::vector<int> ghostGIDs;
+    std::vector<ID> ghostLocal;
+    for (UInt iter_pt (0); iter_pt < nPt; ++iter_pt)
+    {
+        const int gid (M_fespace->mesh()->point (iter_pt).id() );
+        if (!uniqueMap.MyGID (gid) )
+        {
+            ghostGIDs.push_back (gid);
+            ghostLocal.push_back (iter_pt);
+        }
+    }
+    const UInt nbGhosts (ghostGIDs.size() );
+
+    // Their owners (all the processes have to call RemoteIDList)
+    std::vector<int> owners (nbGhosts + 1, 0);
+    std::vector<int> ownerLIDs (nbGhosts + 1, 0);
+    ghostGIDs.push_back (0);
+    uniqueMap.RemoteIDList (nbGhosts, &ghostGIDs[0], &owners[0], &ownerLIDs[0]);
+
+    // Ghosts grouped by owner
+    std::vector< std::pair<int, UInt> > byOwner (nbGhosts);
+    for (UInt iter_g (0); iter_g < nbGhosts; ++iter_g)
+    {
+        byOwner[iter_g] = std::make_pair (owners[iter_g], iter_g);
+    }
+    std::sort (byOwner.begin(), byOwner.end() );
+
+    std::vector<int> sendGIDs (nbGhosts + 1, 0);
+    std::vector<int> sendCounts (nb_proc, 0);
+    shared.ghostNodes.resize (nbGhosts);
+    for (UInt iter_g (0); iter_g < nbGhosts; ++iter_g)
+    {
+        sendGIDs[iter_g] = ghostGIDs[byOwner[iter_g].second];
+        shared.ghostNodes[iter_g] = ghostLocal[byOwner[iter_g].second];
+        ++sendCounts[byOwner[iter_g].first];
+    }
+
+    // Each owner learns which of its nodes are stored by the others
+    std::vector<int> recvCounts (nb_proc, 0);
+    MPI_Alltoall (&sendCounts[0], 1, MPI_INT, &recvCounts[0], 1, MPI_INT, my_comm->Comm() );
+
+    for (int proc (0); proc < nb_proc; ++proc)
+    {
+        if (sendCounts[proc] > 0)
+        {
+            shared.ghostProcs.push_back (proc);
+            shared.ghostStart.push_back (shared.ghostStart.back() + sendCounts[proc]);
+        }
+        if (recvCounts[proc] > 0)
+        {
+            shared.ownedProcs.push_back (proc);
+            shared.ownedStart.push_back (shared.ownedStart.back() + recvCounts[proc]);
+        }
+    }
+
+    std::vector<int> recvGIDs (shared.ownedStart.back() + 1, 0);
+    std::vector<MPI_Request> requests (shared.ghostProcs.size() + shared.ownedProcs.size() );
+    UInt nbRequests (0);
+    for (UInt iter_p (0); iter_p < shared.ownedProcs.size(); ++iter_p)
+    {
+        MPI_Irecv (&recvGIDs[shared.ownedStart[iter_p]], shared.ownedStart[iter_p + 1] - shared.ownedStart[iter_p],
+                   MPI_INT, shared.ownedProcs[iter_p], 2, my_comm->Comm(), &requests[nbRequests++]);
+    }
+    for (UInt iter_p (0); iter_p < shared.ghostProcs.size(); ++iter_p)
+    {
+        MPI_Isend (&sendGIDs[shared.ghostStart[iter_p]], shared.ghostStart[iter_p + 1] - shared.ghostStart[iter_p],
+                   MPI_INT, shared.ghostProcs[iter_p], 2, my_comm->Comm(), &requests[nbRequests++]);
+    }
+    if (nbRequests > 0)
+    {
+        MPI_Waitall (nbRequests, &requests[0], MPI_STATUSES_IGNORE);
+    }
+
+    // Local index of the owned nodes
+    std::vector< std::pair<int, ID> > localIndex (nPt);
+    for (UInt iter_pt (0); iter_pt < nPt; ++iter_pt)
+    {
+        localIndex[iter_pt] = std::make_pair (static_cast<int> (M_fespace->mesh()->point (iter_pt).id() ), iter_pt);
+    }
+    std::sort (localIndex.begin(), localIndex.end() );
+
+    shared.ownedNodes.resize (shared.ownedStart.back() );
+    for (UInt iter_o (0); iter_o < shared.ownedNodes.size(); ++iter_o)
+    {
+        std::vector< std::pair<int, ID> >::const_iterator position =
+            std::lower_bound (localIndex.begin(), localIndex.end(), std::make_pair (recvGIDs[iter_o], ID (0) ) );
+        ASSERT (position != localIndex.end() && position->first == recvGIDs[iter_o], "Shared node not found in the local mesh");
+        shared.ownedNodes[iter_o] = position->second;
+    }
+#endif
+}
+
+template<typename mesh_type, typename solver_type>
+UInt
+LevelSetSolver<mesh_type, solver_type>::
+exchangeSharedNodes (const sharedNodes_type& shared, const Real& band,
+                     std::vector<Real>& distance, std::vector<point_type>& closest,
+                     heap_type& heap) const
+{
+    UInt changed (0);
+
+#ifdef EPETRA_MPI
+    const Epetra_MpiComm* my_comm = dynamic_cast<Epetra_MpiComm const*> (& (M_fespace->map().comm() ) );
+
+    if (my_comm == 0)
+    {
+        return 0;
+    }
+
+    // First the owners collect the values of their nodes stored by the
+    // neighbours, then they send the best values back: 4 values per node,
+    // the distance and the closest interface point
+    for (UInt step (0); step < 2; ++step)
+    {
+        const std::vector<int>& sendProcs (step == 0 ? shared.ghostProcs : shared.ownedProcs);
+        const std::vector<UInt>& sendStart (step == 0 ? shared.ghostStart : shared.ownedStart);
+        const std::vector<ID>& sendNodes (step == 0 ? shared.ghostNodes : shared.ownedNodes);
+        const std::vector<int>& recvProcs (step == 0 ? shared.ownedProcs : shared.ghostProcs);
+        const std::vector<UInt>& recvStart (step == 0 ? shared.ownedStart : shared.ghostStart);
+        const std::vector<ID>& recvNodes (step == 0 ? shared.ownedNodes : shared.ghostNodes);
+
+        std::vector<Real> sendBuffer (4 * sendNodes.size() + 1, 0);
+        for (UInt iter_n (0); iter_n < sendNodes.size(); ++iter_n)
+        {
+            const ID node (sendNodes[iter_n]);
+            sendBuffer[4 * iter_n] = distance[node];
+            if (!closest[node].empty() )
+            {
+                std::copy (closest[node].begin(), closest[node].end(), &sendBuffer[4 * iter_n + 1]);
+            }
+        }
+        std::vector<Real> recvBuffer (4 * recvNodes.size() + 1, 0);
+
+        std::vector<MPI_Request> requests (sendProcs.size() + recvProcs.size() );
+        UInt nbRequests (0);
+        for (UInt iter_p (0); iter_p < recvProcs.size(); ++iter_p)
+        {
+            MPI_Irecv (&recvBuffer[4 * recvStart[iter_p]], 4 * (recvStart[iter_p + 1] - recvStart[iter_p]),
+                       MPI_DOUBLE, recvProcs[iter_p], 3, my_comm->Comm(), &requests[nbRequests++]);
+        }
+        for (UInt iter_p (0); iter_p < sendProcs.size(); ++iter_p)
+        {
+            MPI_Isend (&sendBuffer[4 * sendStart[iter_p]], 4 * (sendStart[iter_p + 1] - sendStart[iter_p]),
+                       MPI_DOUBLE, sendProcs[iter_p], 3, my_comm->Comm(), &requests[nbRequests++]);
+        }
+        if (nbRequests > 0)
+        {
+            MPI_Waitall (nbRequests, &requests[0], MPI_STATUSES_IGNORE);
+        }
+
+        for (UInt iter_n (0); iter_n < recvNodes.size(); ++iter_n)
+        {
+            const ID node (recvNodes[iter_n]);
+            const Real receivedDistance (recvBuffer[4 * iter_n]);
+            if (receivedDistance < distance[node] && receivedDistance <= band)
+            {
+                distance[node] = receivedDistance;
+                closest[node].assign (&recvBuffer[4 * iter_n + 1], &recvBuffer[4 * iter_n + 4]);
+                heap.push (heapItem_type (receivedDistance, node) );
+                ++changed;
+            }
+        }
+    }
+#endif
+
+    return changed;
+}
+
+template<typename mesh_type, typename solver_type>
+void
+LevelSetSolver<mesh_type, solver_type>::
+buildInterfaceGrid (interfaceGrid_type& grid) const
+{
+    const UInt nbFaces (grid.faces.size() / 9);
+
+    // Bounding box and mean size of the faces
+    Real lower[3] = { grid.faces[0], grid.faces[1], grid.faces[2] };
+    Real upper[3] = { grid.faces[0], grid.faces[1], grid.faces[2] };
+    Real meanSize (0);
+
+    for (UInt iter_face (0); iter_face < nbFaces; ++iter_face)
+    {
+        const Real* face (&grid.faces[9 * iter_face]);
+        for (UInt iter_vertex (0); iter_vertex < 3; ++iter_vertex)
+        {
+            for (UInt d (0); d < 3; ++d)
+            {
+                lower[d] = std::min (lower[d], face[3 * iter_vertex + d]);
+                upper[d] = std::max (upper[d], face[3 * iter_vertex + d]);
+            }
+        }
+        for (UInt d (0); d < 3; ++d)
+        {
+            meanSize += std::max (std::abs (face[d] - face[3 + d]), std::abs (face[d] - face[6 + d]) );
+        }
+    }
+    meanSize /= 3 * nbFaces;
+
+    // Cells of the size of the faces, but not many more cells than faces
+    Real volume (1);
+    for (UInt d (0); d < 3; ++d)
+    {
+        volume *= upper[d] - lower[d] + meanSize;
+    }
+    grid.cellSize = std::max (meanSize, std::pow (volume / (8 * nbFaces), 1. / 3.) );
+    if (grid.cellSize <= 0)
+    {
+        grid.cellSize = 1;
+    }
+
+    UInt nbCells (1);
+    for (UInt d (0); d < 3; ++d)
+    {
+        grid.origin[d] = lower[d];
+        grid.numCells[d] = static_cast<Int> ( (upper[d] - lower[d]) / grid.cellSize) + 1;
+        nbCells *= grid.numCells[d];
+    }
+
+    // Compressed storage of the faces in the cells touched by their bounding box
+    grid.cellStart.assign (nbCells + 1, 0);
+    for (UInt pass (0); pass < 2; ++pass)
+    {
+        if (pass == 1)
+        {
+            for (UInt iter_cell (0); iter_cell < nbCells; ++iter_cell)
+            {
+                grid.cellStart[iter_cell + 1] += grid.cellStart[iter_cell];
+            }
+            grid.cellFaces.resize (grid.cellStart[nbCells]);
+        }
+        std::vector<UInt> position (grid.cellStart.begin(), grid.cellStart.end() - 1);
+
+        for (UInt iter_face (0); iter_face < nbFaces; ++iter_face)
+        {
+            const Real* face (&grid.faces[9 * iter_face]);
+            Int first[3], last[3];
+            for (UInt d (0); d < 3; ++d)
+            {
+                Real faceLower (std::min (face[d], std::min (face[3 + d], face[6 + d]) ) );
+                Real faceUpper (std::max (face[d], std::max (face[3 + d], face[6 + d]) ) );
+                first[d] = std::min (static_cast<Int> ( (faceLower - grid.origin[d]) / grid.cellSize), grid.numCells[d] - 1);
+                last[d] = std::min (static_cast<Int> ( (faceUpper - grid.origin[d]) / grid.cellSize), grid.numCells[d] - 1);
+            }
+
+            for (Int i (first[0]); i <= last[0]; ++i)
+                for (Int j (first[1]); j <= last[1]; ++j)
+                    for (Int k (first[2]); k <= last[2]; ++k)
+                    {
+                        const UInt cell ( (i * grid.numCells[1] + j) * grid.numCells[2] + k);
+                        if (pass == 0)
+                        {
+                            ++grid.cellStart[cell + 1];
+                        }
+                        else
+                        {
+                            grid.cellFaces[position[cell]++] = iter_face;
+                        }
+                    }
+        }
+    }
+}
+
+template<typename mesh_type, typename solver_type>
+Real
+LevelSetSolver<mesh_type, solver_type>::
+closestInterfacePoint (const interfaceGrid_type& grid, const point_type& point,
+                       const Real& maxDistance, point_type& closest) const
+{
+    // The cells are visited ring by ring around the cell of the point
+    // (projected on the grid). The faces in the ring r are at least at
+    // distance (r-1)*cellSize, so we can stop as soon as the closest face
+    // found is closer than that.
+
+    Real absdist (maxDistance);
+    bool found (false);
+
+    Int center[3];
+    Int maxRing (0);
+    for (UInt d (0); d < 3; ++d)
+    {
+        center[d] = static_cast<Int> (std::floor ( (point[d] - grid.origin[d]) / grid.cellSize) );
+        center[d] = std::max (0, std::min (center[d], grid.numCells[d] - 1) );
+        maxRing = std::max (maxRing, std::max (center[d], grid.numCells[d] - 1 - center[d]) );
+    }
+
+    point_type current_closest (3, 0);
+    for (Int ring (0); ring <= maxRing; ++ring)
+    {
+        if (ring > 0 && absdist <= (ring - 1) * grid.cellSize)
+        {
+            break;
+        }
+
+        for (Int i (std::max (0, center[0] - ring) ); i <= std::min (grid.numCells[0] - 1, center[0] + ring); ++i)
+            for (Int j (std::max (0, center[1] - ring) ); j <= std::min (grid.numCells[1] - 1, center[1] + ring); ++j)
+                for (Int k (std::max (0, center[2] - ring) ); k <= std::min (grid.numCells[2] - 1, center[2] + ring); ++k)
+                {
+                    if (std::max (std::abs (i - center[0]), std::max (std::abs (j - center[1]), std::abs (k - center[2]) ) ) != ring)
+                    {
+                        continue;
+                    }
+
+                    const UInt cell ( (i * grid.numCells[1] + j) * grid.numCells[2] + k);
+                    for (UInt iter (grid.cellStart[cell]); iter < grid.cellStart[cell + 1]; ++iter)
+                    {
+                        Real current_dist (closestPointOnFace (&grid.faces[9 * grid.cellFaces[iter]], point, current_closest) );
+                        if (current_dist <= absdist)
+                        {
+                            absdist = current_dist;
+                            closest = current_closest;
+                            found = true;
+                        }
+                    }
+                }
+    }
+
+    return found ? absdist : std::numeric_limits<Real>::max();
+}
+
+template<typename mesh_type, typename solver_type>
+Real
+LevelSetSolver<mesh_type, solver_type>::
+closestPointOnFace (const Real* face, const point_type& point, point_type& closest) const
+{
+    // Classification of the point in the Voronoi regions of the
+    // vertices, edges and interior of the face
+
+    const Real* a (face);
+    const Real* b (face + 3);
+    const Real* c (face + 6);
+
+    Real ab[3], ac[3], ap[3], bp[3], cp[3];
+    for (UInt d (0); d < 3; ++d)
+    {
+        ab[d] = b[d] - a[d];
+        ac[d] = c[d] - a[d];
+        ap[d] = point[d] - a[d];
+        bp[d] = point[d] - b[d];
+        cp[d] = point[d] - c[d];
+    }
+
+    const Real d1 (ab[0] * ap[0] + ab[1] * ap[1] + ab[2] * ap[2]);
+    const Real d2 (ac[0] * ap[0] + ac[1] * ap[1] + ac[2] * ap[2]);
+    const Real d3 (ab[0] * bp[0] + ab[1] * bp[1] + ab[2] * bp[2]);
+    const Real d4 (ac[0] * bp[0] + ac[1] * bp[1] + ac[2] * bp[2]);
+    const Real d5 (ab[0] * cp[0] + ab[1] * cp[1] + ab[2] * cp[2]);
+    const Real d6 (ac[0] * cp[0] + ac[1] * cp[1] + ac[2] * cp[2]);
+
+    const Real va (d3 * d6 - d5 * d4);
+    const Real vb (d5 * d2 - d1 * d6);
+    const Real vc (d1 * d4 - d3 * d2);
+
+    if (d1 <= 0 && d2 <= 0)
+    {
+        closest.assign (a, a + 3);
+    }
+    else if (d3 >= 0 && d4 <= d3)
+    {
+        closest.assign (b, b + 3);
+    }
+    else if (vc <= 0 && d1 >= 0 && d3 <= 0)
+    {
+        const Real v (d1 / (d1 - d3) );
+        closest[0] = a[0] + v * ab[0];
+        closest[1] = a[1] + v * ab[1];
+        closest[2] = a[2] + v * ab[2];
+    }
+    else if (d6 >= 0 && d5 <= d6)
+    {
+        closest.assign (c, c + 3);
+    }
+    else if (vb <= 0 && d2 >= 0 && d6 <= 0)
+    {
+        const Real w (d2 / (d2 - d6) );
+        closest[0] = a[0] + w * ac[0];
+        closest[1] = a[1] + w * ac[1];
+        closest[2] = a[2] + w * ac[2];
+    }
+    else if (va <= 0 && (d4 - d3) >= 0 && (d5 - d6) >= 0)
+    {
+        const Real w ( (d4 - d3) / ( (d4 - d3) + (d5 - d6) ) );
+        closest[0] = b[0] + w * (c[0] - b[0]);
+        closest[1] = b[1] + w * (c[1] - b[1]);
+        closest[2] = b[2] + w * (c[2] - b[2]);
+    }
+    else
+    {
+        const Real denominator (va + vb + vc);
+        const Real v (denominator != 0 ? vb / denominator : 0);
+        const Real w (denominator != 0 ? vc / denominator : 0);
+        closest[0] = a[0] + v * ab[0] + w * ac[0];
+        closest[1] = a[1] + v * ab[1] + w * ac[1];
+        closest[2] = a[2] + v * ab[2] + w * ac[2];
+    }
+
+    return distanceBetweenPoints (point, closest);
+}
+
 template<typename mesh_type, typename solver_type>
 void
 LevelSetSolver<mesh_type, solver_type>::
@@ -0,0 +1,177 @@
+//@HEADER
+/*
+*******************************************************************************
+
+    Copyright (C) 2004, 2005, 2007 EPFL, Politecnico di Milano, INRIA
+    Copyright (C) 2010 EPFL, Politecnico di Milano, Emory University
+
+    This file is part of LifeV.
+
+    LifeV is free software; you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    LifeV is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with LifeV.  If not, see <http://www.gnu.org/licenses/>.
+
+*******************************************************************************
+*/
+//@HEADER
+
+/*!
+    @file
+    @brief Fast marching reinitialization of the level set against the direct one
+
+    The level set of a sphere, scaled so that it is not a distance function,
+    is reinitialized with LevelSetSolver::reinitializationDirect and with
+    LevelSetSolver::reinitializationFastMarching, on the whole domain and in a
+    band around the interface. The signed distances must agree up to the
+    tolerance of the data file (the fast marching only computes the exact
+    distance near the interface).
+
+    @date 19-10-2026
+ */
+
+
+#include <Epetra_ConfigDefs.h>
+#ifdef EPETRA_MPI
+#include <mpi.h>
+#include <Epetra_MpiComm.h>
+#else
+#include <Epetra_SerialComm.h>
+#endif
+
+
+#include <lifev/core/LifeV.hpp>
+
+#include <lifev/core/mesh/MeshPartitioner.hpp>
+#include <lifev/core/mesh/RegionMesh3DStructured.hpp>
+#include <lifev/core/mesh/RegionMesh.hpp>
+
+#include <lifev/core/mesh/MeshData.hpp>
+
+#include <lifev/level_set/solver/LevelSetSolver.hpp>
+
+using namespace LifeV;
+
+Real initLSFct ( const Real& /* t */, const Real& x, const Real& y, const Real& z, const ID& /* i */)
+{
+    // Sphere of radius 0.5, not a distance function
+    return  3.0 * ( (x - 0.1) * (x - 0.1) + y * y + z * z - 0.25 );
+}
+
+typedef RegionMesh<LinearTetra> mesh_Type;
+typedef VectorEpetra vector_Type;
+typedef FESpace< mesh_Type, MapEpetra > feSpace_Type;
+
+int
+main ( int argc, char** argv )
+{
+
+#ifdef HAVE_MPI
+    MPI_Init (&argc, &argv);
+    boost::shared_ptr<Epetra_Comm> Comm (new Epetra_MpiComm (MPI_COMM_WORLD) );
+#else
+    boost::shared_ptr<Epetra_Comm> Comm (new Epetra_SerialComm);
+#endif
+
+    const bool verbose (Comm->MyPID() == 0);
+
+    GetPot dataFile ( "data" );
+
+    const UInt Nelements (dataFile ("mesh/nelements", 20) );
+    const Real tolerance (dataFile ("reinitialization/tolerance", 0.05) );
+    const Real bandWidth (dataFile ("reinitialization/band_width", 0.3) );
+
+    // Build and partition the mesh
+
+    boost::shared_ptr< mesh_Type > fullMeshPtr ( new RegionMesh<LinearTetra> ( Comm ) );
+    regularMesh3D ( *fullMeshPtr, 1, Nelements, Nelements, Nelements, false,
+                    2.0,   2.0,   2.0,
+                    -1.0,  -1.0,  -1.0);
+
+    boost::shared_ptr< mesh_Type > localMeshPtr;
+    {
+        MeshPartitioner< mesh_Type >   meshPart (fullMeshPtr, Comm);
+        localMeshPtr = meshPart.meshPartition();
+    }
+    fullMeshPtr.reset();
+
+    boost::shared_ptr<feSpace_Type> uFESpace ( new feSpace_Type (localMeshPtr, "P1", 1, Comm) );
+    boost::shared_ptr<feSpace_Type> betaFESpace ( new feSpace_Type (localMeshPtr, "P1", 3, Comm) );
+
+    boost::shared_ptr<DataLevelSet> data_level_set (new DataLevelSet);
+    data_level_set->setup (dataFile, "level-set");
+
+    vector_Type initLS (uFESpace->map() );
+    uFESpace->interpolate ( static_cast<feSpace_Type::function_Type> ( initLSFct ), initLS, 0.0 );
+
+    // Reference: direct reinitialization
+
+    LevelSetSolver<mesh_Type> directLS (uFESpace, betaFESpace);
+    directLS.setup (data_level_set);
+    directLS.initialize (initLS);
+    directLS.reinitializationDirect();
+
+    // Fast marching on the whole domain and in a band
+
+    LevelSetSolver<mesh_Type> fastMarchingLS (uFESpace, betaFESpace);
+    fastMarchingLS.setup (data_level_set);
+    fastMarchingLS.initialize (initLS);
+    fastMarchingLS.reinitializationFastMarching();
+
+    LevelSetSolver<mesh_Type> bandLS (uFESpace, betaFESpace);
+    bandLS.setup (data_level_set);
+    bandLS.initialize (initLS);
+    bandLS.reinitializationFastMarching (bandWidth);
+
+    vector_Type error (fastMarchingLS.solution() );
+    error -= directLS.solution();
+    const Real fullError (error.normInf() );
+
+    // In the band, the distances agree; outside, the level set is +/- bandWidth
+    vector_Type bandReference (directLS.solution(), Repeated);
+    vector_Type bandSolution (bandLS.solution(), Repeated);
+    Real localBandError (0);
+    for (UInt iter_pt (0); iter_pt < localMeshPtr->storedPoints(); ++iter_pt)
+    {
+        const ID id (localMeshPtr->point (iter_pt).id() );
+        const Real reference (bandReference (id) );
+        Real expected (reference);
+        if (std::abs (reference) > bandWidth)
+        {
+            expected = reference > 0 ? bandWidth : -bandWidth;
+        }
+        localBandError = std::max (localBandError, std::abs (bandSolution (id) - expected) );
+    }
+    Real bandError (0);
+    Comm->MaxAll (&localBandError, &bandError, 1);
+
+    if (verbose)
+    {
+        std::cout << " Fast marching error (whole domain) : " << fullError << std::endl;
+        std::cout << " Fast marching error (band)         : " << bandError << std::endl;
+    }
+
+    if ( (fullError > tolerance) || (bandError > tolerance) )
+    {
+        return (EXIT_FAILURE);
+    }
+
+    if (verbose)
+    {
+        std::cout << "End Result: TEST PASSED" << std::endl;
+    }
+
+#ifdef HAVE_MPI
+    MPI_Finalize();
+#endif
+
+    return ( EXIT_SUCCESS );
+}
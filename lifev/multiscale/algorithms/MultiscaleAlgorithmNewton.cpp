@@ -47,7 +47,13 @@ namespace Multiscale
 MultiscaleAlgorithmNewton::MultiscaleAlgorithmNewton() :
     multiscaleAlgorithm_Type   (),
     M_solver                   (),
-    M_jacobian                 ()
+    M_jacobian                 (),
+    M_jacobianReuse            ( false ),
+    M_broydenUpdate            ( true ),
+    M_stagnationRatio          ( 0.5 ),
+    M_exactJacobianNumber      ( 0 ),
+    M_reusedJacobianNumber     ( 0 ),
+    M_couplingsJacobianTime    ()
 {
 
 #ifdef HAVE_LIFEV_DEBUG
@@ -102,10 +108,40 @@ MultiscaleAlgorithmNewton::subIterate()
     multiscaleVectorPtr_Type delta ( new multiscaleVector_Type ( *M_couplingResiduals, Unique ) );
     *delta = 0.0;
 
+    // Residuals of the previous sub-iteration (for the Broyden update)
+    multiscaleVector_Type previousResiduals ( *M_couplingResiduals, Unique );
+
+    bool exactJacobian ( !M_jacobianReuse || M_jacobian.get() == 0 || M_multiscale->topologyChange() );
     for ( UInt subIT (1); subIT <= M_subiterationsMaximumNumber; ++subIT )
     {
+        if ( M_jacobianReuse && subIT > 1 )
+        {
+            // Stagnation: go back to the exact Jacobian
+            if ( M_couplingResiduals->norm2() > M_stagnationRatio * previousResiduals.norm2() )
+            {
+                exactJacobian = true;
+            }
+            else if ( M_broydenUpdate )
+            {
+                broydenJacobianUpdate ( *delta, previousResiduals );
+            }
+        }
+
         // Compute the Jacobian
-        assembleJacobianMatrix();
+        if ( exactJacobian )
+        {
+            assembleJacobianMatrix();
+            exactJacobian = !M_jacobianReuse;
+        }
+        else
+        {
+            ++M_reusedJacobianNumber;
+        }
+
+        if ( M_jacobianReuse )
+        {
+            previousResiduals = *M_couplingResiduals;
+        }
 
         // Set matrix and RHS
         M_solver.setOperator ( M_jacobian );
@@ -126,6 +162,10 @@ MultiscaleAlgorithmNewton::subIterate()
         // Verify tolerance
         if ( checkResidual ( subIT ) )
         {
+            if ( M_jacobianReuse )
+            {
+                showJacobianStatistics();
+            }
             return;
         }
     }
@@ -136,6 +176,43 @@ MultiscaleAlgorithmNewton::subIterate()
                            " (required: " + number2string ( M_tolerance ) + ")\n", M_multiscale->communicator() == 0 );
 }
 
+void
+MultiscaleAlgorithmNewton::showMe()
+{
+    if ( M_comm->MyPID() == 0 )
+    {
+        multiscaleAlgorithm_Type::showMe();
+
+        std::cout << "Jacobian reuse                       = " << M_jacobianReuse << std::endl;
+        std::cout << "Broyden update                       = " << M_broydenUpdate << std::endl;
+        std::cout << "Stagnation ratio                     = " << M_stagnationRatio << std::endl;
+        std::cout << std::endl << std::endl;
+    }
+}
+
+// ===================================================
+// Set Methods
+// ===================================================
+void
+MultiscaleAlgorithmNewton::setAlgorithmParameters ( const multiscaleParameterList_Type& parameterList )
+{
+    multiscaleAlgorithm_Type::setAlgorithmParameters ( parameterList );
+
+    // Optional parameters: by default the exact Jacobian is computed at each sub-iteration
+    if ( parameterList.isParameter ( "Jacobian reuse" ) )
+    {
+        M_jacobianReuse = parameterList.get<bool> ( "Jacobian reuse" );
+    }
+    if ( parameterList.isParameter ( "Jacobian update" ) )
+    {
+        M_broydenUpdate = ( parameterList.get<std::string> ( "Jacobian update" ) == "Broyden" );
+    }
+    if ( parameterList.isParameter ( "Stagnation ratio" ) )
+    {
+        M_stagnationRatio = parameterList.get<Real> ( "Stagnation ratio" );
+    }
+}
+
 // ===================================================
 // Private Methods
 // ===================================================
@@ -144,11 +221,52 @@ MultiscaleAlgorithmNewton::assembleJacobianMatrix()
 {
     // Compute the Jacobian matrix (we completely delete the previous matrix)
     M_jacobian.reset ( new multiscaleMatrix_Type ( M_couplingVariables->map(), 50 ) );
-    M_multiscale->exportJacobian ( *M_jacobian );
+    M_multiscale->exportJacobian ( *M_jacobian, M_couplingsJacobianTime );
     M_jacobian->globalAssemble();
 
+    ++M_exactJacobianNumber;
+
     //M_jacobian->spy( multiscaleProblemFolder + multiscaleProblemPrefix + "_AlgorithmJacobianNewtonExported" + "_" + number2string( multiscaleProblemStep ) + "_" + number2string( M_multiscale->globalData()->dataTime()->timeStepNumber() ) );
 }
 
+void
+MultiscaleAlgorithmNewton::broydenJacobianUpdate ( const multiscaleVector_Type& delta, const multiscaleVector_Type& previousResiduals )
+{
+    // Good Broyden update: J += ( dR - J * delta ) * delta^T / ( delta^T * delta )
+    multiscaleVector_Type jacobianDelta ( delta, Unique );
+    M_jacobian->multiply ( false, delta, jacobianDelta );
+
+    multiscaleVector_Type correction ( *M_couplingResiduals, Unique );
+    correction -= previousResiduals;
+    correction -= jacobianDelta;
+    correction /= delta.dot ( delta );
+
+    M_jacobian->openCrsMatrix();
+    M_jacobian->addDyadicProduct ( correction, delta );
+    M_jacobian->globalAssemble();
+}
+
+void
+MultiscaleAlgorithmNewton::showJacobianStatistics() const
+{
+    if ( M_comm->MyPID() != 0 || M_exactJacobianNumber == 0 )
+    {
+        return;
+    }
+
+    std::cout << " MS-  Exact Jacobian evaluations:              " << M_exactJacobianNumber
+              << " (reused " << M_reusedJacobianNumber << " times)" << std::endl;
+
+    // Estimated time saved: number of reuses times the mean cost of the exact Jacobian
+    const multiscaleCouplingsContainer_Type& couplingsList ( M_multiscale->couplingsList() );
+    UInt couplingIndex ( 0 );
+    for ( multiscaleCouplingsContainerConstIterator_Type i = couplingsList.begin(); i != couplingsList.end() && couplingIndex < M_couplingsJacobianTime.size(); ++i, ++couplingIndex )
+    {
+        const Real meanTime ( M_couplingsJacobianTime[couplingIndex] / M_exactJacobianNumber );
+        std::cout << " MS-  Coupling " << ( *i )->ID() << " (" << ( *i )->couplingName() << "): Jacobian "
+                  << meanTime << " s, saved " << meanTime * M_reusedJacobianNumber << " s" << std::endl;
+    }
+}
+
 } // Namespace Multiscale
 } // Namespace LifeV
@@ -56,6 +56,14 @@ namespace Multiscale
  *
  *  The MultiscaleAlgorithmNewton is an implementation of multiscaleAlgorithm_Type
  *  which implements the Newton method.
+ *
+ *  Computing the exact Jacobian requires, for each coupling, the solution of a tangent
+ *  problem for each coupling variable. If "Jacobian reuse" is enabled, the exact Jacobian is
+ *  computed only at the first time step, after a topology change, and when the algorithm
+ *  stagnates (the residual is not reduced at least by the factor "Stagnation ratio").
+ *  Otherwise the Jacobian of the previous iterations (and time steps) is reused, with
+ *  a rank-one Broyden correction at each sub-iteration if "Jacobian update" is "Broyden".
+ *  The time saved by each coupling is estimated from the measured cost of its exact Jacobian.
  */
 class MultiscaleAlgorithmNewton : public virtual multiscaleAlgorithm_Type
 {
@@ -85,6 +93,21 @@ public:
     //! Perform sub-iteration on the coupling variables
     void subIterate();
 
+    //! Display some information about the algorithm
+    void showMe();
+
+    //@}
+
+
+    //! @name Set Methods
+    //@{
+
+    //! Set the the main parameters of the algorithm (tolerance, maximum number of subiterations, etc.)
+    /*!
+     * @param parameterList teuchos list of parameters
+     */
+    void setAlgorithmParameters ( const multiscaleParameterList_Type& parameterList );
+
     //@}
 
 private:
@@ -104,10 +127,23 @@ private:
 
     void assembleJacobianMatrix();
 
+    void broydenJacobianUpdate ( const multiscaleVector_Type& delta, const multiscaleVector_Type& previousResiduals );
+
+    //! Display the number of exact Jacobian evaluations and the estimated time saved by each coupling
+    void showJacobianStatistics() const;
+
     //@}
 
     LinearSolver                             M_solver;
     multiscaleMatrixPtr_Type                 M_jacobian;
+
+    bool                                     M_jacobianReuse;
+    bool                                     M_broydenUpdate;
+    Real                                     M_stagnationRatio;
+
+    UInt                                     M_exactJacobianNumber;
+    UInt                                     M_reusedJacobianNumber;
+    std::vector< Real >                      M_couplingsJacobianTime;
 };
 
 //! Factory create function
@@ -49,9 +49,12 @@ MultiscaleCommunicatorsManager::MultiscaleCommunicatorsManager() :
     M_commContainer      (),
     M_serialModelsID     (),
     M_serialProcesses    (),
+    M_serialModelsSolveTime (),
     M_parallelModelsID   (),
     M_parallelModelsLoad (),
-    M_parallelProcesses  ()
+    M_parallelProcesses  (),
+    M_parallelModelsSolveTime (),
+    M_parallelModelsBalancedLoad ()
 {
 
 #ifdef HAVE_LIFEV_DEBUG
@@ -80,27 +83,6 @@ MultiscaleCommunicatorsManager::splitCommunicator()
     MPI_Group commGroup;
     MPI_Comm_group ( comm, &commGroup );
 
-    // Serial models: assign processes number to the models
-    M_serialProcesses.resize ( M_serialModelsID.size(), std::vector< Int > ( 1, 0 ) );
-    for ( Int i (0) ; i < static_cast <Int> ( M_serialProcesses.size() ) ; ++i )
-    {
-        M_serialProcesses[i][0] = i % numberOfProcesses;
-    }
-
-    // Serial models: create communicators
-    Int serialMembers[1] = { myPID };
-    MPI_Group serialCommGroup;
-    MPI_Group_incl ( commGroup, 1, serialMembers, &serialCommGroup );
-
-    MPI_Comm serialComm;
-    MPI_Comm_create ( comm, serialCommGroup, &serialComm );
-
-    for ( Int i (0) ; i < static_cast <Int> ( M_serialProcesses.size() ) ; ++i )
-        if ( M_serialProcesses[i][0] == myPID )
-        {
-            M_commContainer[M_serialModelsID[i]].reset ( new Epetra_MpiComm ( serialComm ) );
-        }
-
     // Parallel models: identify number of processes per model
     std::vector<Real> localNumberOfProcesses ( M_parallelModelsID.size(), 0 );
     parallelProcessesDistribution ( localNumberOfProcesses, numberOfProcesses );
@@ -139,6 +121,43 @@ MultiscaleCommunicatorsManager::splitCommunicator()
             M_commContainer[M_parallelModelsID[i]].reset ( new Epetra_MpiComm ( localParallelComm ) );
         }
     }
+
+    // Serial models: assign processes number to the models.
+    // The serial models are placed on the processes left free by the parallel models, so that all the
+    // groups solve their models concurrently. If there are no free processes, they are placed starting
+    // from the last process, which belongs to the cheapest parallel model.
+    Int parallelProcessesNumber ( 0 );
+    for ( UInt i (0) ; i < M_parallelProcesses.size() ; ++i )
+    {
+        parallelProcessesNumber += M_parallelProcesses[i].size();
+    }
+
+    M_serialProcesses.resize ( M_serialModelsID.size(), std::vector< Int > ( 1, 0 ) );
+    for ( Int i (0) ; i < static_cast <Int> ( M_serialProcesses.size() ) ; ++i )
+    {
+        if ( parallelProcessesNumber < numberOfProcesses )
+        {
+            M_serialProcesses[i][0] = parallelProcessesNumber + i % ( numberOfProcesses - parallelProcessesNumber );
+        }
+        else
+        {
+            M_serialProcesses[i][0] = numberOfProcesses - 1 - i % numberOfProcesses;
+        }
+    }
+
+    // Serial models: create communicators
+    Int serialMembers[1] = { myPID };
+    MPI_Group serialCommGroup;
+    MPI_Group_incl ( commGroup, 1, serialMembers, &serialCommGroup );
+
+    MPI_Comm serialComm;
+    MPI_Comm_create ( comm, serialCommGroup, &serialComm );
+
+    for ( Int i (0) ; i < static_cast <Int> ( M_serialProcesses.size() ) ; ++i )
+        if ( M_serialProcesses[i][0] == myPID )
+        {
+            M_commContainer[M_serialModelsID[i]].reset ( new Epetra_MpiComm ( serialComm ) );
+        }
 }
 
 bool
@@ -154,6 +173,55 @@ MultiscaleCommunicatorsManager::myModel ( const UInt& modelID ) const
     }
 }
 
+void
+MultiscaleCommunicatorsManager::balanceLoads ( const std::map< UInt, Real >& modelsSolveTime )
+{
+
+#ifdef HAVE_LIFEV_DEBUG
+    debugStream ( 8005 ) << "MultiscaleCommunicatorsManager::balanceLoads() \n";
+#endif
+
+    // Gather the solve time of all the models (the time of a model is the maximum among its processes)
+    std::vector<Real> localTime ( M_serialModelsID.size() + M_parallelModelsID.size(), 0 );
+    std::vector<Real> globalTime ( localTime.size(), 0 );
+
+    std::map< UInt, Real >::const_iterator timeIterator;
+    for ( UInt i (0) ; i < M_serialModelsID.size() ; ++i )
+        if ( ( timeIterator = modelsSolveTime.find ( M_serialModelsID[i] ) ) != modelsSolveTime.end() )
+        {
+            localTime[i] = timeIterator->second;
+        }
+    for ( UInt i (0) ; i < M_parallelModelsID.size() ; ++i )
+        if ( ( timeIterator = modelsSolveTime.find ( M_parallelModelsID[i] ) ) != modelsSolveTime.end() )
+        {
+            localTime[M_serialModelsID.size() + i] = timeIterator->second;
+        }
+
+    if ( localTime.size() > 0 )
+    {
+        M_comm->MaxAll ( &localTime[0], &globalTime[0], localTime.size() );
+    }
+
+    M_serialModelsSolveTime.assign ( globalTime.begin(), globalTime.begin() + M_serialModelsID.size() );
+    M_parallelModelsSolveTime.assign ( globalTime.begin() + M_serialModelsID.size(), globalTime.end() );
+
+    // Redistribute the total load of the parallel models proportionally to their work
+    Real totalLoad (0);
+    Real totalWork (0);
+    for ( UInt i (0) ; i < M_parallelModelsID.size() ; ++i )
+    {
+        totalLoad += M_parallelModelsLoad[i];
+        totalWork += M_parallelModelsSolveTime[i] * M_parallelProcesses[i].size();
+    }
+
+    M_parallelModelsBalancedLoad = M_parallelModelsLoad;
+    if ( totalWork > 0 )
+        for ( UInt i (0) ; i < M_parallelModelsID.size() ; ++i )
+        {
+            M_parallelModelsBalancedLoad[i] = totalLoad * M_parallelModelsSolveTime[i] * M_parallelProcesses[i].size() / totalWork;
+        }
+}
+
 void
 MultiscaleCommunicatorsManager::showMe()
 {
@@ -189,6 +257,30 @@ MultiscaleCommunicatorsManager::showMe()
     }
 }
 
+void
+MultiscaleCommunicatorsManager::showLoads()
+{
+    if ( M_comm->MyPID() == 0 )
+    {
+        Real maxTime (0);
+        for ( UInt i ( 0 ) ; i < M_serialModelsID.size() ; ++i )
+        {
+            std::cout << "Model " << M_serialModelsID[i]
+                      << ", process " << M_serialProcesses[i][0]
+                      << ", solve time " << M_serialModelsSolveTime[i] << " s" << std::endl;
+        }
+        for ( UInt i ( 0 ) ; i < M_parallelModelsID.size() ; ++i )
+        {
+            std::cout << "Model " << M_parallelModelsID[i]
+                      << ", load " << M_parallelModelsLoad[i]
+                      << "%, solve time " << M_parallelModelsSolveTime[i]
+                      << " s, balanced load " << M_parallelModelsBalancedLoad[i] << "%" << std::endl;
+            maxTime = std::max ( maxTime, M_parallelModelsSolveTime[i] );
+        }
+        std::cout << "Maximum parallel models solve time = " << maxTime << " s" << std::endl << std::endl;
+    }
+}
+
 // ===================================================
 // Set Methods
 // ===================================================
@@ -106,9 +106,25 @@ public:
         return M_commContainer.size();
     }
 
+    //! Compute the loads of the parallel models which balance the measured solve times
+    /*!
+     * The work of each parallel model is estimated as its solve time multiplied by the number
+     * of its processes. The total load of the parallel models is then redistributed
+     * proportionally to this work, so that all the groups take the same wall time to solve
+     * their models. The balanced loads can be used in the Problem/mpiGroups section of the
+     * data file of the next simulation.
+     * This method must be called by all the processes of the main communicator.
+     *
+     * @param modelsSolveTime solve time of the models owned by the process, indexed by model ID.
+     */
+    void balanceLoads ( const std::map< UInt, Real >& modelsSolveTime );
+
     //! Display some information about the communicators
     void showMe();
 
+    //! Display the measured solve times and the balanced loads (call after balanceLoads)
+    void showLoads();
+
     //@}
 
 
@@ -149,6 +165,15 @@ public:
         return M_commContainer.find ( modelID )->second;
     }
 
+    //! Get the balanced loads of the parallel models
+    /*!
+     * @return balanced loads, sorted as the parallel models (empty if balanceLoads has not been called).
+     */
+    const modelsLoad_Type& balancedLoads() const
+    {
+        return M_parallelModelsBalancedLoad;
+    }
+
     //@}
 
 private:
@@ -192,11 +217,14 @@ private:
     // Serial models data
     modelsID_Type                       M_serialModelsID;
     modelsProcessesList_Type            M_serialProcesses;
+    modelsLoad_Type                     M_serialModelsSolveTime;
 
     // Parallel models data
     modelsID_Type                       M_parallelModelsID;
     modelsLoad_Type                     M_parallelModelsLoad;
     modelsProcessesList_Type            M_parallelProcesses;
+    modelsLoad_Type                     M_parallelModelsSolveTime;
+    modelsLoad_Type                     M_parallelModelsBalancedLoad;
 };
 
 } // Namespace multiscale
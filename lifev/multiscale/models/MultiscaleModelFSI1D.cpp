@@ -153,6 +153,7 @@ MultiscaleModelFSI1D::setupData ( const std::string& fileName )
     M_solver->setProblem ( M_physics, M_flux, M_source );
     M_solver->setLinearSolver ( M_linearSolver );
     M_solver->setLinearViscoelasticSolver ( M_linearViscoelasticSolver );
+    M_solver->setTridiagonalSolver ( dataFile ( "1D_Model/solver/tridiagonal", true ) );
 
     //BC - We need to create the BCHandler before using it
     M_bc->createHandler();
@@ -207,11 +208,11 @@ MultiscaleModelFSI1D::setupModel()
     MapEpetra map ( -1, myGlobalElements.size(), &myGlobalElements[0], M_comm );
     M_solver->setupSolution ( *M_exporterSolution, map, true );
 
-    M_exporter->addVariable ( IOData_Type::ScalarField, "Area ratio (fluid)", M_feSpace, (*M_exporterSolution) ["AoverA0minus1"], static_cast <UInt> ( 0 ) );
-    M_exporter->addVariable ( IOData_Type::ScalarField, "Flow rate (fluid)",  M_feSpace, (*M_exporterSolution) ["Q"],    static_cast <UInt> ( 0 ) );
-    //M_exporter->addVariable( IOData_Type::ScalarField, "W1",               M_feSpace, (*M_exporterSolution)["W1"],   static_cast <UInt> ( 0 ), M_feSpace->dof().numTotalDof() );
-    //M_exporter->addVariable( IOData_Type::ScalarField, "W2",               M_feSpace, (*M_exporterSolution)["W2"],   static_cast <UInt> ( 0 ), M_feSpace->dof().numTotalDof() );
-    M_exporter->addVariable ( IOData_Type::ScalarField, "Pressure (fluid)",   M_feSpace, (*M_exporterSolution) ["P"],    static_cast <UInt> ( 0 ) );
+    M_exporter->addVariable ( IOData_Type::ScalarField, "Area ratio (fluid)", M_feSpace, (*M_exporterSolution) [OneDFSI::AreaRatio], static_cast <UInt> ( 0 ) );
+    M_exporter->addVariable ( IOData_Type::ScalarField, "Flow rate (fluid)",  M_feSpace, (*M_exporterSolution) [OneDFSI::FlowRate],    static_cast <UInt> ( 0 ) );
+    //M_exporter->addVariable( IOData_Type::ScalarField, "W1",               M_feSpace, (*M_exporterSolution) [OneDFSI::RiemannW1],   static_cast <UInt> ( 0 ), M_feSpace->dof().numTotalDof() );
+    //M_exporter->addVariable( IOData_Type::ScalarField, "W2",               M_feSpace, (*M_exporterSolution) [OneDFSI::RiemannW2],   static_cast <UInt> ( 0 ), M_feSpace->dof().numTotalDof() );
+    M_exporter->addVariable ( IOData_Type::ScalarField, "Pressure (fluid)",   M_feSpace, (*M_exporterSolution) [OneDFSI::Pressure],    static_cast <UInt> ( 0 ) );
 #endif
 
 #ifdef HAVE_MATLAB_POSTPROCESSING
@@ -356,7 +357,7 @@ MultiscaleModelFSI1D::showMe()
 Real
 MultiscaleModelFSI1D::checkSolution() const
 {
-    return (*M_solution) ["AoverA0minus1"]->norm2() + (*M_solution) ["Q"]->norm2() + (*M_solution) ["P"]->norm2();
+    return (*M_solution) [OneDFSI::AreaRatio]->norm2() + (*M_solution) [OneDFSI::FlowRate]->norm2() + (*M_solution) [OneDFSI::Pressure]->norm2();
 }
 
 // ===================================================
@@ -550,11 +551,11 @@ MultiscaleModelFSI1D::initializeSolution()
 #ifdef HAVE_HDF5
         M_importer->setMeshProcId ( M_exporterMesh, M_comm->MyPID() );
 
-        M_importer->addVariable ( IOData_Type::ScalarField, "Area ratio (fluid)", M_feSpace, (*M_exporterSolution) ["AoverA0minus1"], static_cast <UInt> ( 0 ) );
-        M_importer->addVariable ( IOData_Type::ScalarField, "Flow rate (fluid)",  M_feSpace, (*M_exporterSolution) ["Q"],      static_cast <UInt> ( 0 ) );
-        //        M_importer->addVariable( IOData_Type::ScalarField, "W1",               M_feSpace, (*M_exporterSolution)["W1"],     static_cast <UInt> ( 0 ), M_feSpace->dof().numTotalDof() );
-        //        M_importer->addVariable( IOData_Type::ScalarField, "W2",               M_feSpace, (*M_exporterSolution)["W2"],     static_cast <UInt> ( 0 ), M_feSpace->dof().numTotalDof() );
-        M_importer->addVariable ( IOData_Type::ScalarField, "Pressure (fluid)",   M_feSpace, (*M_exporterSolution) ["P"],      static_cast <UInt> ( 0 ) );
+        M_importer->addVariable ( IOData_Type::ScalarField, "Area ratio (fluid)", M_feSpace, (*M_exporterSolution) [OneDFSI::AreaRatio], static_cast <UInt> ( 0 ) );
+        M_importer->addVariable ( IOData_Type::ScalarField, "Flow rate (fluid)",  M_feSpace, (*M_exporterSolution) [OneDFSI::FlowRate],      static_cast <UInt> ( 0 ) );
+        //        M_importer->addVariable( IOData_Type::ScalarField, "W1",               M_feSpace, (*M_exporterSolution) [OneDFSI::RiemannW1],     static_cast <UInt> ( 0 ), M_feSpace->dof().numTotalDof() );
+        //        M_importer->addVariable( IOData_Type::ScalarField, "W2",               M_feSpace, (*M_exporterSolution) [OneDFSI::RiemannW2],     static_cast <UInt> ( 0 ), M_feSpace->dof().numTotalDof() );
+        M_importer->addVariable ( IOData_Type::ScalarField, "Pressure (fluid)",   M_feSpace, (*M_exporterSolution) [OneDFSI::Pressure],      static_cast <UInt> ( 0 ) );
 
         // Import
         M_exporter->setTimeIndex ( M_importer->importFromTime ( M_data->dataTime()->initialTime() ) + 1 );
@@ -574,7 +575,7 @@ MultiscaleModelFSI1D::initializeSolution()
         M_solver->computeW1W2 ( *M_solution );
 
         // Initialize area in physics for viscoelastic computation
-        M_physics->setArea_tn ( * (*M_solution) ["A"] );
+        M_physics->setArea_tn ( * (*M_solution) [OneDFSI::Area] );
     }
     else
     {
@@ -634,10 +635,10 @@ MultiscaleModelFSI1D::copySolution ( const solution_Type& solution1, solution_Ty
     debugStream ( 8130 ) << "MultiscaleModelFSI1D::copySolution( solution1, solution2 ) \n";
 #endif
 
-    for ( solutionConstIterator_Type i = solution2.begin() ; i != solution2.end() ; ++i )
-        if ( solution1.find ( i->first ) != solution1.end() )
+    for ( UInt i (0) ; i < OneDFSI::solutionQuantitiesNumber ; ++i )
+        if ( solution1[i] && solution2[i] )
         {
-            *solution2[i->first] = *solution1.find (i->first)->second;
+            *solution2[i] = *solution1[i];
         }
 }
 
@@ -682,7 +683,7 @@ MultiscaleModelFSI1D::solve ( bc_Type& bc, solution_Type& solution, const std::s
     for ( UInt i (1) ; i <= subiterationNumber ; ++i )
     {
         updateBCPhysicalSolverVariables();
-        M_physics->setArea_tn ( *solution["A"] );
+        M_physics->setArea_tn ( *solution[OneDFSI::Area] );
         M_solver->updateRHS ( solution, timeStep );
         M_solver->iterate ( bc, solution, M_data->dataTime()->previousTime() + i * timeStep, timeStep );
     }
@@ -1028,7 +1029,7 @@ MultiscaleModelFSI1D::solveTangentProblem ( solver_Type::vector_Type& rhs, const
         for ( UInt iNode (0); iNode < M_physics->data()->numberOfNodes() ; ++iNode )
         {
             flowRateDelta[iNode] = 1.;
-            flowRateViscoelasticCorrection += M_solver->viscoelasticFluxCorrection ( * (*M_solution) ["A"], flowRateDelta, M_data->dataTime()->timeStep(), *M_bc->handler(), false ) * flowRateElasticCorrection[iNode];
+            flowRateViscoelasticCorrection += M_solver->viscoelasticFluxCorrection ( * (*M_solution) [OneDFSI::Area], flowRateDelta, M_data->dataTime()->timeStep(), *M_bc->handler(), false ) * flowRateElasticCorrection[iNode];
             flowRateDelta[iNode] = 0.;
         }
 
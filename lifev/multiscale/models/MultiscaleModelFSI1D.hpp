@@ -421,6 +421,16 @@ public:
      * @return 1D model solution.
      */
     const vectorPtr_Type& solution ( const std::string& quantity) const
+    {
+        return (*M_solution) [OneDFSI::solutionQuantity ( quantity )];
+    }
+
+    //! Get the solution container of the 1D model for a given quantity
+    /*!
+     * @param quantity solution quantity.
+     * @return 1D model solution.
+     */
+    const vectorPtr_Type& solution ( const OneDFSI::solutionQuantity_Type& quantity ) const
     {
         return (*M_solution) [quantity];
     }
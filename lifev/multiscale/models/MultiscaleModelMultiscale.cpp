@@ -64,6 +64,8 @@ MultiscaleModelMultiscale::MultiscaleModelMultiscale() :
     M_commManager              (),
     M_modelsList               (),
     M_couplingsList            (),
+    M_modelsCommID             (),
+    M_modelsSolveTime          (),
     M_algorithm                ()
 {
 
@@ -168,6 +170,8 @@ MultiscaleModelMultiscale::setupData ( const std::string& fileName )
     // Load Models
     std::string path = dataFile ( "Problem/modelsPath", "./" );
     M_modelsList.resize ( M_commManager.myModelsNumber() );
+    M_modelsCommID.resize ( M_commManager.myModelsNumber() );
+    M_modelsSolveTime.assign ( M_commManager.myModelsNumber(), 0. );
     for ( UInt fileModelsLine ( 0 ); fileModelsLine < modelsLinesNumber; ++fileModelsLine )
     {
         fileID = dataFile ( "Problem/models", 0, fileModelsLine * modelsColumnsNumber );
@@ -207,6 +211,7 @@ MultiscaleModelMultiscale::setupData ( const std::string& fileName )
 
             M_modelsList[myIDCounter] = multiscaleModelPtr_Type ( multiscaleModelFactory_Type::instance().createObject ( model, multiscaleModelsMap ) );
             M_modelsList[myIDCounter]->setID ( fileModelsLine + 1 );
+            M_modelsCommID[myIDCounter] = fileID;
             M_modelsList[myIDCounter]->setCommunicator ( M_commManager.modelCommunicator ( fileID ) );
             M_modelsList[myIDCounter]->setGeometry ( geometryScale, geometryRotate, geometryTranslate );
             M_modelsList[myIDCounter]->setGlobalData ( M_globalData );
@@ -375,6 +380,24 @@ MultiscaleModelMultiscale::saveSolution()
         ( *i )->saveSolution();
     }
 
+    // Balance the loads of the communicators using the measured solve times
+    if ( M_globalData->dataTime()->isLastTimeStep() )
+    {
+        std::map< UInt, Real > modelsSolveTime;
+        for ( UInt i ( 0 ); i < M_modelsList.size(); ++i )
+        {
+            modelsSolveTime[M_modelsCommID[i]] = M_modelsSolveTime[i];
+        }
+
+        M_commManager.balanceLoads ( modelsSolveTime );
+
+        if ( M_comm->MyPID() == 0 )
+        {
+            std::cout << "=================== Communicators Loads =====================" << std::endl << std::endl;
+        }
+        M_commManager.showLoads();
+    }
+
     // Save the framework numbering
     if ( M_globalData->dataTime()->isFirstTimeStep() )
     {
@@ -527,10 +550,17 @@ MultiscaleModelMultiscale::computeCouplingResiduals()
     debugStream ( 8110 ) << "MultiscaleModelMultiscale::computeCouplingResiduals() \n";
 #endif
 
+    // Each process solves only the models of its groups: the models of different groups are solved
+    // concurrently and synchronize only when the coupling residuals are computed.
     displayModelStatus ( "Solve" );
-    for ( multiscaleModelsContainerConstIterator_Type i = M_modelsList.begin(); i != M_modelsList.end(); ++i )
+    LifeChrono modelChrono;
+    for ( UInt i ( 0 ); i < M_modelsList.size(); ++i )
     {
-        ( *i )->solveModel();
+        modelChrono.start();
+        M_modelsList[i]->solveModel();
+        modelChrono.stop();
+
+        M_modelsSolveTime[i] += modelChrono.diff();
     }
 
     //    for ( multiscaleModelsContainerConstIterator_Type i = M_modelsList.begin(); i != M_modelsList.end(); ++i )
@@ -579,6 +609,28 @@ MultiscaleModelMultiscale::exportJacobian ( multiscaleMatrix_Type& jacobian )
     }
 }
 
+void
+MultiscaleModelMultiscale::exportJacobian ( multiscaleMatrix_Type& jacobian, std::vector< Real >& couplingsTime )
+{
+
+#ifdef HAVE_LIFEV_DEBUG
+    debugStream ( 8110 ) << "MultiscaleModelMultiscale::exportJacobian( jacobian, couplingsTime ) \n";
+#endif
+
+    couplingsTime.resize ( M_couplingsList.size(), 0. );
+
+    LifeChrono couplingChrono;
+    UInt couplingIndex ( 0 );
+    for ( multiscaleCouplingsContainerConstIterator_Type i = M_couplingsList.begin(); i != M_couplingsList.end(); ++i, ++couplingIndex )
+    {
+        couplingChrono.start();
+        ( *i )->exportJacobian ( jacobian );
+        couplingChrono.stop();
+
+        couplingsTime[couplingIndex] += couplingChrono.diff();
+    }
+}
+
 bool
 MultiscaleModelMultiscale::topologyChange()
 {
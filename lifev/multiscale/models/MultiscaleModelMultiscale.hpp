@@ -161,6 +161,13 @@ public:
      */
     void exportJacobian ( multiscaleMatrix_Type& jacobian );
 
+    //! Export the Jacobian matrix measuring the cost of each coupling
+    /*!
+     * @param jacobian Matrix
+     * @param couplingsTime the time spent by each coupling is added to the corresponding entry
+     */
+    void exportJacobian ( multiscaleMatrix_Type& jacobian, std::vector< Real >& couplingsTime );
+
     //! Check if the topology is changed
     /*!
      * A topology change can be caused by a change in the coupling equations by,
@@ -181,6 +188,15 @@ public:
      */
     UInt couplingVariablesNumber();
 
+    //! Get the list of the couplings
+    /*!
+     * @return list of the couplings
+     */
+    const multiscaleCouplingsContainer_Type& couplingsList() const
+    {
+        return M_couplingsList;
+    }
+
     //@}
 
 private:
@@ -201,6 +217,10 @@ private:
     multiscaleModelsContainer_Type     M_modelsList;
     multiscaleCouplingsContainer_Type  M_couplingsList;
 
+    // Communicator ID and cumulated solve time of the models
+    multiscaleIDContainer_Type         M_modelsCommID;
+    std::vector< Real >                M_modelsSolveTime;
+
     // Algorithm for subiterations
     multiscaleAlgorithmPtr_Type        M_algorithm;
 };
@@ -73,8 +73,8 @@ OneDFSIBC::applyBC ( const Real& time, const Real& timeStep, const solution_Type
     ( M_bcSide == OneDFSI::left ) ? iNode = 0 : iNode = fluxPtr->physics()->data()->numberOfNodes() - 1;
 
     container2D_Type boundaryU;
-    boundaryU[0] = (*solution.find ("A")->second) (iNode);
-    boundaryU[1] = (*solution.find ("Q")->second) (iNode);
+    boundaryU[0] = (*solution[OneDFSI::Area]) (iNode);
+    boundaryU[1] = (*solution[OneDFSI::FlowRate]) (iNode);
 
     // Eigenvalues and eigenvectors of the jacobian diffFlux (= dF/dU = H)
     container2D_Type eigenvalues;
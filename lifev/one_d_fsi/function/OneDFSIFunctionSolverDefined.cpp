@@ -133,10 +133,10 @@ OneDFSIFunctionSolverDefinedRiemann::operator() ( const Real& /*time*/, const Re
 void
 OneDFSIFunctionSolverDefinedRiemann::updateBCVariables()
 {
-    M_bcU[0] = (* (*M_solutionPtr) ["A"]) (M_bcNode);
-    M_bcU[1] = (* (*M_solutionPtr) ["Q"]) (M_bcNode);
-    M_bcW[0] = (* (*M_solutionPtr) ["W1"]) (M_bcNode);
-    M_bcW[1] = (* (*M_solutionPtr) ["W2"]) (M_bcNode);
+    M_bcU[0] = (* (*M_solutionPtr) [OneDFSI::Area]) (M_bcNode);
+    M_bcU[1] = (* (*M_solutionPtr) [OneDFSI::FlowRate]) (M_bcNode);
+    M_bcW[0] = (* (*M_solutionPtr) [OneDFSI::RiemannW1]) (M_bcNode);
+    M_bcW[1] = (* (*M_solutionPtr) [OneDFSI::RiemannW2]) (M_bcNode);
 }
 
 
@@ -239,13 +239,13 @@ OneDFSIFunctionSolverDefinedCompatibility::evaluateRHS ( const Real& eigenvalue,
 
     container2D_Type U_interpolated;
     Real Qvisco_interpolated;
-    U_interpolated[0]   = ( 1 - cfl ) * M_bcU[0]  + cfl * (* (*M_solutionPtr) ["A"]) ( M_bcInternalNode );
-    U_interpolated[1]   = ( 1 - cfl ) * M_bcU[1]  + cfl * (* (*M_solutionPtr) ["Q"]) ( M_bcInternalNode );
+    U_interpolated[0]   = ( 1 - cfl ) * M_bcU[0]  + cfl * (* (*M_solutionPtr) [OneDFSI::Area]) ( M_bcInternalNode );
+    U_interpolated[1]   = ( 1 - cfl ) * M_bcU[1]  + cfl * (* (*M_solutionPtr) [OneDFSI::FlowRate]) ( M_bcInternalNode );
 
     // The second condition detects if there is a viscoelastic flow on the bondary.
-    if ( M_fluxPtr->physics()->data()->viscoelasticWall() && (* (*M_solutionPtr) ["Q_visc"]) (M_bcNode) > 1e-10 )
+    if ( M_fluxPtr->physics()->data()->viscoelasticWall() && (* (*M_solutionPtr) [OneDFSI::ViscoelasticFlowRate]) (M_bcNode) > 1e-10 )
     {
-        Qvisco_interpolated = ( 1 - cfl ) * (* (*M_solutionPtr) ["Q_visc"]) (M_bcNode)  + cfl * (* (*M_solutionPtr) ["Q_visc"]) ( M_bcInternalNode );
+        Qvisco_interpolated = ( 1 - cfl ) * (* (*M_solutionPtr) [OneDFSI::ViscoelasticFlowRate]) (M_bcNode)  + cfl * (* (*M_solutionPtr) [OneDFSI::ViscoelasticFlowRate]) ( M_bcInternalNode );
     }
     else
     {
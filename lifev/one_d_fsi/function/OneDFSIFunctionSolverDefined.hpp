@@ -89,7 +89,7 @@ public:
 
     typedef linearSolver_Type::matrix_type          matrix_Type;
 
-    typedef std::map< std::string, vectorPtr_Type > solution_Type;
+    typedef boost::array< vectorPtr_Type, OneDFSI::solutionQuantitiesNumber > solution_Type;
     typedef boost::shared_ptr< solution_Type >      solutionPtr_Type;
 
     typedef OneDFSI::bcLine_Type                    bcLine_Type;
@@ -50,6 +50,7 @@
 #include <boost/numeric/ublas/vector_proxy.hpp>
 #include <boost/numeric/ublas/vector.hpp>
 #include <boost/function.hpp>
+#include <boost/array.hpp>
 #include <boost/shared_ptr.hpp>
 
 
@@ -129,6 +130,24 @@ enum bcLine_Type
     second
 };
 
+/*! @enum Solution quantities
+ *  Index of the quantities in the solution container.
+ */
+enum solutionQuantity_Type
+{
+    Area,                  /*!< Area \f$A\f$ */
+    AreaRatio,             /*!< Area ratio \f$A/A^0-1\f$ */
+    FlowRate,              /*!< Flow rate \f$Q\f$ */
+    Pressure,              /*!< Pressure \f$P\f$ */
+    RiemannW1,             /*!< Riemann variable \f$W_1\f$ */
+    RiemannW2,             /*!< Riemann variable \f$W_2\f$ */
+    ViscoelasticFlowRate,  /*!< Viscoelastic contribution to the flow rate */
+    ViscoelasticPressure,  /*!< Viscoelastic contribution to the pressure */
+    InertialFlowRate,      /*!< Inertial contribution to the flow rate */
+    LongitudinalFlowRate,  /*!< Longitudinal contribution to the flow rate */
+    solutionQuantitiesNumber
+};
+
 // ===================================================
 // OneDFSIModel Utility Methods
 // ===================================================
@@ -147,6 +166,32 @@ mapsDefinition()
     sourceMap["OneD_NonLinearSource"]   = NonLinearSource;
 }
 
+//! Name of a quantity of the solution (used for the output files)
+inline const std::string&
+solutionQuantityName ( const solutionQuantity_Type& quantity )
+{
+    static const std::string names[solutionQuantitiesNumber] =
+    {
+        "A", "AoverA0minus1", "Q", "P", "W1", "W2", "Q_visc", "P_visc", "Q_inert", "Q_long"
+    };
+
+    return names[quantity];
+}
+
+//! Quantity of the solution corresponding to a name
+inline solutionQuantity_Type
+solutionQuantity ( const std::string& name )
+{
+    for ( UInt i (0); i < solutionQuantitiesNumber; ++i )
+        if ( solutionQuantityName ( static_cast< solutionQuantity_Type > ( i ) ) == name )
+        {
+            return static_cast< solutionQuantity_Type > ( i );
+        }
+
+    ERROR_MSG ( "Solution quantity \"" + name + "\" not available!" );
+    return solutionQuantitiesNumber;
+}
+
 //! Fast pow for the case of exponent 0.5
 inline Real
 pow05 ( const Real& base, const Real& exponent )
@@ -82,7 +82,14 @@ OneDFSISolver::OneDFSISolver() :
     M_dFdUGradientMatrixPtr        (),
     M_dSdUDivergenceMatrixPtr      (),
     M_linearSolverPtr              (),
-    M_linearViscoelasticSolverPtr  ()
+    M_linearViscoelasticSolverPtr  (),
+    M_minH                         ( 0. ),
+    M_useTridiagonalSolver         ( true ),
+    M_tridiagonalFactorized        ( false ),
+    M_tridiagonalLID               (),
+    M_tridiagonalLower             (),
+    M_tridiagonalInverseDiagonal   (),
+    M_tridiagonalUpper             ()
 {
 }
 
@@ -132,48 +139,52 @@ OneDFSISolver::buildConstantMatrices()
     matrix_Type systemMatrix ( *M_homogeneousMassMatrixPtr );
     applyDirichletBCToMatrix ( systemMatrix );
     M_linearSolverPtr->setMatrix ( systemMatrix );
+
+    // The system matrix is constant: factorize it once
+    M_tridiagonalFactorized = M_useTridiagonalSolver && factorizeTridiagonalMatrix ( systemMatrix );
 }
 
 void
 OneDFSISolver::setupSolution ( solution_Type& solution, const MapEpetra& map, const bool& onlyMainQuantities )
 {
-    solution["Q"].reset ( new vector_Type ( map ) );
-    solution["P"].reset ( new vector_Type ( map ) );
-    solution["AoverA0minus1"].reset ( new vector_Type ( map ) );
+    solution[OneDFSI::FlowRate].reset ( new vector_Type ( map ) );
+    solution[OneDFSI::Pressure].reset ( new vector_Type ( map ) );
+    solution[OneDFSI::AreaRatio].reset ( new vector_Type ( map ) );
 
     if ( onlyMainQuantities )
     {
         return;
     }
 
-    solution["A"].reset ( new vector_Type ( map ) );
-    solution["W1"].reset ( new vector_Type ( map ) );
-    solution["W2"].reset ( new vector_Type ( map ) );
+    solution[OneDFSI::Area].reset ( new vector_Type ( map ) );
+    solution[OneDFSI::RiemannW1].reset ( new vector_Type ( map ) );
+    solution[OneDFSI::RiemannW2].reset ( new vector_Type ( map ) );
 
     // Flux correction with viscoelastic term
     if ( M_physicsPtr->data()->viscoelasticWall() )
     {
-        solution["Q_visc"].reset ( new vector_Type ( map ) ); // viscoelastic contribution to the flux
-        solution["P_visc"].reset ( new vector_Type ( map ) ); // viscoelastic contribution to the pressure
+        solution[OneDFSI::ViscoelasticFlowRate].reset ( new vector_Type ( map ) ); // viscoelastic contribution to the flux
+        solution[OneDFSI::ViscoelasticPressure].reset ( new vector_Type ( map ) ); // viscoelastic contribution to the pressure
     }
 
     // correction flux with inertial term
     if ( M_physicsPtr->data()->inertialWall() )
     {
-        solution["Q_inert"].reset ( new vector_Type ( map ) );
+        solution[OneDFSI::InertialFlowRate].reset ( new vector_Type ( map ) );
     }
 
     // correction flux with longitudinal term
     if ( M_physicsPtr->data()->longitudinalWall() )
     {
-        solution["Q_long"].reset ( new vector_Type ( map ) );
+        solution[OneDFSI::LongitudinalFlowRate].reset ( new vector_Type ( map ) );
     }
 
     // Initialize solution to zero
     for ( solutionConstIterator_Type i = solution.begin(); i != solution.end(); ++i )
-    {
-        *i->second = 0.;
-    }
+        if ( *i )
+        {
+            **i = 0.;
+        }
 }
 
 void
@@ -181,8 +192,8 @@ OneDFSISolver::initialize ( solution_Type& solution )
 {
     for ( UInt iNode (0); iNode < M_physicsPtr->data()->numberOfNodes() ; ++iNode )
     {
-        (*solution["A"]) [iNode] = M_physicsPtr->data()->area0 ( iNode );
-        (*solution["Q"]) [iNode] = 0;
+        (*solution[OneDFSI::Area]) [iNode] = M_physicsPtr->data()->area0 ( iNode );
+        (*solution[OneDFSI::FlowRate]) [iNode] = 0;
     }
 
     // Compute W1 and W2 from A and Q
@@ -192,7 +203,7 @@ OneDFSISolver::initialize ( solution_Type& solution )
     computeAreaRatio ( solution );
 
     // Compute initial pressure (taking into account the viscoelastic wall)
-    M_physicsPtr->setArea_tn ( *solution["A"] );
+    M_physicsPtr->setArea_tn ( *solution[OneDFSI::Area] );
     computePressure ( solution, M_physicsPtr->data()->dataTime()->timeStep() );
 }
 
@@ -201,8 +212,8 @@ OneDFSISolver::computeW1W2 ( solution_Type& solution )
 {
     for ( UInt iNode (0); iNode < M_physicsPtr->data()->numberOfNodes() ; ++iNode )
     {
-        M_physicsPtr->fromUToW ( ( *solution["W1"]) [iNode], (*solution["W2"]) [iNode],
-                                 ( *solution["A"] ) [iNode], (*solution["Q"] ) [iNode], iNode );
+        M_physicsPtr->fromUToW ( ( *solution[OneDFSI::RiemannW1]) [iNode], (*solution[OneDFSI::RiemannW2]) [iNode],
+                                 ( *solution[OneDFSI::Area] ) [iNode], (*solution[OneDFSI::FlowRate] ) [iNode], iNode );
     }
 }
 
@@ -211,13 +222,13 @@ OneDFSISolver::computePressure ( solution_Type& solution, const Real& timeStep )
 {
     for ( UInt iNode (0); iNode < M_physicsPtr->data()->numberOfNodes() ; ++iNode )
     {
-        ( *solution["P"] ) [iNode] = M_physicsPtr->elasticPressure ( ( *solution["A"] ) [iNode], iNode )
+        ( *solution[OneDFSI::Pressure] ) [iNode] = M_physicsPtr->elasticPressure ( ( *solution[OneDFSI::Area] ) [iNode], iNode )
                                      + M_physicsPtr->externalPressure();
 
         if ( M_physicsPtr->data()->viscoelasticWall() )
         {
-            ( *solution["P_visc"] ) [iNode] = M_physicsPtr->viscoelasticPressure ( ( *solution["A"]) [iNode], timeStep, iNode );
-            ( *solution["P"] )      [iNode] += ( *solution["P_visc"] ) [iNode];
+            ( *solution[OneDFSI::ViscoelasticPressure] ) [iNode] = M_physicsPtr->viscoelasticPressure ( ( *solution[OneDFSI::Area]) [iNode], timeStep, iNode );
+            ( *solution[OneDFSI::Pressure] )      [iNode] += ( *solution[OneDFSI::ViscoelasticPressure] ) [iNode];
         }
     }
 }
@@ -227,7 +238,7 @@ OneDFSISolver::computeAreaRatio ( solution_Type& solution )
 {
     for ( UInt iNode (0); iNode < M_physicsPtr->data()->numberOfNodes() ; ++iNode )
     {
-        ( *solution["AoverA0minus1"] ) [iNode] = ( *solution["A"] ) [iNode] / M_physicsPtr->data()->area0 ( iNode ) - 1;
+        ( *solution[OneDFSI::AreaRatio] ) [iNode] = ( *solution[OneDFSI::Area] ) [iNode] / M_physicsPtr->data()->area0 ( iNode ) - 1;
     }
 }
 
@@ -236,7 +247,7 @@ OneDFSISolver::computeArea ( solution_Type& solution )
 {
     for ( UInt iNode (0); iNode < M_physicsPtr->data()->numberOfNodes() ; ++iNode )
     {
-        ( *solution["A"] ) [iNode] = ( (*solution["AoverA0minus1"] ) [iNode] + 1 ) * M_physicsPtr->data()->area0 ( iNode );
+        ( *solution[OneDFSI::Area] ) [iNode] = ( (*solution[OneDFSI::AreaRatio] ) [iNode] + 1 ) * M_physicsPtr->data()->area0 ( iNode );
     }
 }
 
@@ -291,12 +302,12 @@ OneDFSISolver::updateRHS ( const solution_Type& solution, const Real& timeStep )
     }
 
     // rhs = mass * Un + residual
-    *M_rhs[0]  = *M_residual[0] + ( *M_homogeneousMassMatrixPtr ) * *solution.find ("A")->second;
-    *M_rhs[1]  = *M_residual[1] + ( *M_homogeneousMassMatrixPtr ) * *solution.find ("Q")->second;
+    *M_rhs[0]  = *M_residual[0] + ( *M_homogeneousMassMatrixPtr ) * *solution[OneDFSI::Area];
+    *M_rhs[1]  = *M_residual[1] + ( *M_homogeneousMassMatrixPtr ) * *solution[OneDFSI::FlowRate];
 
     if ( M_physicsPtr->data()->viscoelasticWall() )
     {
-        *M_rhs[1]  -= ( *M_homogeneousMassMatrixPtr ) * *solution.find ("Q_visc")->second;
+        *M_rhs[1]  -= ( *M_homogeneousMassMatrixPtr ) * *solution[OneDFSI::ViscoelasticFlowRate];
     }
 }
 
@@ -306,36 +317,41 @@ OneDFSISolver::iterate ( OneDFSIBCHandler& bcHandler, solution_Type& solution, c
     // Apply BC to RHS
     bcHandler.applyBC ( time, timeStep, solution, M_fluxPtr, M_rhs );
 
-    // Compute A^n+1
+    // Compute A^n+1 and Q^n+1
     vector_Type area ( *M_rhs[0] );
-    M_linearSolverPtr->solveSystem ( *M_rhs[0], area, M_homogeneousMassMatrixPtr );
-
-    // Compute Q^n+1
     vector_Type flowRate ( *M_rhs[1] );
-    M_linearSolverPtr->solveSystem ( *M_rhs[1], flowRate, M_homogeneousMassMatrixPtr );
+    if ( M_tridiagonalFactorized )
+    {
+        solveTridiagonalSystem ( area, flowRate );
+    }
+    else
+    {
+        M_linearSolverPtr->solveSystem ( *M_rhs[0], area, M_homogeneousMassMatrixPtr );
+        M_linearSolverPtr->solveSystem ( *M_rhs[1], flowRate, M_homogeneousMassMatrixPtr );
+    }
 
     // Correct flux with inertial, viscoelastic and longitudinal terms
     if ( M_physicsPtr->data()->inertialWall() )
     {
-        *solution["Q_inert"] = inertialFlowRateCorrection ( flowRate );
-        flowRate += *solution["Q_inert"];
+        *solution[OneDFSI::InertialFlowRate] = inertialFlowRateCorrection ( flowRate );
+        flowRate += *solution[OneDFSI::InertialFlowRate];
     }
 
     if ( M_physicsPtr->data()->viscoelasticWall() )
     {
-        *solution["Q_visc"] = viscoelasticFlowRateCorrection ( area, flowRate, *solution.find ("Q_visc")->second, timeStep, bcHandler );
-        flowRate += *solution["Q_visc"];
+        *solution[OneDFSI::ViscoelasticFlowRate] = viscoelasticFlowRateCorrection ( area, flowRate, *solution[OneDFSI::ViscoelasticFlowRate], timeStep, bcHandler );
+        flowRate += *solution[OneDFSI::ViscoelasticFlowRate];
     }
 
     if ( M_physicsPtr->data()->longitudinalWall() )
     {
-        *solution["Q_long"] = longitudinalFlowRateCorrection();
-        flowRate += *solution["Q_long"];
+        *solution[OneDFSI::LongitudinalFlowRate] = longitudinalFlowRateCorrection();
+        flowRate += *solution[OneDFSI::LongitudinalFlowRate];
     }
 
     // Update the solution container
-    *solution["A"] = area;
-    *solution["Q"] = flowRate;
+    *solution[OneDFSI::Area] = area;
+    *solution[OneDFSI::FlowRate] = flowRate;
 
     // Compute W1 and W2 from A and Q
     computeW1W2 ( solution );
@@ -438,24 +454,29 @@ OneDFSISolver::computeCFL ( const solution_Type& solution, const Real& timeStep
     for ( UInt iNode (0); iNode < M_physicsPtr->data()->numberOfNodes() ; ++iNode )
     {
         // compute the eigenvalues at node
-        M_fluxPtr->eigenValuesEigenVectors ( ( *solution.find ("A")->second ) ( iNode ),
-                                             ( *solution.find ("Q")->second ) ( iNode ),
+        M_fluxPtr->eigenValuesEigenVectors ( ( *solution[OneDFSI::Area] ) ( iNode ),
+                                             ( *solution[OneDFSI::FlowRate] ) ( iNode ),
                                              eigenvalues, leftEigenvector1, leftEigenvector2, iNode );
 
         lambdaMax = std::max<Real> ( std::max<Real> ( std::fabs (eigenvalues[0]), std::fabs (eigenvalues[1]) ), lambdaMax );
     }
 
-    Real minH = MeshUtility::MeshStatistics::computeSize (*M_feSpacePtr->mesh() ).minH;
-    return lambdaMax * timeStep / minH;
+    return lambdaMax * timeStep / M_minH;
 }
 
 void
 OneDFSISolver::resetOutput ( const solution_Type& solution )
 {
     std::ofstream outfile;
-    for ( solutionConstIterator_Type i = solution.begin(); i != solution.end(); ++i )
+    for ( UInt i (0); i < OneDFSI::solutionQuantitiesNumber; ++i )
     {
-        std::string file = M_physicsPtr->data()->postprocessingDirectory() + "/" + M_physicsPtr->data()->postprocessingFile() + "_" + i->first + ".mfile";
+        if ( !solution[i] )
+        {
+            continue;
+        }
+
+        std::string file = M_physicsPtr->data()->postprocessingDirectory() + "/" + M_physicsPtr->data()->postprocessingFile() + "_"
+                           + OneDFSI::solutionQuantityName ( static_cast< OneDFSI::solutionQuantity_Type > ( i ) ) + ".mfile";
         outfile.open ( file.c_str(), std::ios::trunc );
         outfile.close();
     }
@@ -465,16 +486,22 @@ void
 OneDFSISolver::postProcess ( const solution_Type& solution, const Real& time )
 {
     std::ofstream outfile;
-    for ( solutionConstIterator_Type i = solution.begin(); i != solution.end(); ++i )
+    for ( UInt i (0); i < OneDFSI::solutionQuantitiesNumber; ++i )
     {
-        std::string file = M_physicsPtr->data()->postprocessingDirectory() + "/" + M_physicsPtr->data()->postprocessingFile() + "_" + i->first + ".mfile";
+        if ( !solution[i] )
+        {
+            continue;
+        }
+
+        std::string file = M_physicsPtr->data()->postprocessingDirectory() + "/" + M_physicsPtr->data()->postprocessingFile() + "_"
+                           + OneDFSI::solutionQuantityName ( static_cast< OneDFSI::solutionQuantity_Type > ( i ) ) + ".mfile";
         outfile.open ( file.c_str(), std::ios::app );
         outfile.setf ( std::ios::scientific, std::ios::floatfield );
 
         outfile << time << " ";
-        for ( UInt iNode (0); iNode < static_cast< UInt > ( (*i->second).size() ); ++iNode )
+        for ( UInt iNode (0); iNode < static_cast< UInt > ( solution[i]->size() ); ++iNode )
         {
-            outfile << (*i->second) (iNode) << " ";
+            outfile << (*solution[i]) (iNode) << " ";
         }
 
         outfile << std::endl;
@@ -525,6 +552,9 @@ OneDFSISolver::setFESpace ( const feSpacePtr_Type& feSpacePtr )
     //Matrix
     M_homogeneousMassMatrixPtr.reset ( new matrix_Type ( M_feSpacePtr->map() ) );
     M_homogeneousGradientMatrixPtr.reset ( new matrix_Type ( M_feSpacePtr->map() ) );
+
+    //Minimum mesh size for the CFL
+    M_minH = MeshUtility::MeshStatistics::computeSize ( *M_feSpacePtr->mesh() ).minH;
 }
 
 void
@@ -576,36 +606,36 @@ OneDFSISolver::boundaryValue ( const solution_Type& solution, const bcType_Type&
     {
         case OneDFSI::A:
 
-            return (*solution.find ("A")->second) ( boundaryDof );
+            return (*solution[OneDFSI::Area]) ( boundaryDof );
 
         case OneDFSI::Q:
 
             // Flow rate is positive with respect to the outgoing normal
-            return (*solution.find ("Q")->second) ( boundaryDof ) * ( ( bcSide == OneDFSI::left ) ? -1. : 1. );
+            return (*solution[OneDFSI::FlowRate]) ( boundaryDof ) * ( ( bcSide == OneDFSI::left ) ? -1. : 1. );
 
         case OneDFSI::W1:
 
-            return (*solution.find ("W1")->second) ( boundaryDof );
+            return (*solution[OneDFSI::RiemannW1]) ( boundaryDof );
 
         case OneDFSI::W2:
 
-            return (*solution.find ("W2")->second) ( boundaryDof );
+            return (*solution[OneDFSI::RiemannW2]) ( boundaryDof );
 
         case OneDFSI::P:
 
-            return (*solution.find ("P")->second) ( boundaryDof );
+            return (*solution[OneDFSI::Pressure]) ( boundaryDof );
 
         case OneDFSI::S:
 
-            return - (*solution.find ("P")->second) ( boundaryDof );
+            return - (*solution[OneDFSI::Pressure]) ( boundaryDof );
 
         case OneDFSI::T:
         {
-            Real P     = ( *solution.find ("P")->second ) ( boundaryDof );
+            Real P     = ( *solution[OneDFSI::Pressure] ) ( boundaryDof );
             Real rho   = M_physicsPtr->data()->densityRho();
             Real alpha = M_physicsPtr->data()->alpha ( boundaryDof );
-            Real Q     = ( *solution.find ("Q")->second ) ( boundaryDof );
-            Real A     = ( *solution.find ("A")->second ) ( boundaryDof );
+            Real Q     = ( *solution[OneDFSI::FlowRate] ) ( boundaryDof );
+            Real A     = ( *solution[OneDFSI::Area] ) ( boundaryDof );
 
             // Note that the kinetic contribution should account for the real velocity profile
             // through the alpha coefficient (i.e., the Coriolis coefficient)
@@ -628,8 +658,8 @@ OneDFSISolver::boundaryEigenValuesEigenVectors ( const bcSide_Type& bcSide,
 {
     UInt boundaryDof ( boundaryDOF ( bcSide ) );
 
-    M_fluxPtr->eigenValuesEigenVectors ( (*solution.find ("A")->second) ( boundaryDof ),
-                                         (*solution.find ("Q")->second) ( boundaryDof ),
+    M_fluxPtr->eigenValuesEigenVectors ( (*solution[OneDFSI::Area]) ( boundaryDof ),
+                                         (*solution[OneDFSI::FlowRate]) ( boundaryDof ),
                                          eigenvalues, leftEigenvector1, leftEigenvector2,
                                          boundaryDof );
 }
@@ -644,8 +674,8 @@ OneDFSISolver::updateFlux ( const solution_Type& solution )
 
     for ( UInt iNode (0); iNode < M_physicsPtr->data()->numberOfNodes() ; ++iNode )
     {
-        Ai = (*solution.find ("A")->second) ( iNode );
-        Qi = (*solution.find ("Q")->second) ( iNode );
+        Ai = (*solution[OneDFSI::Area]) ( iNode );
+        Qi = (*solution[OneDFSI::FlowRate]) ( iNode );
 
         (*M_fluxVector[0]) ( iNode ) = M_fluxPtr->flux ( Ai, Qi, 0, iNode );
         (*M_fluxVector[1]) ( iNode ) = M_fluxPtr->flux ( Ai, Qi, 1, iNode );
@@ -666,11 +696,11 @@ OneDFSISolver::updatedFdU ( const solution_Type& solution )
     for ( UInt iElement (0); iElement < M_physicsPtr->data()->numberOfElements(); ++iElement )
     {
         // for P1Seg and appropriate mesh only!
-        Aii   = (*solution.find ("A")->second) ( iElement );
-        Qii   = (*solution.find ("Q")->second) ( iElement );
+        Aii   = (*solution[OneDFSI::Area]) ( iElement );
+        Qii   = (*solution[OneDFSI::FlowRate]) ( iElement );
 
-        Aiip1 = (*solution.find ("A")->second) ( iElement + 1 );
-        Qiip1 = (*solution.find ("Q")->second) ( iElement + 1 );
+        Aiip1 = (*solution[OneDFSI::Area]) ( iElement + 1 );
+        Qiip1 = (*solution[OneDFSI::FlowRate]) ( iElement + 1 );
 
         for ( UInt ii = 0; ii < 2; ++ii )
         {
@@ -692,8 +722,8 @@ OneDFSISolver::updateSource ( const solution_Type& solution )
 
     for ( UInt iNode (0); iNode < M_physicsPtr->data()->numberOfNodes() ; ++iNode )
     {
-        Ai = (*solution.find ("A")->second) ( iNode );
-        Qi = (*solution.find ("Q")->second) ( iNode );
+        Ai = (*solution[OneDFSI::Area]) ( iNode );
+        Qi = (*solution[OneDFSI::FlowRate]) ( iNode );
 
         (*M_sourceVector[0]) ( iNode ) = M_sourcePtr->source ( Ai, Qi, 0, iNode );
         (*M_sourceVector[1]) ( iNode ) = M_sourcePtr->source ( Ai, Qi, 1, iNode );
@@ -714,10 +744,10 @@ OneDFSISolver::updatedSdU ( const solution_Type& solution )
     for ( UInt iElement (0); iElement < M_physicsPtr->data()->numberOfElements(); ++iElement )
     {
         // for P1Seg and appropriate mesh only!
-        Aii   = (*solution.find ("A")->second) ( iElement);
-        Qii   = (*solution.find ("Q")->second) ( iElement);
-        Aiip1 = (*solution.find ("A")->second) ( iElement + 1 );
-        Qiip1 = (*solution.find ("Q")->second) ( iElement + 1 );
+        Aii   = (*solution[OneDFSI::Area]) ( iElement);
+        Qii   = (*solution[OneDFSI::FlowRate]) ( iElement);
+        Aiip1 = (*solution[OneDFSI::Area]) ( iElement + 1 );
+        Qiip1 = (*solution[OneDFSI::FlowRate]) ( iElement + 1 );
 
         for ( UInt ii = 0; ii < 2; ++ii )
         {
@@ -1047,7 +1077,7 @@ OneDFSISolver::longitudinalFlowRateCorrection()
     } // end loop on elements
 
     // update rhs
-    //    _massLHS.Axpy( 1., (*solution["P"]) , 0., _rhs );
+    //    _massLHS.Axpy( 1., (*solution[OneDFSI::Pressure]) , 0., _rhs );
     rhs = massRHS * f;
 
     UInt firstDof = 0;
@@ -1075,4 +1105,122 @@ OneDFSISolver::longitudinalFlowRateCorrection()
     return rhs;
 }
 
+bool
+OneDFSISolver::factorizeTridiagonalMatrix ( const matrix_Type& matrix )
+{
+    // A process which owns no node enters the collective linear solver:
+    // all the processes must take the same path
+    Int localFactorized ( factorizeLocalTridiagonalMatrix ( matrix ) ? 1 : 0 );
+    Int factorized ( 0 );
+    matrix.matrixPtr()->Comm().MinAll ( &localFactorized, &factorized, 1 );
+
+    return factorized == 1;
+}
+
+bool
+OneDFSISolver::factorizeLocalTridiagonalMatrix ( const matrix_Type& matrix )
+{
+    const UInt numberOfNodes ( M_physicsPtr->data()->numberOfNodes() );
+    const Epetra_CrsMatrix& epetraMatrix ( *matrix.matrixPtr() );
+    const Epetra_BlockMap& map ( epetraMatrix.RowMap() );
+
+    // All the nodes must be owned by this process
+    if ( numberOfNodes == 0 || static_cast< UInt > ( map.NumMyElements() ) != numberOfNodes )
+    {
+        return false;
+    }
+
+    M_tridiagonalLID.resize ( numberOfNodes );
+    M_tridiagonalLower.assign ( numberOfNodes, 0. );
+    M_tridiagonalInverseDiagonal.assign ( numberOfNodes, 0. );
+    M_tridiagonalUpper.assign ( numberOfNodes, 0. );
+
+    // Extract the three diagonals (nodes are numbered along the segment)
+    std::vector< Real > diagonal ( numberOfNodes, 0. );
+    std::vector< Real > values ( epetraMatrix.MaxNumEntries() );
+    std::vector< Int >  indices ( epetraMatrix.MaxNumEntries() );
+    Int numEntries;
+    for ( UInt iNode (0); iNode < numberOfNodes; ++iNode )
+    {
+        M_tridiagonalLID[iNode] = map.LID ( static_cast< Int > ( iNode ) );
+        if ( M_tridiagonalLID[iNode] < 0 )
+        {
+            return false;
+        }
+
+        epetraMatrix.ExtractGlobalRowCopy ( iNode, epetraMatrix.MaxNumEntries(), numEntries, &values[0], &indices[0] );
+        for ( Int iEntry (0); iEntry < numEntries; ++iEntry )
+        {
+            const Int offset ( indices[iEntry] - static_cast< Int > ( iNode ) );
+            if ( offset == -1 )
+            {
+                M_tridiagonalLower[iNode] += values[iEntry];
+            }
+            else if ( offset == 0 )
+            {
+                diagonal[iNode] += values[iEntry];
+            }
+            else if ( offset == 1 )
+            {
+                M_tridiagonalUpper[iNode] += values[iEntry];
+            }
+            else if ( values[iEntry] != 0. )
+            {
+                return false;
+            }
+        }
+    }
+
+    // Thomas algorithm: store the inverse of the pivots and the normalized upper diagonal
+    for ( UInt iNode (0); iNode < numberOfNodes; ++iNode )
+    {
+        Real pivot ( diagonal[iNode] );
+        if ( iNode > 0 )
+        {
+            pivot -= M_tridiagonalLower[iNode] * M_tridiagonalUpper[iNode - 1];
+        }
+        if ( pivot == 0. )
+        {
+            return false;
+        }
+        M_tridiagonalInverseDiagonal[iNode] = 1. / pivot;
+        M_tridiagonalUpper[iNode] *= M_tridiagonalInverseDiagonal[iNode];
+    }
+
+    return true;
+}
+
+void
+OneDFSISolver::solveTridiagonalSystem ( vector_Type& solution1, vector_Type& solution2 ) const
+{
+    const UInt numberOfNodes ( M_tridiagonalLID.size() );
+    if ( numberOfNodes == 0 )
+    {
+        return;
+    }
+
+    Real* x1 ( solution1.epetraVector() [0] );
+    Real* x2 ( solution2.epetraVector() [0] );
+
+    // Forward sweep
+    Real previous1 ( 0. );
+    Real previous2 ( 0. );
+    for ( UInt iNode (0); iNode < numberOfNodes; ++iNode )
+    {
+        const Int lid ( M_tridiagonalLID[iNode] );
+        previous1 = ( x1[lid] - M_tridiagonalLower[iNode] * previous1 ) * M_tridiagonalInverseDiagonal[iNode];
+        previous2 = ( x2[lid] - M_tridiagonalLower[iNode] * previous2 ) * M_tridiagonalInverseDiagonal[iNode];
+        x1[lid] = previous1;
+        x2[lid] = previous2;
+    }
+
+    // Backward sweep
+    for ( UInt iNode ( numberOfNodes - 1 ); iNode > 0; --iNode )
+    {
+        const Int lid ( M_tridiagonalLID[iNode - 1] );
+        previous1 = x1[lid] -= M_tridiagonalUpper[iNode - 1] * previous1;
+        previous2 = x2[lid] -= M_tridiagonalUpper[iNode - 1] * previous2;
+    }
+}
+
 }
@@ -145,6 +145,11 @@ namespace LifeV
  *  tridiagonal matrices stored), but it has the advantage of being
  *  very clear. If it is too costly, it should be quite easy to improve
  *  it.
+ *
+ *  The mass matrix (with Dirichlet BC) is tridiagonal and does not change in time. When the
+ *  tridiagonal solver is enabled (default) and all the nodes are owned by the process, it is factorized
+ *  once by the Thomas algorithm in buildConstantMatrices() and the systems for \f$A\f$ and \f$Q\f$ are
+ *  solved together in a single forward and backward sweep, without going through the linear solver.
  */
 class OneDFSISolver
 {
@@ -186,7 +191,7 @@ public:
     typedef boost::shared_ptr<matrix_Type>          matrixPtr_Type;
     typedef boost::array<matrixPtr_Type, 4 >        matrixPtrContainer_Type;
 
-    typedef std::map< std::string, vectorPtr_Type > solution_Type;
+    typedef boost::array< vectorPtr_Type, OneDFSI::solutionQuantitiesNumber > solution_Type;
     typedef boost::shared_ptr< solution_Type >      solutionPtr_Type;
     typedef solution_Type::const_iterator           solutionConstIterator_Type;
 
@@ -382,6 +387,17 @@ public:
      */
     void setLinearViscoelasticSolver ( const linearSolverPtr_Type& linearViscoelasticSolverPtr );
 
+    //! Enable the tridiagonal (Thomas algorithm) solver for the mass matrix
+    /*!
+     * It is used only if all the nodes are owned by the process; otherwise the linear solver is used.
+     * It must be set before calling buildConstantMatrices().
+     * @param useTridiagonalSolver true to enable the tridiagonal solver
+     */
+    void setTridiagonalSolver ( const bool& useTridiagonalSolver )
+    {
+        M_useTridiagonalSolver = useTridiagonalSolver;
+    }
+
     //@}
 
 
@@ -564,6 +580,30 @@ private:
      */
     vector_Type longitudinalFlowRateCorrection();
 
+    //! Factorize a tridiagonal matrix with the Thomas algorithm
+    /*!
+     *  The factorization is stored and reused by solveTridiagonalSystem().
+     *  The decision is taken collectively: the factorization is used only if it
+     *  succeeds on all the processes of the communicator.
+     *  @param matrix the tridiagonal matrix (it must be globally assembled)
+     *  @return false if the matrix is not tridiagonal or the nodes are distributed
+     */
+    bool factorizeTridiagonalMatrix ( const matrix_Type& matrix );
+
+    //! Factorize the tridiagonal matrix on this process (see factorizeTridiagonalMatrix())
+    /*!
+     *  @param matrix the tridiagonal matrix (it must be globally assembled)
+     *  @return false if the matrix is not tridiagonal or not all the nodes are owned by this process
+     */
+    bool factorizeLocalTridiagonalMatrix ( const matrix_Type& matrix );
+
+    //! Solve two systems with the factorized tridiagonal matrix in a single sweep
+    /*!
+     *  @param solution1 on input the first right hand side, on output the first solution
+     *  @param solution2 on input the second right hand side, on output the second solution
+     */
+    void solveTridiagonalSystem ( vector_Type& solution1, vector_Type& solution2 ) const;
+
     //! L2 Projection of the second derivative of Q over P1 space.
     //scalarVector_Type                       _compute_d2Q_dx2( const scalarVector_Type& );
 
@@ -621,6 +661,17 @@ private:
     linearSolverPtr_Type               M_linearSolverPtr;
     linearSolverPtr_Type               M_linearViscoelasticSolverPtr;
 
+    //! Minimum mesh size (for the CFL)
+    Real                               M_minH;
+
+    //! Thomas factorization of the mass matrix with Dirichlet BC
+    bool                               M_useTridiagonalSolver;
+    bool                               M_tridiagonalFactorized;
+    std::vector< Int >                 M_tridiagonalLID;
+    std::vector< Real >                M_tridiagonalLower;
+    std::vector< Real >                M_tridiagonalInverseDiagonal;
+    std::vector< Real >                M_tridiagonalUpper;
+
 private:
 
     //! @name Unimplemented Methods
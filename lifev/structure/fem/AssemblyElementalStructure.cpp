@@ -39,6 +39,9 @@
 #include <lifev/structure/fem/AssemblyElementalStructure.hpp>
 #include <boost/multi_array.hpp>
 
+#include <cmath>
+#include <algorithm>
+
 namespace LifeV
 {
 
@@ -1520,6 +1523,70 @@ void computeEigenvalues (const Epetra_SerialDenseMatrix& cauchy,
 
 }
 
+void computeSymmetricEigenvalues (const LifeV::Real tensor[6], LifeV::Real eigenvalues[3])
+{
+    const Real offDiagonal ( tensor[3] * tensor[3] + tensor[4] * tensor[4] + tensor[5] * tensor[5] );
+    const Real mean ( ( tensor[0] + tensor[1] + tensor[2] ) / 3.0 );
+
+    const Real dxx ( tensor[0] - mean );
+    const Real dyy ( tensor[1] - mean );
+    const Real dzz ( tensor[2] - mean );
+
+    const Real p ( std::sqrt ( ( dxx * dxx + dyy * dyy + dzz * dzz + 2.0 * offDiagonal ) / 6.0 ) );
+
+    // Multiple of the identity
+    if ( p == 0. )
+    {
+        eigenvalues[0] = eigenvalues[1] = eigenvalues[2] = mean;
+        return;
+    }
+
+    // Diagonal tensor
+    if ( offDiagonal == 0. )
+    {
+        eigenvalues[0] = tensor[0];
+        eigenvalues[1] = tensor[1];
+        eigenvalues[2] = tensor[2];
+        std::sort ( eigenvalues, eigenvalues + 3 );
+        return;
+    }
+
+    // Half of the determinant of B = ( tensor - mean * I ) / p
+    const Real r ( ( dxx * ( dyy * dzz - tensor[5] * tensor[5] )
+                     - tensor[3] * ( tensor[3] * dzz - tensor[5] * tensor[4] )
+                     + tensor[4] * ( tensor[3] * tensor[5] - dyy * tensor[4] ) ) / ( 2.0 * p * p * p ) );
+
+    // Round-off can bring r slightly out of [-1, 1]
+    Real phi ( 0. );
+    if ( r <= -1.0 )
+    {
+        phi = M_PI / 3.0;
+    }
+    else if ( r < 1.0 )
+    {
+        phi = std::acos ( r ) / 3.0;
+    }
+
+    eigenvalues[2] = mean + 2.0 * p * std::cos ( phi );
+    eigenvalues[0] = mean + 2.0 * p * std::cos ( phi + 2.0 * M_PI / 3.0 );
+    eigenvalues[1] = 3.0 * mean - eigenvalues[0] - eigenvalues[2];
+}
+
+void computeSymmetricEigenvalues (const Epetra_SerialDenseMatrix& cauchy,
+                                  std::vector<LifeV::Real>& eigenvalues)
+{
+    const Real tensor[6] = { cauchy (0, 0),
+                             cauchy (1, 1),
+                             cauchy (2, 2),
+                             0.5 * ( cauchy (0, 1) + cauchy (1, 0) ),
+                             0.5 * ( cauchy (0, 2) + cauchy (2, 0) ),
+                             0.5 * ( cauchy (1, 2) + cauchy (2, 1) )
+                           };
+
+    eigenvalues.resize ( 3 );
+    computeSymmetricEigenvalues ( tensor, &eigenvalues[0] );
+}
+
 //! ***********************************************************************************************
 //! METHODS FOR THE ST. VENANT KIRCHHOFF PENALIZED LAW
 //! ***********************************************************************************************
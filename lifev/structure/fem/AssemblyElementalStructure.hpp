@@ -389,6 +389,22 @@ void computeEigenvalues (const Epetra_SerialDenseMatrix& cauchy,
                          std::vector<LifeV::Real>& eigenvaluesR,
                          std::vector<LifeV::Real>& eigenvaluesI);
 
+/*!
+  This function computes the eigenvalues of a symmetric 3x3 tensor in closed form,
+  using the trigonometric solution of the characteristic equation (no LAPACK call)
+  @param tensor components of the tensor, ordered as xx, yy, zz, xy, xz, yz
+  @param eigenvalues eigenvalues sorted in ascending order
+*/
+void computeSymmetricEigenvalues (const LifeV::Real tensor[6], LifeV::Real eigenvalues[3]);
+
+/*!
+  This function computes the eigenvalues of the symmetric part of \sigma in closed form
+  @param cauchy Cauchy stress tensor
+  @param eigenvalues vector of principal tensions, sorted in ascending order
+*/
+void computeSymmetricEigenvalues (const Epetra_SerialDenseMatrix& cauchy,
+                                  std::vector<LifeV::Real>& eigenvalues);
+
 //! Methods for the isochoric part of the Jacobian matrix
 
 //! Elementary first nonlinear isochoric Jacobian matrix for Neo-Hookean model (see the reference)
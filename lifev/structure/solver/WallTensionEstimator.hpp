@@ -68,6 +68,7 @@
 #include <lifev/core/fem/Assembly.hpp>
 #include <lifev/core/fem/AssemblyElemental.hpp>
 #include <lifev/core/fem/FESpace.hpp>
+#include <lifev/core/fem/GradientRecovery.hpp>
 #include <lifev/core/LifeV.hpp>
 #include <lifev/core/util/Displayer.hpp>
 #include <lifev/core/array/MapEpetra.hpp>
@@ -465,6 +466,12 @@ protected:
     */
     void reconstructElementaryVector ( VectorElemental& elVecSigma, const solutionVect_Type& patchArea, const feSpace_Type& feSpace );
 
+    //! buildLocalDofIndices: This method stores the local IDs of the components of the DOFs owned by the process
+    /*!
+      The analysis methods then work directly on the local arrays of the vectors, without global ID lookups
+    */
+    void buildLocalDofIndices ();
+
     
     void computeInvariantsRightCauchyGreenTensor (std::vector<LifeV::Real>& invariants,
                                                   const Epetra_SerialDenseMatrix& tensorF,
@@ -519,6 +526,9 @@ protected:
     //! Vector for the gradient along Z of the displacement field
     solutionVectPtr_Type                           M_gradientZ;
 
+    //! Measure of the patches used by the gradient recovery (the reference mesh does not change)
+    solutionVectPtr_Type                           M_patchMeasure;
+
     //! Vector for the X component of the stress tensor
     solutionVectPtr_Type                           M_sigmaX;
 
@@ -534,6 +544,18 @@ protected:
     //! Vector for the eigenvalues of the Cauchy stress tensor
     solutionVectPtr_Type                           M_globalEigenvalues;
 
+    //! Local IDs of the components of the DOFs owned by the process (fieldDim entries per DOF)
+    std::vector<Int>                               M_localDofLID;
+
+    //! Nodal quadrature rule of M_recoveryFESpace, which keeps only a pointer to it
+    boost::shared_ptr<QuadratureRule>              M_recoveryQuadRule;
+
+    //! FE space with the nodal quadrature rule used by constructGlobalStressVector (built at the first call)
+    feSpacePtr_Type                                M_recoveryFESpace;
+
+    //! Repeated patch area vector used by constructGlobalStressVector (built at the first call)
+    solutionVectPtr_Type                           M_recoveryPatchArea;
+
     //! The Offset parameter
     UInt                                           M_offset;
 
@@ -573,7 +595,12 @@ WallTensionEstimator<Mesh>::WallTensionEstimator( ) :
     M_gradientX                  ( ),
     M_gradientY                  ( ),
     M_gradientZ                  ( ),
+    M_patchMeasure               ( ),
     M_globalEigenvalues          ( ),
+    M_localDofLID                ( ),
+    M_recoveryQuadRule           ( ),
+    M_recoveryFESpace            ( ),
+    M_recoveryPatchArea          ( ),
     M_sigmaX                     ( ),
     M_sigmaY                     ( ),
     M_sigmaZ                     ( ),
@@ -645,6 +672,8 @@ WallTensionEstimator<Mesh >::setup ( const dataPtr_Type& dataMaterial,
     M_gradientY.reset     ( new solutionVect_Type (*M_FESpace->mapPtr() ) );
     M_gradientZ.reset     ( new solutionVect_Type (*M_FESpace->mapPtr() ) );
 
+    M_patchMeasure.reset  ( );
+
     M_sigmaX.reset        ( new solutionVect_Type (*M_FESpace->mapPtr() ) );
     M_sigmaY.reset        ( new solutionVect_Type (*M_FESpace->mapPtr() ) );
     M_sigmaZ.reset        ( new solutionVect_Type (*M_FESpace->mapPtr() ) );
@@ -657,6 +686,12 @@ WallTensionEstimator<Mesh >::setup ( const dataPtr_Type& dataMaterial,
     M_eigenvaluesR.resize ( M_FESpace->fieldDim() );
     M_eigenvaluesI.resize ( M_FESpace->fieldDim() );
 
+    buildLocalDofIndices();
+
+    M_recoveryFESpace.reset ( );
+    M_recoveryQuadRule.reset ( );
+    M_recoveryPatchArea.reset ( );
+
     // Materials
     //M_material.reset ( material_Type::StructureMaterialFactory::instance().createObject ( M_dataMaterial->solidType() ) );
     M_material = EMMaterial;
@@ -711,7 +746,6 @@ WallTensionEstimator<Mesh >::analyzeTensionsRecoveryDisplacement ( void )
 
     //For each of the DOF, the Cauchy tensor is computed.
     //Therefore the tensor C,P, \sigma are computed for each DOF
-    UInt dim = M_FESpace->dim();
 
     LifeChrono chrono;
 
@@ -721,76 +755,50 @@ WallTensionEstimator<Mesh >::analyzeTensionsRecoveryDisplacement ( void )
 
     chrono.start();
 
-    for ( UInt iDOF = 0; iDOF < ( UInt ) M_FESpace->dof().numTotalDof(); ++iDOF )
-    {
+    //Local arrays of the gradient and of the eigenvalues
+    const Real* gradientX ( grDisplX->epetraVector()[0] );
+    const Real* gradientY ( grDisplY->epetraVector()[0] );
+    const Real* gradientZ ( grDisplZ->epetraVector()[0] );
+    Real* eigenvalues ( M_globalEigenvalues->epetraVector()[0] );
 
-        if ( M_displacement->blockMap().LID ( static_cast<EpetraInt_Type> (iDOF) ) != -1 ) // The Global ID is on the calling processors
-        {
-            std::vector<Real> dX (3, 0.0);
-            std::vector<Real> dY (3, 0.0);
-            std::vector<Real> dZ (3, 0.0);
-
-            //Reinitialization of matrices and arrays
-            (*M_deformationF).Scale (0.0);
-            (*M_cofactorF).Scale (0.0);
-            (*M_firstPiola).Scale (0.0);
-            (*M_sigma).Scale (0.0);
-
-            //Extracting the gradient of U on the current DOF
-            for ( UInt iComp = 0; iComp < M_FESpace->fieldDim(); ++iComp )
-            {
-                Int LIDid = M_displacement->blockMap().LID ( static_cast<EpetraInt_Type> ( ( iDOF + iComp * dim + M_offset ) ) );
-                Int GIDid = M_displacement->blockMap().GID ( static_cast<EpetraInt_Type> (LIDid) );
-                dX[iComp] = (*grDisplX) (GIDid); // (d_xX,d_yX,d_zX)
-                dY[iComp] = (*grDisplY) (GIDid); // (d_xY,d_yY,d_zY)
-                dZ[iComp] = (*grDisplZ) (GIDid); // (d_xZ,d_yZ,d_zZ)
-            }
+    const UInt fieldDim ( M_FESpace->fieldDim() );
+    const UInt numLocalDof ( M_localDofLID.size() / fieldDim );
 
-            //Fill the matrix F
-            for ( UInt icoor (0); icoor < M_FESpace->fieldDim(); ++icoor )
-            {
-                (*M_deformationF) (icoor, 0) = dX[icoor];
-                (*M_deformationF) (icoor, 1) = dY[icoor];
-                (*M_deformationF) (icoor, 2) = dZ[icoor];
-
-                (*M_deformationF) (icoor, icoor) += 1.0;
-            }
-
-            //Compute the rightCauchyC tensor
-            AssemblyElementalStructure::computeInvariantsRightCauchyGreenTensor (M_invariants, *M_deformationF, *M_cofactorF);
+    //The material is not thread safe: the DOFs are visited sequentially
+    for ( UInt iDOF (0); iDOF < numLocalDof; ++iDOF )
+    {
+        const Int* componentsLID ( &M_localDofLID[iDOF * fieldDim] );
 
-            // Real sumI(0);
-            // for( UInt i(0); i < M_invariants.size(); i++ )
-            //     sumI += M_invariants[i];
+        //Fill the matrix F with the gradient of U on the current DOF
+        for ( UInt icoor (0); icoor < fieldDim; ++icoor )
+        {
+            (*M_deformationF) (icoor, 0) = gradientX[componentsLID[icoor]]; // (d_xX,d_yX,d_zX)
+            (*M_deformationF) (icoor, 1) = gradientY[componentsLID[icoor]]; // (d_xY,d_yY,d_zY)
+            (*M_deformationF) (icoor, 2) = gradientZ[componentsLID[icoor]]; // (d_xZ,d_yZ,d_zZ)
 
-            //Compute the first Piola-Kirchhoff tensor
-            M_material->computeLocalFirstPiolaKirchhoffTensor (*M_firstPiola, *M_deformationF, *M_cofactorF, M_invariants, M_marker);
+            (*M_deformationF) (icoor, icoor) += 1.0;
+        }
 
-            //Compute the Cauchy tensor
-            AssemblyElementalStructure::computeCauchyStressTensor (*M_sigma, *M_firstPiola, M_invariants[3], *M_deformationF);
+        (*M_cofactorF).Scale (0.0);
+        (*M_firstPiola).Scale (0.0);
+        (*M_sigma).Scale (0.0);
 
-            //Compute the eigenvalue
-            AssemblyElementalStructure::computeEigenvalues (*M_sigma, M_eigenvaluesR, M_eigenvaluesI);
+        //Compute the rightCauchyC tensor
+        AssemblyElementalStructure::computeInvariantsRightCauchyGreenTensor (M_invariants, *M_deformationF, *M_cofactorF);
 
-            //The Cauchy tensor is symmetric and therefore, the eigenvalues are real
-            //Check on the imaginary part of eigen values given by the Lapack method
-            Real sum (0);
-            for ( UInt i (0); i < M_eigenvaluesI.size(); ++i )
-            {
-                sum += std::abs (M_eigenvaluesI[i]);
-            }
-            ASSERT_PRE ( sum < 1e-6 , "The eigenvalues of the Cauchy stress tensors have to be real!" );
+        //Compute the first Piola-Kirchhoff tensor
+        M_material->computeLocalFirstPiolaKirchhoffTensor (*M_firstPiola, *M_deformationF, *M_cofactorF, M_invariants, M_marker);
 
-            std::sort ( M_eigenvaluesR.begin(), M_eigenvaluesR.end() );
+        //Compute the Cauchy tensor
+        AssemblyElementalStructure::computeCauchyStressTensor (*M_sigma, *M_firstPiola, M_invariants[3], *M_deformationF);
 
-            //Save the eigenvalues in the global vector
-            for ( UInt icoor (0); icoor < M_FESpace->fieldDim(); ++icoor )
-            {
-                Int LIDid = M_displacement->blockMap().LID ( static_cast<EpetraInt_Type> (iDOF + icoor * dim + M_offset) );
-                Int GIDid = M_displacement->blockMap().GID ( static_cast<EpetraInt_Type> (LIDid) );
-                (*M_globalEigenvalues) (GIDid) = M_eigenvaluesR[icoor];
-            }
+        //The Cauchy tensor is symmetric: the sorted eigenvalues are computed in closed form
+        AssemblyElementalStructure::computeSymmetricEigenvalues (*M_sigma, M_eigenvaluesR);
 
+        //Save the eigenvalues in the global vector
+        for ( UInt icoor (0); icoor < fieldDim; ++icoor )
+        {
+            eigenvalues[componentsLID[icoor]] = M_eigenvaluesR[icoor];
         }
     }
 
@@ -891,19 +899,8 @@ WallTensionEstimator<Mesh >::analyzeTensionsRecoveryEigenvalues ( void )
             //Compute the Cauchy tensor
             AssemblyElementalStructure::computeCauchyStressTensor (*M_sigma, *M_firstPiola, M_invariants[3], vectorDeformationF[nDOF]);
 
-            //Compute the eigenvalue
-            AssemblyElementalStructure::computeEigenvalues (*M_sigma, M_eigenvaluesR, M_eigenvaluesI);
-
-            //The Cauchy tensor is symmetric and therefore, the eigenvalues are real
-            //Check on the imaginary part of eigen values given by the Lapack method
-            Real sum (0);
-            for ( UInt i (0); i < M_eigenvaluesI.size(); ++i )
-            {
-                sum += std::abs (M_eigenvaluesI[i]);
-            }
-            ASSERT_PRE ( sum < 1e-6 , "The eigenvalues of the Cauchy stress tensors have to be real!" );
-
-            std::sort ( M_eigenvaluesR.begin(), M_eigenvaluesR.end() );
+            //The Cauchy tensor is symmetric: the sorted eigenvalues are computed in closed form
+            AssemblyElementalStructure::computeSymmetricEigenvalues (*M_sigma, M_eigenvaluesR);
 
             //Assembling the local vector
             for ( UInt coor (0); coor < M_eigenvaluesR.size(); ++coor )
@@ -938,45 +935,37 @@ WallTensionEstimator<Mesh >::analyzeTensionsRecoveryCauchyStresses ( void )
     //Construct stress tensor
     constructGlobalStressVector ();
 
-    for ( UInt iDOF (0); iDOF < ( UInt ) M_FESpace->dof().numTotalDof(); ++iDOF )
-    {
-
-        if ( M_displacement->blockMap().LID ( static_cast<EpetraInt_Type> (iDOF) ) != -1 ) // The Global ID is on the calling processors
-        {
-
-            (*M_sigma).Scale (0.0);
-
-            //Extracting the gradient of U on the current DOF
-            for ( UInt iComp = 0; iComp < M_FESpace->fieldDim(); ++iComp )
-            {
-                Int LIDid = M_displacement->blockMap().LID ( static_cast<EpetraInt_Type> (iDOF + iComp * M_FESpace->dim() + M_offset) );
-                Int GIDid = M_displacement->blockMap().GID (static_cast<EpetraInt_Type> (LIDid) );
-                (*M_sigma) (iComp, 0) = (*M_sigmaX) (GIDid); // (d_xX,d_yX,d_zX)
-                (*M_sigma) (iComp, 1) = (*M_sigmaY) (GIDid); // (d_xY,d_yY,d_zY)
-                (*M_sigma) (iComp, 2) = (*M_sigmaZ) (GIDid); // (d_xZ,d_yZ,d_zZ)
-            }
+    //Local arrays of the stress tensor and of the eigenvalues
+    const Real* sigmaX ( M_sigmaX->epetraVector()[0] );
+    const Real* sigmaY ( M_sigmaY->epetraVector()[0] );
+    const Real* sigmaZ ( M_sigmaZ->epetraVector()[0] );
+    Real* eigenvalues ( M_globalEigenvalues->epetraVector()[0] );
 
-            //Compute the eigenvalue
-            AssemblyElementalStructure::computeEigenvalues (*M_sigma, M_eigenvaluesR, M_eigenvaluesI);
+    const UInt fieldDim ( M_FESpace->fieldDim() );
+    const Int numLocalDof ( M_localDofLID.size() / fieldDim );
 
-            //The Cauchy tensor is symmetric and therefore, the eigenvalues are real
-            //Check on the imaginary part of eigen values given by the Lapack method
-            Real sum (0);
-            for ( UInt i (0); i < M_eigenvaluesI.size(); ++i )
-            {
-                sum += std::abs (M_eigenvaluesI[i]);
-            }
-            ASSERT_PRE ( sum < 1e-6 , "The eigenvalues of the Cauchy stress tensors have to be real!" );
-
-            std::sort ( M_eigenvaluesR.begin(), M_eigenvaluesR.end() );
-
-            //Save the eigenvalues in the global vector
-            for ( UInt icoor = 0; icoor < M_FESpace->fieldDim(); ++icoor )
-            {
-                Int LIDid = M_displacement->blockMap().LID ( static_cast<EpetraInt_Type> (iDOF + icoor * M_FESpace->dim() + M_offset ) );
-                Int GIDid = M_displacement->blockMap().GID (static_cast<EpetraInt_Type> (LIDid) );
-                (*M_globalEigenvalues) (GIDid) = M_eigenvaluesR[icoor];
-            }
+    //Each DOF writes only its own entries: the loop can be shared among threads
+    #pragma omp parallel for
+    for ( Int iDOF = 0; iDOF < numLocalDof; ++iDOF )
+    {
+        const Int* componentsLID ( &M_localDofLID[iDOF * fieldDim] );
+
+        //Symmetric part of the stress tensor on the current DOF (xx, yy, zz, xy, xz, yz)
+        const Real sigma[6] = { sigmaX[componentsLID[0]],
+                                sigmaY[componentsLID[1]],
+                                sigmaZ[componentsLID[2]],
+                                0.5 * ( sigmaY[componentsLID[0]] + sigmaX[componentsLID[1]] ),
+                                0.5 * ( sigmaZ[componentsLID[0]] + sigmaX[componentsLID[2]] ),
+                                0.5 * ( sigmaZ[componentsLID[1]] + sigmaY[componentsLID[2]] )
+                              };
+
+        Real localEigenvalues[3];
+        AssemblyElementalStructure::computeSymmetricEigenvalues ( sigma, localEigenvalues );
+
+        //Save the eigenvalues in the global vector
+        for ( UInt icoor = 0; icoor < fieldDim; ++icoor )
+        {
+            eigenvalues[componentsLID[icoor]] = localEigenvalues[icoor];
         }
     }
 
@@ -996,39 +985,61 @@ WallTensionEstimator<Mesh >::analyzeTensionsRecoveryVonMisesStress ()
     //Construct stress tensor
     constructGlobalStressVector ();
 
-    //Compute Von Mises stress
-    *M_sigmaVonMises *= 0.;
-
-    //Initialize vectors
-    solutionVect_Type stressComponent1 ( *M_FESpaceScalar->mapPtr() );
-    solutionVect_Type stressComponent2 ( *M_FESpaceScalar->mapPtr() );
-    solutionVect_Type stressComponent3 ( *M_FESpaceScalar->mapPtr() );
-
-    //Off-diagonal elements
-    exportStressXY ( stressComponent1 );
-    exportStressXZ ( stressComponent2 );
-    exportStressYZ ( stressComponent3 );
-    *M_sigmaVonMises += stressComponent1 * stressComponent1
-                        +  stressComponent2 * stressComponent2
-                        +  stressComponent3 * stressComponent3;
-
-    //Diagonal elements
-    exportStressXX ( stressComponent1 );
-    exportStressYY ( stressComponent2 );
-    exportStressZZ ( stressComponent3 );
-    *M_sigmaVonMises += ( stressComponent1 - stressComponent2 ) * ( stressComponent1 - stressComponent2 )
-                        +  ( stressComponent1 - stressComponent3 ) * ( stressComponent1 - stressComponent3 )
-                        +  ( stressComponent2 - stressComponent3 ) * ( stressComponent2 - stressComponent3 );
-
-    //Final operations
-    *M_sigmaVonMises *= 0.5;
-    M_sigmaVonMises->sqrt();
+    //Local arrays of the stress tensor and of the Von Mises stress
+    const Real* sigmaX ( M_sigmaX->epetraVector()[0] );
+    const Real* sigmaY ( M_sigmaY->epetraVector()[0] );
+    const Real* sigmaZ ( M_sigmaZ->epetraVector()[0] );
+    Real* vonMises ( M_sigmaVonMises->epetraVector()[0] );
+
+    const UInt fieldDim ( M_FESpace->fieldDim() );
+    const Int numLocalDof ( M_localDofLID.size() / fieldDim );
+
+    //Compute Von Mises stress in a single pass over the local DOFs
+    #pragma omp parallel for
+    for ( Int iDOF = 0; iDOF < numLocalDof; ++iDOF )
+    {
+        const Int* componentsLID ( &M_localDofLID[iDOF * fieldDim] );
+
+        //Off-diagonal elements
+        const Real sigmaXY ( sigmaX[componentsLID[1]] );
+        const Real sigmaXZ ( sigmaX[componentsLID[2]] );
+        const Real sigmaYZ ( sigmaY[componentsLID[2]] );
+
+        //Diagonal elements
+        const Real sigmaXX ( sigmaX[componentsLID[0]] );
+        const Real sigmaYY ( sigmaY[componentsLID[1]] );
+        const Real sigmaZZ ( sigmaZ[componentsLID[2]] );
+
+        vonMises[iDOF] = std::sqrt ( 0.5 * ( sigmaXY * sigmaXY + sigmaXZ * sigmaXZ + sigmaYZ * sigmaYZ
+                                             + ( sigmaXX - sigmaYY ) * ( sigmaXX - sigmaYY )
+                                             + ( sigmaXX - sigmaZZ ) * ( sigmaXX - sigmaZZ )
+                                             + ( sigmaYY - sigmaZZ ) * ( sigmaYY - sigmaZZ ) ) );
+    }
 
     //Chrono
     chrono.stop();
     M_displayer->leaderPrint ("  S-  Von Mises stress computed in:             ", chrono.globalDiff ( *M_displayer->comm() ), " s\n" );
 }
 
+template <typename Mesh>
+void
+WallTensionEstimator<Mesh >::buildLocalDofIndices ()
+{
+    const Epetra_BlockMap& scalarMap ( M_sigmaVonMises->blockMap() );
+    const Epetra_BlockMap& vectorMap ( M_displacement->blockMap() );
+    const UInt fieldDim ( M_FESpace->fieldDim() );
+
+    M_localDofLID.resize ( scalarMap.NumMyElements() * fieldDim );
+    for ( Int iDOF (0); iDOF < scalarMap.NumMyElements(); ++iDOF )
+    {
+        for ( UInt iComp (0); iComp < fieldDim; ++iComp )
+        {
+            M_localDofLID[iDOF * fieldDim + iComp] = vectorMap.LID ( static_cast<EpetraInt_Type> ( scalarMap.GID ( iDOF ) + iComp * M_FESpace->dim() + M_offset ) );
+            ASSERT ( M_localDofLID[iDOF * fieldDim + iComp] != -1, "The components of a DOF have to be owned by the same process!" );
+        }
+    }
+}
+
 template <typename Mesh>
 void
 WallTensionEstimator<Mesh >::computeDisplacementGradient ( solutionVectPtr_Type grDisplX,
@@ -1036,16 +1047,16 @@ WallTensionEstimator<Mesh >::computeDisplacementGradient ( solutionVectPtr_Type
                                                            solutionVectPtr_Type grDisplZ )
 {
     //The map of the displacement field is not transformed in a Repeated map
-    //because it is done inside the gradientRecovery method
+    //because it is done inside the gradient recovery
 
-    //Compute the gradient along X of the displacement field
-    *grDisplX = M_FESpace->gradientRecovery (*M_displacement, 0);
+    //Compute the gradient along X, Y and Z of the displacement field in a single loop
+    //over the elements; the measure of the patches is computed only at the first call
+    std::vector<solutionVectPtr_Type> gradient;
+    GradientRecovery::ZZFullGradient ( M_FESpace, *M_displacement, gradient, M_patchMeasure );
 
-    //Compute the gradient along Y of the displacement field
-    *grDisplY = M_FESpace->gradientRecovery (*M_displacement, 1);
-
-    //Compute the gradient along Z of the displacement field
-    *grDisplZ = M_FESpace->gradientRecovery (*M_displacement, 2);
+    *grDisplX = *gradient[0];
+    *grDisplY = *gradient[1];
+    *grDisplZ = *gradient[2];
 }
 
 template <typename Mesh>
@@ -1061,36 +1072,42 @@ WallTensionEstimator<Mesh >::constructGlobalStressVector ()
     *M_sigmaY *= 0.;
     *M_sigmaZ *= 0.;
 
-    //Constructing the patch area vector for reconstruction purposes
-    solutionVect_Type patchArea (*M_displacement, Unique, Add);
-    patchArea *= 0.0;
+    //The patch area and the FE space depend only on the mesh: they are built at the first call
+    if ( !M_recoveryFESpace )
+    {
+        //Constructing the patch area vector for reconstruction purposes
+        solutionVect_Type patchArea (*M_displacement, Unique, Add);
+        patchArea *= 0.0;
 
-    constructPatchAreaVector ( patchArea );
+        constructPatchAreaVector ( patchArea );
 
-    //Before assembling the reconstruction process is done
-    solutionVect_Type patchAreaR (patchArea, Repeated);
+        //Before assembling the reconstruction process is done
+        M_recoveryPatchArea.reset ( new solutionVect_Type (patchArea, Repeated) );
 
-    //Compute the area of reference element
-    Real refElemArea (0);
-    for (UInt iq (0); iq < M_FESpace->qr().nbQuadPt(); ++iq)
-    {
-        refElemArea += M_FESpace->qr().weight (iq);
-    }
+        //Compute the area of reference element
+        Real refElemArea (0);
+        for (UInt iq (0); iq < M_FESpace->qr().nbQuadPt(); ++iq)
+        {
+            refElemArea += M_FESpace->qr().weight (iq);
+        }
 
-    //Setting the quadrature Points = DOFs of the element and weight = 1
-    Real wQuad (refElemArea / M_FESpace->refFE().nbDof() );
-    std::vector<Real> weights (M_FESpace->fe().nbFEDof(), wQuad);
-    std::vector<GeoVector> coords = M_FESpace->refFE().refCoor();
+        //Setting the quadrature Points = DOFs of the element and weight = 1
+        Real wQuad (refElemArea / M_FESpace->refFE().nbDof() );
+        std::vector<Real> weights (M_FESpace->fe().nbFEDof(), wQuad);
+        std::vector<GeoVector> coords = M_FESpace->refFE().refCoor();
 
-    QuadratureRule fakeQuadratureRule;
-    fakeQuadratureRule.setDimensionShape ( shapeDimension (M_FESpace->refFE().shape() ), M_FESpace->refFE().shape() );
-    fakeQuadratureRule.setPoints (coords, weights);
+        M_recoveryQuadRule.reset ( new QuadratureRule );
+        M_recoveryQuadRule->setDimensionShape ( shapeDimension (M_FESpace->refFE().shape() ), M_FESpace->refFE().shape() );
+        M_recoveryQuadRule->setPoints (coords, weights);
 
-    //Creating a copy of the FESpace
-    feSpace_Type fakeFESpace ( M_FESpace->mesh(), M_FESpace->refFE(), M_FESpace->qr(), M_FESpace->bdQr(), 3, M_FESpace->map().commPtr() );
+        //Creating a copy of the FESpace
+        M_recoveryFESpace.reset ( new feSpace_Type ( M_FESpace->mesh(), M_FESpace->refFE(), M_FESpace->qr(), M_FESpace->bdQr(), 3, M_FESpace->map().commPtr() ) );
 
-    //Set the new quadrature rule
-    fakeFESpace.setQuadRule (fakeQuadratureRule);
+        //Set the new quadrature rule
+        M_recoveryFESpace->setQuadRule (*M_recoveryQuadRule);
+    }
+    const solutionVect_Type& patchAreaR (*M_recoveryPatchArea);
+    feSpace_Type& fakeFESpace (*M_recoveryFESpace);
 
     //Preliminary variables
     UInt totalDof = fakeFESpace.dof().numTotalDof();
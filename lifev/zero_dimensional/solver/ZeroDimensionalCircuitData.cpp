@@ -241,6 +241,23 @@ void ZeroDimensionalElementPassiveDiode::buildABC ( matrix_Type& A,
     ZeroDimensionalElementPassiveResistor::buildABC ( A, B, C, Nodes );
 }
 
+void ZeroDimensionalElementPassiveDiode::buildJacobian ( matrix_Type& A,
+                                                         matrix_Type& B,
+                                                         vector_Type& C,
+                                                         const zeroDimensionalNodeSPtr_Type& Nodes )
+{
+    const ZeroDimensionalNode& theNode = * ( Nodes->nodeListAt ( M_nodeIndex[0] ) );
+    const ZeroDimensionalNode& theOtherNode = * ( Nodes->nodeListAt ( M_nodeIndex[1] ) );
+    Real deltaVoltage = theNode.voltage() - theOtherNode.voltage();
+    calculateEffectiveResistance ( deltaVoltage );
+
+    // current = R_{eff} * deltaVoltage, hence d(current)/d(deltaVoltage) = alpha * beta * exp(alpha * (deltaVoltage - forwardBias))
+    const Real effectiveResistance = M_parameter;
+    M_parameter = M_alpha * M_beta * exp ( M_alpha * ( deltaVoltage - M_forwardBias ) );
+    ZeroDimensionalElementPassiveResistor::buildABC ( A, B, C, Nodes );
+    M_parameter = effectiveResistance;
+}
+
 // ===================================================
 // Constructors
 // ===================================================
@@ -994,8 +1011,8 @@ void ZeroDimensionalCircuitData::updateABC ( matrix_Type& A,
                                              matrix_Type& B,
                                              vector_Type& C )
 {
-    A.openCrsMatrix();
-    B.openCrsMatrix();
+    // The matrices are filled in place: if they are already assembled, their
+    // graph has to contain the pattern built by buildPattern
     A.matrixPtr()->PutScalar ( 0.0 );
     B.matrixPtr()->PutScalar ( 0.0 );
     C.epetraVector().PutScalar ( 0.0 );
@@ -1012,6 +1029,38 @@ void ZeroDimensionalCircuitData::updateABC ( matrix_Type& A,
     B.globalAssemble();
 }
 
+void ZeroDimensionalCircuitData::buildPattern ( matrix_Type& pattern,
+                                                vector_Type& C )
+{
+    const ptrVecZeroDimensionalElementPtr_Type& elementList = M_Elements->elementList();
+
+    //each element inserts the entries it couples, both in A and in B
+    for ( iterZeroDimensionalElement_Type theElement = elementList ->begin(); theElement != elementList->end(); theElement++ )
+    {
+        ( *theElement )->buildABC ( pattern, pattern, C, M_Nodes );
+    }
+    C.epetraVector().PutScalar ( 0.0 );
+}
+
+void ZeroDimensionalCircuitData::updateJacobian ( matrix_Type& A,
+                                                  matrix_Type& B,
+                                                  vector_Type& C )
+{
+    A.matrixPtr()->PutScalar ( 0.0 );
+    B.matrixPtr()->PutScalar ( 0.0 );
+    C.epetraVector().PutScalar ( 0.0 );
+
+    const ptrVecZeroDimensionalElementPtr_Type& elementList = M_Elements->elementList();
+
+    //iterate over all elements and compute each element's contribution on the derivatives
+    for ( iterZeroDimensionalElement_Type theElement = elementList ->begin(); theElement != elementList->end(); theElement++ )
+    {
+        ( *theElement )->buildJacobian ( A, B, C, M_Nodes );
+    }
+    A.globalAssemble();
+    B.globalAssemble();
+}
+
 
 OutPutFormat::OutPutFormat ( std::string width,
                              std::string precision,
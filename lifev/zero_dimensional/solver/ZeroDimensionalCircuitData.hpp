@@ -114,6 +114,18 @@ public:
      */
     virtual void buildABC ( matrix_Type& /*A*/, matrix_Type& /*B*/, vector_Type& /*C*/, const zeroDimensionalNodeSPtr_Type& /*Nodes*/ ) {}
 
+    //! Contribution of the element to the derivatives of the residual \bf{A}\dot{Y}+\bf{B}Y+\bf{C}.
+    /*!
+     * The derivatives with respect to \dot{Y} and Y are added to A and B respectively.
+     * For elements whose parameters do not depend on the solution they are the
+     * contributions of buildABC, which is the default.
+     * @param C workspace, its content is meaningless on exit
+     */
+    virtual void buildJacobian ( matrix_Type& A, matrix_Type& B, vector_Type& C, const zeroDimensionalNodeSPtr_Type& Nodes )
+    {
+        buildABC ( A, B, C, Nodes );
+    }
+
     //! Compute outputs (currents and voltages) from the solution vector after each succesful iteration.
     /*!
      * After each time step, when Rythmos solver is succesfully finishes, this method will compute
@@ -345,6 +357,9 @@ public:
 
     void buildABC ( matrix_Type& A, matrix_Type& B, vector_Type& C, const zeroDimensionalNodeSPtr_Type& Nodes );
 
+    //! The derivative of the current respect to the voltage difference replaces the effective resistance.
+    void buildJacobian ( matrix_Type& A, matrix_Type& B, vector_Type& C, const zeroDimensionalNodeSPtr_Type& Nodes );
+
     //@}
 
 
@@ -1380,6 +1395,23 @@ public:
      */
     void updateABC (matrix_Type& A, matrix_Type& B, vector_Type& C);
 
+    //! Insert in the matrix all the entries coupled by the circuit elements.
+    /*!
+     * The resulting graph is the union of the patterns of A and B. It depends only
+     * on the node-element incidence, so it is built once and the matrices are then
+     * filled in place by updateABC and updateJacobian. The values are meaningless.
+     * @param pattern matrix, not yet assembled
+     * @param C workspace
+     */
+    void buildPattern (matrix_Type& pattern, vector_Type& C);
+
+    //! create the derivatives of the residual respect to Yp (in A) and Y (in B).
+    /*!
+     * before calling this method, updateCircuitDataFromY method should be invoked.
+     * @param C workspace, its content is meaningless on exit
+     */
+    void updateJacobian (matrix_Type& A, matrix_Type& B, vector_Type& C);
+
 
     //! (deep) update the circuit data from solution.
     /*!
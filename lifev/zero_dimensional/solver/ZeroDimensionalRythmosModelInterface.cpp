@@ -49,7 +49,7 @@ RythmosModelInterface::RythmosModelInterface ( Int numCircuitElements,
                                                zeroDimensionalCircuitDataPtr_Type circuitData ) :
     M_numCircuitElements ( numCircuitElements ), M_numMyElements ( 0 ), M_myPID ( comm->MyPID() ), M_numProc ( comm->NumProc() ),
 
-    M_standardMap ( 0 ), M_initialSolutionY ( 0 ), M_initialSolutionYp ( 0 ), M_circuitData ( circuitData )
+    M_standardMap ( 0 ), M_initialSolutionY ( 0 ), M_initialSolutionYp ( 0 ), M_time ( 0. ), M_circuitData ( circuitData )
 {
     M_comm = comm->Clone();
     ( *M_comm ).PrintInfo ( std::cout );
@@ -58,25 +58,18 @@ RythmosModelInterface::RythmosModelInterface ( Int numCircuitElements,
                                            M_commSharedPtr ) );
     M_standardMap = ( M_mapEpetraPtr->map ( Unique ) ).get();
     M_numMyElements = M_standardMap->NumMyElements();
-    M_A.reset ( new matrix_Type ( *M_mapEpetraPtr,
-                                  M_numCircuitElements ) );
-    M_B.reset ( new matrix_Type ( *M_mapEpetraPtr,
-                                  M_numCircuitElements ) );
+    M_C.reset ( new vector_Type ( *M_mapEpetraPtr ) );
 
-    for ( Int i = 0; i < M_numCircuitElements; i++ )
-    {
-        for ( Int j = 0; j < M_numCircuitElements; j++ )
-        {
-            M_A->addToCoefficient ( i, j, 1.0 );
-            M_B->addToCoefficient ( i, j, 1.0 );
-        }
-    }
+    // A and B share the graph of the circuit topology: each row couples an
+    // equation only with the variables of the elements attached to it
+    M_A.reset ( new matrix_Type ( *M_mapEpetraPtr, S_meanEntriesPerRow ) );
+    M_circuitData->buildPattern ( *M_A, *M_C );
     M_A->globalAssemble();
-    M_B->globalAssemble();
+    M_A->matrixPtr()->PutScalar ( 0.0 );
+    M_B.reset ( new matrix_Type ( *M_A ) );
 
     M_graph = new Epetra_CrsGraph ( M_A->matrixPtr()->Graph() );
     M_graphSharedPtr.reset ( M_graph );
-    M_C.reset ( new vector_Type ( *M_mapEpetraPtr ) );
 
     M_fA.reset ( new vectorEpetra_Type ( *M_standardMap ) );
     M_fB.reset ( new vectorEpetra_Type ( *M_standardMap ) );
@@ -113,11 +106,18 @@ bool RythmosModelInterface::computeF ( __attribute__ ( (unused) )  const Epetra_
     return false;
 }
 
-bool RythmosModelInterface::computeJacobian ( __attribute__ ( (unused) )  const Epetra_Vector& x,
-                                              __attribute__ ( (unused) )  Epetra_Operator& my_Jac )
+bool RythmosModelInterface::computeJacobian ( const Epetra_Vector& x,
+                                              Epetra_Operator& my_Jac )
 {
-    std::cout << "Warning: I should not be here, 0D, Rythmos Model Interface";
-    return false;
+    // dF/dY does not depend on Yp, which is only needed to update the circuit data
+    M_circuitData->updateCircuitDataFromY ( M_time,
+                                            &x,
+                                            M_initialSolutionYp );
+    M_circuitData->updateJacobian ( *M_A,
+                                    *M_B,
+                                    *M_C );
+    assembleW ( 0., 1., dynamic_cast<Epetra_CrsMatrix&> ( my_Jac ) );
+    return true;
 }
 
 bool RythmosModelInterface::computePrecMatrix ( __attribute__ ( (unused) )  const Epetra_Vector& x )
@@ -196,6 +196,7 @@ bool RythmosModelInterface::evaluateFImplicit ( const Real& t,
     x->Print (std::cout);
     x_dot->Print (std::cout);
 #endif
+    M_time = t;
     M_circuitData->updateCircuitDataFromY ( t,
                                             x,
                                             x_dot );
@@ -244,28 +245,49 @@ bool RythmosModelInterface::evaluateWImplicit ( const Real& t,
     x->Print (std::cout);
     x_dot->Print (std::cout);
 #endif
+    M_time = t;
     M_circuitData->updateCircuitDataFromY ( t,
                                             x,
                                             x_dot );
-    M_circuitData->updateABC ( *M_A,
-                               *M_B,
-                               *M_C );
+    M_circuitData->updateJacobian ( *M_A,
+                                    *M_B,
+                                    *M_C );
 #ifdef HAVE_LIFEV_DEBUG
     M_A->matrixPtr()->Print (std::cout);
     M_B->matrixPtr()->Print (std::cout);
-    M_C->epetraVector().Print (std::cout);
 #endif
-    M_A->operator*= ( alpha );
-    M_B->operator*= ( beta );
-    M_A->operator+= ( *M_B );
-    Epetra_CrsMatrix* tmp = M_A->matrixPtr().get();
-    ( *W ) = ( *tmp );
+    assembleW ( alpha, beta, *W );
 #ifdef HAVE_LIFEV_DEBUG
     W->Print (std::cout);
 #endif
     return true;
 }
 
+void RythmosModelInterface::assembleW ( const Real& alpha,
+                                        const Real& beta,
+                                        Epetra_CrsMatrix& W ) const
+{
+    // A, B and W are built on the same graph, so that their rows have the same entries
+    const Epetra_CrsMatrix& A = *M_A->matrixPtr();
+    const Epetra_CrsMatrix& B = *M_B->matrixPtr();
+    for ( Int row = 0; row < M_numMyElements; ++row )
+    {
+        Int numEntriesA ( 0 ), numEntriesB ( 0 ), numEntriesW ( 0 );
+        Real* valuesA ( 0 );
+        Real* valuesB ( 0 );
+        Real* valuesW ( 0 );
+        A.ExtractMyRowView ( row, numEntriesA, valuesA );
+        B.ExtractMyRowView ( row, numEntriesB, valuesB );
+        W.ExtractMyRowView ( row, numEntriesW, valuesW );
+        ASSERT ( numEntriesA == numEntriesW && numEntriesB == numEntriesW, "0D, Rythmos Model Interface: W is not built on the circuit graph" );
+
+        for ( Int i = 0; i < numEntriesW; ++i )
+        {
+            valuesW[i] = alpha * valuesA[i] + beta * valuesB[i];
+        }
+    }
+}
+
 void RythmosModelInterface::extractSolution ( const Real& t,
                                               const vectorEpetra_Type& y,
                                               const vectorEpetra_Type& yp )
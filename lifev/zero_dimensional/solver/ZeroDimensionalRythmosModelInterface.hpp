@@ -87,7 +87,10 @@ public:
     //! This method is empty.
     virtual bool computeF (const Epetra_Vector& x, Epetra_Vector& FVec, FillType fillType = Residual);
 
-    //! This method is empty.
+    //! compute the jacobian of the residual respect to the solution, at the time of the last evaluation.
+    /*!
+     * @param Jac Epetra_CrsMatrix built on the graph returned by getGraph()
+     */
     virtual bool computeJacobian (const Epetra_Vector& x, Epetra_Operator& Jac);
 
     //! This method is empty
@@ -112,7 +115,7 @@ public:
     //! compute Implicit residual.
     virtual bool evaluateFImplicit (const Real& t, const Epetra_Vector* x, const Epetra_Vector* x_dot, Epetra_Vector* f );
 
-    //! compute jacobian.
+    //! compute jacobian, W = alpha * dF/dYp + beta * dF/dY, in the graph returned by getGraph().
     virtual bool evaluateWImplicit (const Real& t, const Real& alpha, const Real& beta, const Epetra_Vector* x, const Epetra_Vector* x_dot, Epetra_CrsMatrix* W );
 
     virtual bool initializeSolnY();
@@ -132,6 +135,13 @@ public:
     }
 
 protected:
+
+    //! W = alpha * A + beta * B, row by row, A, B and W sharing the same graph
+    void assembleW (const Real& alpha, const Real& beta, Epetra_CrsMatrix& W) const;
+
+    //! Estimate of the entries in each row, used only to preallocate the matrices
+    static const Int                                S_meanEntriesPerRow = 5;
+
     Int                                             M_numCircuitElements; // Total Number of elements
     Int                                             M_numMyElements; // Number of elements owned by this process
     Int                                             M_myPID; // Process number
@@ -144,6 +154,7 @@ protected:
     Epetra_Map*                                     M_standardMap;
     Epetra_Vector*                                  M_initialSolutionY;
     Epetra_Vector*                                  M_initialSolutionYp;
+    Real                                            M_time; // Time of the last evaluation
 
     zeroDimensionalCircuitDataPtr_Type              M_circuitData;
     matrixPtr_Type                                  M_A;